@@ -0,0 +1,421 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : column.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the column.h header file containing the chunked columnar file writer
+ *          and memory-mapped reader.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "column.h"
+
+#define COLUMN_BOM 0x01020304u
+
+// -------------------------------------------------------------------------------------------->
+// HEADER HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Fields of the 64-byte file header, in the order they are stored.
+ */
+typedef struct {
+    uint32_t tag;
+    uint32_t withStats;
+    uint32_t elemSize;
+    uint32_t chunkElems;
+    uint64_t count;
+    uint64_t chunkCount;
+    uint64_t statsOffset;
+} ColumnHeader;
+
+static void encodeHeaderColumn(unsigned char* out, const ColumnHeader* h) {
+    uint16_t version = COLUMN_VERSION;
+    uint32_t bom = COLUMN_BOM;
+
+    memset(out, 0, COLUMN_HEADER);
+    memcpy(out, "COLF", 4);
+    memcpy(out + 4, &version, 2);
+    out[6] = (unsigned char) h->tag;
+    out[7] = (unsigned char) h->withStats;
+    memcpy(out + 8, &h->elemSize, 4);
+    memcpy(out + 12, &h->chunkElems, 4);
+    memcpy(out + 16, &bom, 4);
+    memcpy(out + 24, &h->count, 8);
+    memcpy(out + 32, &h->chunkCount, 8);
+    memcpy(out + 40, &h->statsOffset, 8);
+}
+
+/**
+ * @brief Decodes and checks a header against the file size.
+ *
+ * @return 1 if the header is complete and every section it describes lies inside the file.
+ */
+static int decodeHeaderColumn(const unsigned char* in, size_t fileSize, ColumnHeader* h) {
+    uint16_t version;
+    uint32_t bom;
+
+    memcpy(&version, in + 4, 2);
+    memcpy(&bom, in + 16, 4);
+    h->tag = in[6];
+    h->withStats = in[7];
+    memcpy(&h->elemSize, in + 8, 4);
+    memcpy(&h->chunkElems, in + 12, 4);
+    memcpy(&h->count, in + 24, 8);
+    memcpy(&h->chunkCount, in + 32, 8);
+    memcpy(&h->statsOffset, in + 40, 8);
+
+    if (memcmp(in, "COLF", 4) != 0 || version != COLUMN_VERSION || bom != COLUMN_BOM ||
+        h->elemSize == 0 || h->chunkElems == 0 ||
+        h->chunkCount != (h->count + h->chunkElems - 1) / h->chunkElems ||
+        h->count > (fileSize - COLUMN_HEADER) / h->elemSize) {
+        return 0;
+    }
+
+    return !h->withStats || (h->statsOffset % 8 == 0 &&
+           (h->statsOffset >= COLUMN_HEADER + h->count * h->elemSize && h->statsOffset <= fileSize &&
+            h->chunkCount <= (fileSize - h->statsOffset) / (2 * h->elemSize)));
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO OPEN COLUMN WRITER :             CREATE FILE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Creates (or truncates) `path` and prepares to stream values into it.
+ *
+ * The header is written as zeros until closeColumnWriter() fills it in, so a file left behind
+ * by a crashed writer is never accepted by a reader.
+ *
+ * @param w Pointer to the writer.
+ * @param path Output file.
+ * @param chunkElems Elements per chunk; 0 or less selects COLUMN_CHUNK_ELEMS.
+ * @param withStats Non-zero to store the min and max of every chunk.
+ *
+ * @return 1 on success, 0 if the file or the chunk buffer could not be created.
+ */
+#define COLUMN_OPEN_WRITER(type) \
+    int openColumnWriter__##type(ColumnWriter__##type* w, const char* path, int chunkElems, int withStats) { \
+        unsigned char header[COLUMN_HEADER] = {0}; \
+        \
+        w->chunkElems = chunkElems > 0 ? (uint32_t) chunkElems : COLUMN_CHUNK_ELEMS; \
+        w->withStats = withStats != 0; \
+        w->fill = 0; \
+        w->count = 0; \
+        w->chunkCount = 0; \
+        w->stats = NULL; \
+        w->statsCapacity = 0; \
+        w->error = 0; \
+        w->chunk = (type*) malloc(w->chunkElems * sizeof(type)); \
+        w->fp = w->chunk != NULL ? fopen(path, "wb") : NULL; \
+        \
+        if (w->fp == NULL || fwrite(header, 1, COLUMN_HEADER, w->fp) != COLUMN_HEADER) { \
+            if (w->fp != NULL) { \
+                fclose(w->fp); \
+            } \
+            \
+            free(w->chunk); \
+            w->chunk = NULL; \
+            w->fp = NULL; \
+            return 0; \
+        } \
+        \
+        return 1; \
+    } \
+
+COLUMN_OPEN_WRITER(int)
+COLUMN_OPEN_WRITER(float)
+COLUMN_OPEN_WRITER(char)
+COLUMN_OPEN_WRITER(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO APPEND TO COLUMN :               SINGLE / ARRAY
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Appends values to the column, writing out each chunk as soon as it is full.
+ *
+ * When statistics are on, a full chunk is scanned once for its min and max just before it is
+ * written. NaN values are left out of the statistics; a chunk holding only NaN gets NaN bounds,
+ * which no range query matches.
+ *
+ * After the first write error every append fails, and closeColumnWriter() reports it.
+ *
+ * @param w Pointer to the writer.
+ *
+ * @return 1 on success, 0 on a write or allocation error.
+ */
+#define COLUMN_APPEND(type) \
+    static int flushChunkColumn__##type(ColumnWriter__##type* w) { \
+        type* grown; \
+        type min, max; \
+        uint32_t i; \
+        int have = 0; \
+        \
+        if (w->withStats) { \
+            if (w->chunkCount == w->statsCapacity) { \
+                w->statsCapacity = w->statsCapacity == 0 ? 64 : w->statsCapacity * 2; \
+                grown = (type*) realloc(w->stats, w->statsCapacity * 2 * sizeof(type)); \
+                \
+                if (grown == NULL) { \
+                    w->error = 1; \
+                    return 0; \
+                } \
+                \
+                w->stats = grown; \
+            } \
+            \
+            min = max = w->chunk[0]; \
+            \
+            for (i = 0; i < w->fill; i++) { \
+                if (w->chunk[i] == w->chunk[i]) { \
+                    if (!have || w->chunk[i] < min) { \
+                        min = w->chunk[i]; \
+                    } \
+                    \
+                    if (!have || w->chunk[i] > max) { \
+                        max = w->chunk[i]; \
+                    } \
+                    \
+                    have = 1; \
+                } \
+            } \
+            \
+            w->stats[2 * w->chunkCount] = min; \
+            w->stats[2 * w->chunkCount + 1] = max; \
+        } \
+        \
+        if (fwrite(w->chunk, sizeof(type), w->fill, w->fp) != w->fill) { \
+            w->error = 1; \
+            return 0; \
+        } \
+        \
+        w->chunkCount++; \
+        w->fill = 0; \
+        \
+        return 1; \
+    } \
+    \
+    int appendColumn__##type(ColumnWriter__##type* w, type value) { \
+        if (w->error) { \
+            return 0; \
+        } \
+        \
+        w->chunk[w->fill++] = value; \
+        w->count++; \
+        \
+        return w->fill < w->chunkElems || flushChunkColumn__##type(w); \
+    } \
+    \
+    int appendArrayColumn__##type(ColumnWriter__##type* w, const type* values, size_t n) { \
+        size_t take; \
+        \
+        while (n > 0 && !w->error) { \
+            take = w->chunkElems - w->fill; \
+            take = take < n ? take : n; \
+            memcpy(w->chunk + w->fill, values, take * sizeof(type)); \
+            w->fill += (uint32_t) take; \
+            w->count += take; \
+            values += take; \
+            n -= take; \
+            \
+            if (w->fill == w->chunkElems) { \
+                flushChunkColumn__##type(w); \
+            } \
+        } \
+        \
+        return !w->error; \
+    } \
+
+COLUMN_APPEND(int)
+COLUMN_APPEND(float)
+COLUMN_APPEND(char)
+COLUMN_APPEND(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO CLOSE COLUMN WRITER :            STATS + HEADER
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Writes the last chunk, the statistics and the real header, then closes the file.
+ *
+ * The statistics start at the first 8-byte boundary after the values, so a mapped reader can
+ * use them in place. The writer is released whether or not this succeeds.
+ *
+ * @param w Pointer to the writer.
+ *
+ * @return 1 if the whole column was written, 0 if any write failed along the way.
+ */
+#define COLUMN_CLOSE_WRITER(type) \
+    int closeColumnWriter__##type(ColumnWriter__##type* w) { \
+        unsigned char header[COLUMN_HEADER]; \
+        unsigned char pad[8] = {0}; \
+        ColumnHeader h; \
+        uint64_t end; \
+        int ok; \
+        \
+        if (w->fill > 0 && !w->error) { \
+            flushChunkColumn__##type(w); \
+        } \
+        \
+        end = COLUMN_HEADER + w->count * sizeof(type); \
+        h.tag = COLUMN_TAG_##type; \
+        h.withStats = (uint32_t) w->withStats; \
+        h.elemSize = sizeof(type); \
+        h.chunkElems = w->chunkElems; \
+        h.count = w->count; \
+        h.chunkCount = w->chunkCount; \
+        h.statsOffset = w->withStats ? (end + 7) & ~(uint64_t) 7 : 0; \
+        encodeHeaderColumn(header, &h); \
+        \
+        ok = !w->error; \
+        \
+        if (ok && w->withStats) { \
+            ok = fwrite(pad, 1, (size_t) (h.statsOffset - end), w->fp) == (size_t) (h.statsOffset - end) && \
+                 fwrite(w->stats, 2 * sizeof(type), (size_t) w->chunkCount, w->fp) == (size_t) w->chunkCount; \
+        } \
+        \
+        ok = ok && fseek(w->fp, 0, SEEK_SET) == 0 && fwrite(header, 1, COLUMN_HEADER, w->fp) == COLUMN_HEADER; \
+        ok = (fclose(w->fp) == 0) && ok; \
+        \
+        free(w->chunk); \
+        free(w->stats); \
+        w->fp = NULL; \
+        w->chunk = NULL; \
+        w->stats = NULL; \
+        \
+        return ok; \
+    } \
+
+COLUMN_CLOSE_WRITER(int)
+COLUMN_CLOSE_WRITER(float)
+COLUMN_CLOSE_WRITER(char)
+COLUMN_CLOSE_WRITER(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO OPEN / CLOSE COLUMN READER :     MEMORY MAP
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Maps a column file read-only and checks its header.
+ *
+ * Nothing is read up front: values and statistics are paged in by the OS when they are first
+ * touched, so skipping a chunk by its statistics also skips its I/O.
+ *
+ * @param r Pointer to the reader.
+ * @param path Column file written by closeColumnWriter().
+ *
+ * @return 1 on success, 0 if the file cannot be mapped, is incomplete, or holds a different
+ *         element type, version or byte order.
+ */
+#define COLUMN_OPEN_READER(type) \
+    int openColumnReader__##type(ColumnReader__##type* r, const char* path) { \
+        ColumnHeader h; \
+        struct stat st; \
+        void* base = MAP_FAILED; \
+        int fd = open(path, O_RDONLY); \
+        \
+        r->base = NULL; \
+        r->mapped = 0; \
+        \
+        if (fd < 0) { \
+            return 0; \
+        } \
+        \
+        if (fstat(fd, &st) == 0 && st.st_size >= COLUMN_HEADER) { \
+            base = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0); \
+        } \
+        \
+        close(fd); \
+        \
+        if (base == MAP_FAILED) { \
+            return 0; \
+        } \
+        \
+        if (!decodeHeaderColumn((unsigned char*) base, (size_t) st.st_size, &h) || \
+            h.tag != COLUMN_TAG_##type || h.elemSize != sizeof(type)) { \
+            munmap(base, (size_t) st.st_size); \
+            return 0; \
+        } \
+        \
+        r->base = (unsigned char*) base; \
+        r->mapped = (size_t) st.st_size; \
+        r->data = (const type*) (r->base + COLUMN_HEADER); \
+        r->stats = h.withStats ? (const type*) (r->base + h.statsOffset) : NULL; \
+        r->count = h.count; \
+        r->chunkCount = h.chunkCount; \
+        r->chunkElems = h.chunkElems; \
+        \
+        return 1; \
+    } \
+    \
+    void closeColumnReader__##type(ColumnReader__##type* r) { \
+        if (r->base != NULL) { \
+            munmap(r->base, r->mapped); \
+        } \
+        \
+        r->base = NULL; \
+        r->mapped = 0; \
+        r->data = NULL; \
+        r->stats = NULL; \
+    } \
+
+COLUMN_OPEN_READER(int)
+COLUMN_OPEN_READER(float)
+COLUMN_OPEN_READER(char)
+COLUMN_OPEN_READER(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO ACCESS COLUMN CHUNKS :           DATA / STATS / RANGE SKIP
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Chunk-level access to a mapped column.
+ *
+ * - chunkColumn returns a pointer to the values of `chunk` inside the mapping and stores their
+ *   number in `count`; NULL if `chunk` is out of range.
+ * - chunkStatsColumn copies the min and max of `chunk`; 0 if out of range or the file has no
+ *   statistics.
+ * - nextChunkInRangeColumn returns the first chunk at or after `fromChunk` whose [min, max]
+ *   overlaps [lo, hi], or -1 if none does. Without statistics no chunk can be ruled out, so it
+ *   returns `fromChunk` itself while it is in range.
+ *
+ * @param r Pointer to the reader.
+ */
+#define COLUMN_CHUNKS(type) \
+    const type* chunkColumn__##type(const ColumnReader__##type* r, long chunk, int* count) { \
+        uint64_t start; \
+        \
+        if (chunk < 0 || (uint64_t) chunk >= r->chunkCount) { \
+            *count = 0; \
+            return NULL; \
+        } \
+        \
+        start = (uint64_t) chunk * r->chunkElems; \
+        *count = (int) (r->count - start < r->chunkElems ? r->count - start : r->chunkElems); \
+        \
+        return r->data + start; \
+    } \
+    \
+    int chunkStatsColumn__##type(const ColumnReader__##type* r, long chunk, type* min, type* max) { \
+        if (r->stats == NULL || chunk < 0 || (uint64_t) chunk >= r->chunkCount) { \
+            return 0; \
+        } \
+        \
+        *min = r->stats[2 * chunk]; \
+        *max = r->stats[2 * chunk + 1]; \
+        \
+        return 1; \
+    } \
+    \
+    long nextChunkInRangeColumn__##type(const ColumnReader__##type* r, long fromChunk, type lo, type hi) { \
+        long chunk = fromChunk < 0 ? 0 : fromChunk; \
+        \
+        for (; (uint64_t) chunk < r->chunkCount; chunk++) { \
+            if (r->stats == NULL || (r->stats[2 * chunk] <= hi && r->stats[2 * chunk + 1] >= lo)) { \
+                return chunk; \
+            } \
+        } \
+        \
+        return -1; \
+    } \
+
+COLUMN_CHUNKS(int)
+COLUMN_CHUNKS(float)
+COLUMN_CHUNKS(char)
+COLUMN_CHUNKS(double)
@@ -0,0 +1,126 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : column.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the chunked columnar file writer and memory-mapped reader.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef COLUMN_H
+#define COLUMN_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief Default number of elements per chunk.
+ */
+#ifndef COLUMN_CHUNK_ELEMS
+#define COLUMN_CHUNK_ELEMS 65536
+#endif
+
+/**
+ * @brief File format version and header size.
+ */
+#define COLUMN_VERSION 1
+#define COLUMN_HEADER 64
+
+/**
+ * @brief Type tags stored in the header so a column is never read as the wrong element type.
+ */
+#define COLUMN_TAG_int 1
+#define COLUMN_TAG_float 2
+#define COLUMN_TAG_char 3
+#define COLUMN_TAG_double 4
+
+/**
+ * @brief Macro to declare a columnar writer and reader for a specific data type.
+ *
+ * A column file holds one typed column, in host byte order:
+ *
+ * | Offset           | Field                                                            |
+ * |------------------|------------------------------------------------------------------|
+ * | 0                | header: magic `"COLF"`, version, type tag, stats flag, element   |
+ * |                  | size, chunk size, byte-order mark, element count, chunk count,   |
+ * |                  | stats offset                                                     |
+ * | 64               | values, chunk after chunk; chunk `i` starts at element           |
+ * |                  | `i * chunkElems` and only the last one may be short              |
+ * | statsOffset      | optional `{min, max}` pair per chunk                             |
+ *
+ * Because chunks have a fixed size, a reader finds any chunk by arithmetic and can map the file
+ * and use the values in place.
+ *
+ * @param type The data type for the column.
+ */
+#define DECLARE_COLUMN(type) \
+    typedef struct { \
+        FILE* fp; \
+        type* chunk; \
+        type* stats; \
+        size_t statsCapacity; \
+        uint32_t chunkElems; \
+        uint32_t fill; \
+        uint64_t count; \
+        uint64_t chunkCount; \
+        int withStats; \
+        int error; \
+    } ColumnWriter__##type; \
+    typedef struct { \
+        unsigned char* base; \
+        size_t mapped; \
+        const type* data; \
+        const type* stats; \
+        uint64_t count; \
+        uint64_t chunkCount; \
+        uint32_t chunkElems; \
+    } ColumnReader__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for columnar file operations.
+ *
+ * The writer streams values into one chunk buffer and flushes it each time it fills, so memory
+ * use does not depend on the column length. The reader maps the file read-only and hands out
+ * pointers into the mapping.
+ *
+ * @param type The data type for the column.
+ */
+#define COLUMN_PROTO(type) \
+    int openColumnWriter__##type(ColumnWriter__##type* w, const char* path, int chunkElems, int withStats); \
+    int appendColumn__##type(ColumnWriter__##type* w, type value); \
+    int appendArrayColumn__##type(ColumnWriter__##type* w, const type* values, size_t n); \
+    int closeColumnWriter__##type(ColumnWriter__##type* w); \
+    int openColumnReader__##type(ColumnReader__##type* r, const char* path); \
+    void closeColumnReader__##type(ColumnReader__##type* r); \
+    const type* chunkColumn__##type(const ColumnReader__##type* r, long chunk, int* count); \
+    int chunkStatsColumn__##type(const ColumnReader__##type* r, long chunk, type* min, type* max); \
+    long nextChunkInRangeColumn__##type(const ColumnReader__##type* r, long fromChunk, type lo, type hi); \
+
+// Declaration for int data type
+DECLARE_COLUMN(int);
+// Declaration for float data type
+DECLARE_COLUMN(float);
+// Declaration for char data type
+DECLARE_COLUMN(char);
+// Declaration for double data type
+DECLARE_COLUMN(double);
+
+COLUMN_PROTO(int)
+COLUMN_PROTO(float)
+COLUMN_PROTO(char)
+COLUMN_PROTO(double)
+
+// Macro aliases for function calls
+#define openColumnWriter(w, path, chunkElems, withStats, type) openColumnWriter__##type(w, path, chunkElems, withStats)
+#define appendColumn(w, value, type) appendColumn__##type(w, value)
+#define appendArrayColumn(w, values, n, type) appendArrayColumn__##type(w, values, n)
+#define closeColumnWriter(w, type) closeColumnWriter__##type(w)
+#define openColumnReader(r, path, type) openColumnReader__##type(r, path)
+#define closeColumnReader(r, type) closeColumnReader__##type(r)
+#define chunkColumn(r, chunk, count, type) chunkColumn__##type(r, chunk, count)
+#define chunkStatsColumn(r, chunk, min, max, type) chunkStatsColumn__##type(r, chunk, min, max)
+#define nextChunkInRangeColumn(r, fromChunk, lo, hi, type) nextChunkInRangeColumn__##type(r, fromChunk, lo, hi)
+
+
+#endif /* COLUMN_H */
@@ -0,0 +1,382 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : deque.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the deque.h header file containing the block-based deque implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "deque.h"
+
+// -------------------------------------------------------------------------------------------->
+// BLOCK HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Block helpers: take a block from the spare chain (or malloc one), give a block back to
+ *        the spare chain (or free it once DEQUE_MAX_SPARE are kept), and find the block holding
+ *        element `idx` by walking from the nearer end.
+ */
+#define DEQUE_HELPERS(type) \
+    static struct DequeBlock__##type* takeBlockDEQUE__##type(DEQUE__##type* dq) { \
+        struct DequeBlock__##type* b = dq->spare; \
+        \
+        if (b != NULL) { \
+            dq->spare = b->next; \
+            dq->spareCount--; \
+        } else { \
+            b = (struct DequeBlock__##type*) malloc(sizeof(struct DequeBlock__##type)); \
+            \
+            if (b == NULL) { \
+                return NULL; \
+            } \
+        } \
+        \
+        b->prev = NULL; \
+        b->next = NULL; \
+        return b; \
+    } \
+    \
+    static void giveBlockDEQUE__##type(DEQUE__##type* dq, struct DequeBlock__##type* b) { \
+        if (dq->spareCount < DEQUE_MAX_SPARE) { \
+            b->next = dq->spare; \
+            dq->spare = b; \
+            dq->spareCount++; \
+        } else { \
+            free(b); \
+        } \
+    } \
+    \
+    static type* slotDEQUE__##type(DEQUE__##type* dq, int idx) { \
+        struct DequeBlock__##type* b; \
+        int pos = dq->begin + idx; \
+        int steps; \
+        \
+        if (idx < dq->size / 2) { \
+            b = dq->first; \
+            \
+            for (steps = pos / DEQUE_BLOCK_SIZE; steps > 0; steps--) { \
+                b = b->next; \
+            } \
+        } else { \
+            b = dq->last; \
+            \
+            for (steps = (dq->begin + dq->size - 1) / DEQUE_BLOCK_SIZE - pos / DEQUE_BLOCK_SIZE; steps > 0; steps--) { \
+                b = b->prev; \
+            } \
+        } \
+        \
+        return b->data + pos % DEQUE_BLOCK_SIZE; \
+    } \
+
+DEQUE_HELPERS(int)
+DEQUE_HELPERS(float)
+DEQUE_HELPERS(char)
+DEQUE_HELPERS(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE THE DEQUE :   O(1)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Initializes an empty deque. No block is allocated until the first push.
+ *
+ * @param dq Pointer to the deque.
+ */
+#define DEQUE_INIT(type) \
+    void initDEQUE__##type(DEQUE__##type* dq) { \
+        dq->first = NULL; \
+        dq->last = NULL; \
+        dq->spare = NULL; \
+        dq->begin = 0; \
+        dq->end = 0; \
+        dq->size = 0; \
+        dq->spareCount = 0; \
+    } \
+
+DEQUE_INIT(int)
+DEQUE_INIT(float)
+DEQUE_INIT(char)
+DEQUE_INIT(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTIONS TO PUSH AT EITHER END :   O(1)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Pushes an element at the front or at the back.
+ *
+ * The first block is started in the middle so that either end can grow before another block
+ * is needed. When the end block is full a new one is linked in next to it.
+ *
+ * @param dq Pointer to the deque.
+ * @param data The element to push.
+ * @return 1 on success, 0 if a new block could not be allocated.
+ */
+#define DEQUE_PUSH(type) \
+    static int startDEQUE__##type(DEQUE__##type* dq) { \
+        struct DequeBlock__##type* b = takeBlockDEQUE__##type(dq); \
+        \
+        if (b == NULL) { \
+            return 0; \
+        } \
+        \
+        dq->first = b; \
+        dq->last = b; \
+        dq->begin = DEQUE_BLOCK_SIZE / 2; \
+        dq->end = DEQUE_BLOCK_SIZE / 2; \
+        return 1; \
+    } \
+    \
+    int pushFrontDEQUE__##type(DEQUE__##type* dq, type data) { \
+        if (dq->first == NULL) { \
+            if (!startDEQUE__##type(dq)) { \
+                return 0; \
+            } \
+        } else if (dq->begin == 0) { \
+            struct DequeBlock__##type* b = takeBlockDEQUE__##type(dq); \
+            \
+            if (b == NULL) { \
+                return 0; \
+            } \
+            \
+            b->next = dq->first; \
+            dq->first->prev = b; \
+            dq->first = b; \
+            dq->begin = DEQUE_BLOCK_SIZE; \
+        } \
+        \
+        dq->first->data[--dq->begin] = data; \
+        dq->size++; \
+        return 1; \
+    } \
+    \
+    int pushBackDEQUE__##type(DEQUE__##type* dq, type data) { \
+        if (dq->last == NULL) { \
+            if (!startDEQUE__##type(dq)) { \
+                return 0; \
+            } \
+        } else if (dq->end == DEQUE_BLOCK_SIZE) { \
+            struct DequeBlock__##type* b = takeBlockDEQUE__##type(dq); \
+            \
+            if (b == NULL) { \
+                return 0; \
+            } \
+            \
+            b->prev = dq->last; \
+            dq->last->next = b; \
+            dq->last = b; \
+            dq->end = 0; \
+        } \
+        \
+        dq->last->data[dq->end++] = data; \
+        dq->size++; \
+        return 1; \
+    } \
+
+DEQUE_PUSH(int)
+DEQUE_PUSH(float)
+DEQUE_PUSH(char)
+DEQUE_PUSH(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTIONS TO POP FROM EITHER END :   O(1)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes the front or back element and stores it in `out`.
+ *
+ * A block left empty by the pop is moved to the spare chain. When the deque becomes empty its
+ * last block is kept and re-centred, so a deque that oscillates around zero never allocates.
+ *
+ * @param dq Pointer to the deque.
+ * @param out Where to store the removed element; may be NULL.
+ * @return 1 on success, 0 if the deque is empty.
+ */
+#define DEQUE_POP(type) \
+    int popFrontDEQUE__##type(DEQUE__##type* dq, type* out) { \
+        if (dq->size == 0) { \
+            return 0; \
+        } \
+        \
+        if (out != NULL) { \
+            *out = dq->first->data[dq->begin]; \
+        } \
+        \
+        dq->begin++; \
+        dq->size--; \
+        \
+        if (dq->size == 0) { \
+            dq->begin = DEQUE_BLOCK_SIZE / 2; \
+            dq->end = DEQUE_BLOCK_SIZE / 2; \
+        } else if (dq->begin == DEQUE_BLOCK_SIZE) { \
+            struct DequeBlock__##type* b = dq->first; \
+            \
+            dq->first = b->next; \
+            dq->first->prev = NULL; \
+            dq->begin = 0; \
+            giveBlockDEQUE__##type(dq, b); \
+        } \
+        \
+        return 1; \
+    } \
+    \
+    int popBackDEQUE__##type(DEQUE__##type* dq, type* out) { \
+        if (dq->size == 0) { \
+            return 0; \
+        } \
+        \
+        dq->end--; \
+        dq->size--; \
+        \
+        if (out != NULL) { \
+            *out = dq->last->data[dq->end]; \
+        } \
+        \
+        if (dq->size == 0) { \
+            dq->begin = DEQUE_BLOCK_SIZE / 2; \
+            dq->end = DEQUE_BLOCK_SIZE / 2; \
+        } else if (dq->end == 0) { \
+            struct DequeBlock__##type* b = dq->last; \
+            \
+            dq->last = b->prev; \
+            dq->last->next = NULL; \
+            dq->end = DEQUE_BLOCK_SIZE; \
+            giveBlockDEQUE__##type(dq, b); \
+        } \
+        \
+        return 1; \
+    } \
+
+DEQUE_POP(int)
+DEQUE_POP(float)
+DEQUE_POP(char)
+DEQUE_POP(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTIONS TO READ AND UPDATE ELEMENTS :   O(1) AT THE ENDS, O(n / DEQUE_BLOCK_SIZE) BY INDEX
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Element access.
+ *
+ * frontDEQUE() / backDEQUE() return the end elements, or `data404Response` if the deque is
+ * empty. getDataAtDEQUE() / updateAtDEQUE() locate the block holding `targetIdx` by walking
+ * whole blocks from the nearer end; out-of-range indexes return `data404Response` / are ignored.
+ */
+#define DEQUE_ACCESS(type) \
+    type frontDEQUE__##type(DEQUE__##type* dq, type data404Response) { \
+        if (dq->size == 0) { \
+            return data404Response; \
+        } \
+        \
+        return dq->first->data[dq->begin]; \
+    } \
+    \
+    type backDEQUE__##type(DEQUE__##type* dq, type data404Response) { \
+        if (dq->size == 0) { \
+            return data404Response; \
+        } \
+        \
+        return dq->last->data[dq->end - 1]; \
+    } \
+    \
+    type getDataAtDEQUE__##type(DEQUE__##type* dq, int targetIdx, type data404Response) { \
+        if (targetIdx < 0 || targetIdx >= dq->size) { \
+            return data404Response; \
+        } \
+        \
+        return *slotDEQUE__##type(dq, targetIdx); \
+    } \
+    \
+    void updateAtDEQUE__##type(DEQUE__##type* dq, int targetIdx, type newData) { \
+        if (targetIdx < 0 || targetIdx >= dq->size) { \
+            return; \
+        } \
+        \
+        *slotDEQUE__##type(dq, targetIdx) = newData; \
+    } \
+    \
+    int sizeDEQUE__##type(DEQUE__##type* dq) { \
+        return dq->size; \
+    } \
+
+DEQUE_ACCESS(int)
+DEQUE_ACCESS(float)
+DEQUE_ACCESS(char)
+DEQUE_ACCESS(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO VISIT EVERY ELEMENT :   O(n)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Calls `visit(data, ctx)` for every element from front to back, one block at a time.
+ *
+ * @param dq Pointer to the deque.
+ * @param visit Callback invoked for each element.
+ * @param ctx User pointer passed to the callback.
+ */
+#define DEQUE_FOR_EACH(type) \
+    void forEachDEQUE__##type(DEQUE__##type* dq, void (*visit)(type data, void* ctx), void* ctx) { \
+        struct DequeBlock__##type* b; \
+        int i, from, to; \
+        \
+        if (dq->size == 0) { \
+            return; \
+        } \
+        \
+        for (b = dq->first; b != NULL; b = b->next) { \
+            from = b == dq->first ? dq->begin : 0; \
+            to = b == dq->last ? dq->end : DEQUE_BLOCK_SIZE; \
+            \
+            for (i = from; i < to; i++) { \
+                visit(b->data[i], ctx); \
+            } \
+        } \
+    } \
+
+DEQUE_FOR_EACH(int)
+DEQUE_FOR_EACH(float)
+DEQUE_FOR_EACH(char)
+DEQUE_FOR_EACH(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTIONS TO CLEAR AND FREE THE DEQUE :   O(n / DEQUE_BLOCK_SIZE)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief clearDEQUE() empties the deque and moves its blocks to the spare chain (freeing those
+ *        beyond DEQUE_MAX_SPARE). freeDEQUE() releases every block, spares included.
+ *
+ * @param dq Pointer to the deque.
+ */
+#define DEQUE_CLEAR_FREE(type) \
+    void clearDEQUE__##type(DEQUE__##type* dq) { \
+        struct DequeBlock__##type* b = dq->first; \
+        struct DequeBlock__##type* next; \
+        \
+        while (b != NULL) { \
+            next = b->next; \
+            giveBlockDEQUE__##type(dq, b); \
+            b = next; \
+        } \
+        \
+        dq->first = NULL; \
+        dq->last = NULL; \
+        dq->begin = 0; \
+        dq->end = 0; \
+        dq->size = 0; \
+    } \
+    \
+    void freeDEQUE__##type(DEQUE__##type* dq) { \
+        struct DequeBlock__##type* b; \
+        \
+        clearDEQUE__##type(dq); \
+        \
+        while (dq->spare != NULL) { \
+            b = dq->spare; \
+            dq->spare = b->next; \
+            free(b); \
+        } \
+        \
+        dq->spareCount = 0; \
+    } \
+
+DEQUE_CLEAR_FREE(int)
+DEQUE_CLEAR_FREE(float)
+DEQUE_CLEAR_FREE(char)
+DEQUE_CLEAR_FREE(double)
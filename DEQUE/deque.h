@@ -0,0 +1,108 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : deque.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the block-based double-ended queue implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <stdlib.h>
+
+/**
+ * @brief Elements per block.
+ */
+#ifndef DEQUE_BLOCK_SIZE
+#define DEQUE_BLOCK_SIZE 256
+#endif
+
+/**
+ * @brief Number of emptied blocks kept for reuse instead of being freed.
+ */
+#ifndef DEQUE_MAX_SPARE
+#define DEQUE_MAX_SPARE 4
+#endif
+
+/**
+ * @brief Macro to declare a block-based deque for a specific data type.
+ *
+ * Elements are stored in fixed-size arrays of DEQUE_BLOCK_SIZE, chained both ways like DLL
+ * nodes. The elements run from `first->data[begin]` to `last->data[end - 1]`; every block in
+ * between is full. Blocks emptied by pops go to the `spare` chain (up to DEQUE_MAX_SPARE) and
+ * are reused by later pushes, so a deque that stays around the same size stops allocating.
+ *
+ * @param type The data type for the deque.
+ */
+#define DECLARE_DEQUE(type) \
+    struct DequeBlock__##type { \
+        struct DequeBlock__##type* prev; \
+        struct DequeBlock__##type* next; \
+        type data[DEQUE_BLOCK_SIZE]; \
+    }; \
+    typedef struct { \
+        struct DequeBlock__##type* first; \
+        struct DequeBlock__##type* last; \
+        struct DequeBlock__##type* spare; \
+        int begin; \
+        int end; \
+        int size; \
+        int spareCount; \
+    } DEQUE__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for deque operations.
+ *
+ * Pushes and pops at either end are O(1), and a malloc is needed only once per
+ * DEQUE_BLOCK_SIZE pushes, or never while spare blocks are left. Indexed access walks whole
+ * blocks from the nearer end, O(n / DEQUE_BLOCK_SIZE).
+ *
+ * @param type The data type for the deque.
+ */
+#define DEQUE_PROTO(type) \
+    void initDEQUE__##type(DEQUE__##type* dq); \
+    int pushFrontDEQUE__##type(DEQUE__##type* dq, type data); \
+    int pushBackDEQUE__##type(DEQUE__##type* dq, type data); \
+    int popFrontDEQUE__##type(DEQUE__##type* dq, type* out); \
+    int popBackDEQUE__##type(DEQUE__##type* dq, type* out); \
+    type frontDEQUE__##type(DEQUE__##type* dq, type data404Response); \
+    type backDEQUE__##type(DEQUE__##type* dq, type data404Response); \
+    type getDataAtDEQUE__##type(DEQUE__##type* dq, int targetIdx, type data404Response); \
+    void updateAtDEQUE__##type(DEQUE__##type* dq, int targetIdx, type newData); \
+    int sizeDEQUE__##type(DEQUE__##type* dq); \
+    void forEachDEQUE__##type(DEQUE__##type* dq, void (*visit)(type data, void* ctx), void* ctx); \
+    void clearDEQUE__##type(DEQUE__##type* dq); \
+    void freeDEQUE__##type(DEQUE__##type* dq); \
+
+// Declaration for int data type
+DECLARE_DEQUE(int);
+// Declaration for float data type
+DECLARE_DEQUE(float);
+// Declaration for char data type
+DECLARE_DEQUE(char);
+// Declaration for double data type
+DECLARE_DEQUE(double);
+
+DEQUE_PROTO(int)
+DEQUE_PROTO(float)
+DEQUE_PROTO(char)
+DEQUE_PROTO(double)
+
+// Macro aliases for function calls
+#define initDEQUE(dq, type) initDEQUE__##type(dq)
+#define pushFrontDEQUE(dq, data, type) pushFrontDEQUE__##type(dq, data)
+#define pushBackDEQUE(dq, data, type) pushBackDEQUE__##type(dq, data)
+#define popFrontDEQUE(dq, out, type) popFrontDEQUE__##type(dq, out)
+#define popBackDEQUE(dq, out, type) popBackDEQUE__##type(dq, out)
+#define frontDEQUE(dq, data404Response, type) frontDEQUE__##type(dq, data404Response)
+#define backDEQUE(dq, data404Response, type) backDEQUE__##type(dq, data404Response)
+#define getDataAtDEQUE(dq, targetIdx, data404Response, type) getDataAtDEQUE__##type(dq, targetIdx, data404Response)
+#define updateAtDEQUE(dq, targetIdx, newData, type) updateAtDEQUE__##type(dq, targetIdx, newData)
+#define sizeDEQUE(dq, type) sizeDEQUE__##type(dq)
+#define forEachDEQUE(dq, visit, ctx, type) forEachDEQUE__##type(dq, visit, ctx)
+#define clearDEQUE(dq, type) clearDEQUE__##type(dq)
+#define freeDEQUE(dq, type) freeDEQUE__##type(dq)
+
+
+#endif /* DEQUE_H */
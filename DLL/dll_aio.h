@@ -0,0 +1,71 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_aio.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for asynchronous (io_uring or thread backed) doubly linked list save and
+ *          load.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef DLL_AIO_H
+#define DLL_AIO_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/types.h>
+#include "dll_io.h"
+
+/**
+ * @brief State of one asynchronous save or load.
+ *
+ * The operation runs on its own worker thread. Completion is reported three ways: the optional
+ * `done(ok, ctx)` callback (called on the worker thread), the read end of `notify` becoming
+ * readable (for poll / epoll loops), and waitAsyncDLL(), which must be called exactly once to
+ * release the operation.
+ */
+typedef struct {
+    pthread_t thread;
+    int notify[2];
+    int fd;
+    off_t offset;
+    void* list;
+    void (*done)(int ok, void* ctx);
+    void* ctx;
+    _Atomic int finished;
+    int result;
+} DLLAsyncIO;
+
+int pollFdAsyncDLL(const DLLAsyncIO* op);
+int isDoneAsyncDLL(DLLAsyncIO* op);
+int waitAsyncDLL(DLLAsyncIO* op);
+
+/**
+ * @brief Macro to declare function prototypes for asynchronous doubly linked list save / load.
+ *
+ * Files use the binary format of dll_io.h, so saveAsyncDLL() output can be read by loadDLL()
+ * and vice versa. I/O starts at the current offset of `fd`, which must be seekable; on success
+ * the offset is left just past the payload.
+ *
+ * The list belongs to the operation until it completes: it must not be modified (save) or
+ * touched at all (load) before waitAsyncDLL() returns.
+ *
+ * Built with `-DDLL_AIO_URING` (and `-luring`), the staging buffers are written and read through
+ * io_uring. Otherwise a helper thread performs the pread() / pwrite() calls.
+ *
+ * @param type The data type for the doubly linked list.
+ */
+#define DLL_AIO_PROTO(type) \
+    int saveAsyncDLL__##type(DLLAsyncIO* op, DLL__##type* dll, int fd, void (*done)(int ok, void* ctx), void* ctx); \
+    int loadAsyncDLL__##type(DLLAsyncIO* op, DLL__##type* dll, int fd, void (*done)(int ok, void* ctx), void* ctx); \
+
+DLL_AIO_PROTO(int)
+DLL_AIO_PROTO(float)
+DLL_AIO_PROTO(char)
+DLL_AIO_PROTO(double)
+
+// Macro aliases for function calls
+#define saveAsyncDLL(op, dll, fd, done, ctx, type) saveAsyncDLL__##type(op, dll, fd, done, ctx)
+#define loadAsyncDLL(op, dll, fd, done, ctx, type) loadAsyncDLL__##type(op, dll, fd, done, ctx)
+
+
+#endif /* DLL_AIO_H */
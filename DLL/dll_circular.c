@@ -0,0 +1,359 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_circular.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the dll_circular.h header file containing the circular doubly
+ *          linked list.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "dll_circular.h"
+
+// -------------------------------------------------------------------------------------------->
+// CIRCULAR DLL HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Generates the static helpers for one element type.
+ *
+ * - link: links `node` in between `tail` and `head`; the caller decides which end moves.
+ * - unlink: unlinks `node` from a list of two or more elements, moving `head` / `tail` off it,
+ *   and frees it.
+ * - nodeAt: returns the node at position `idx` from the head, which must be in range, walking
+ *   from whichever end is nearer.
+ */
+#define CIRCULAR_DLL_HELPERS(type) \
+    static void linkCircularDLL__##type(CircularDLL__##type* cdll, struct DLLNode__##type* node) { \
+        if (cdll->size == 0) { \
+            node->next = node; \
+            node->prev = node; \
+            cdll->head = node; \
+            cdll->tail = node; \
+        } else { \
+            node->next = cdll->head; \
+            node->prev = cdll->tail; \
+            cdll->tail->next = node; \
+            cdll->head->prev = node; \
+        } \
+        \
+        cdll->size++; \
+    } \
+    \
+    static void unlinkCircularDLL__##type(CircularDLL__##type* cdll, struct DLLNode__##type* node) { \
+        node->prev->next = node->next; \
+        node->next->prev = node->prev; \
+        \
+        if (node == cdll->head) { \
+            cdll->head = node->next; \
+        } \
+        \
+        if (node == cdll->tail) { \
+            cdll->tail = node->prev; \
+        } \
+        \
+        cdll->size--; \
+        free(node); \
+    } \
+    \
+    static struct DLLNode__##type* nodeAtCircularDLL__##type(CircularDLL__##type* cdll, int idx) { \
+        struct DLLNode__##type* node; \
+        \
+        if (idx <= cdll->size - 1 - idx) { \
+            for (node = cdll->head; idx > 0; idx--) { \
+                node = node->next; \
+            } \
+        } else { \
+            for (node = cdll->tail, idx = cdll->size - 1 - idx; idx > 0; idx--) { \
+                node = node->prev; \
+            } \
+        } \
+        \
+        return node; \
+    } \
+
+CIRCULAR_DLL_HELPERS(int)
+CIRCULAR_DLL_HELPERS(float)
+CIRCULAR_DLL_HELPERS(char)
+CIRCULAR_DLL_HELPERS(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE CIRCULAR DLL :        EMPTY / ADOPT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief initCircularDLL() makes an empty list. adoptCircularDLL() takes over the nodes of
+ *        `dll` in O(1) by closing its tail onto its head, and leaves `dll` empty.
+ *
+ * @param cdll Pointer to the circular list.
+ * @param dll Pointer to the list whose nodes are taken over.
+ */
+#define CIRCULAR_DLL_INIT(type) \
+    void initCircularDLL__##type(CircularDLL__##type* cdll) { \
+        cdll->head = NULL; \
+        cdll->tail = NULL; \
+        cdll->size = 0; \
+    } \
+    \
+    void adoptCircularDLL__##type(CircularDLL__##type* cdll, DLL__##type* dll) { \
+        cdll->head = dll->head; \
+        cdll->tail = dll->tail; \
+        cdll->size = dll->size; \
+        \
+        if (cdll->tail != NULL) { \
+            cdll->tail->next = cdll->head; \
+            cdll->head->prev = cdll->tail; \
+        } \
+        \
+        dll->head = NULL; \
+        dll->tail = NULL; \
+        dll->size = 0; \
+    } \
+
+CIRCULAR_DLL_INIT(int)
+CIRCULAR_DLL_INIT(float)
+CIRCULAR_DLL_INIT(char)
+CIRCULAR_DLL_INIT(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INSERT DATA TO CIRCULAR DLL :    HEAD / TAIL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Inserts a new element before the head or after the tail. Both link the node between
+ *        `tail` and `head`; they differ only in which of the two then points at it.
+ *
+ * @param cdll Pointer to the circular list.
+ * @param data The data to insert.
+ * @return 1 on success, 0 if the node could not be allocated.
+ */
+#define CIRCULAR_DLL_INSERT(type) \
+    int insertAtHeadCircularDLL__##type(CircularDLL__##type* cdll, type data) { \
+        struct DLLNode__##type* node = (struct DLLNode__##type*) malloc(sizeof(struct DLLNode__##type)); \
+        \
+        if (node == NULL) { \
+            return 0; \
+        } \
+        \
+        node->data = data; \
+        linkCircularDLL__##type(cdll, node); \
+        cdll->head = node; \
+        return 1; \
+    } \
+    \
+    int insertAtTailCircularDLL__##type(CircularDLL__##type* cdll, type data) { \
+        struct DLLNode__##type* node = (struct DLLNode__##type*) malloc(sizeof(struct DLLNode__##type)); \
+        \
+        if (node == NULL) { \
+            return 0; \
+        } \
+        \
+        node->data = data; \
+        linkCircularDLL__##type(cdll, node); \
+        cdll->tail = node; \
+        return 1; \
+    } \
+
+CIRCULAR_DLL_INSERT(int)
+CIRCULAR_DLL_INSERT(float)
+CIRCULAR_DLL_INSERT(char)
+CIRCULAR_DLL_INSERT(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DELETE DATA OF CIRCULAR DLL :    HEAD / TAIL / VALUE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief popHeadCircularDLL() / popTailCircularDLL() remove the head / tail and store its
+ *        data in `out` (which may be NULL), returning 0 if the list is empty;
+ *        deleteHeadCircularDLL() / deleteTailCircularDLL() do the same without reporting.
+ *        deleteCircularDLL() removes the first element equal to `targetData`, searching one
+ *        lap from the head, and returns 1 if it found one.
+ *
+ * @param cdll Pointer to the circular list.
+ */
+#define CIRCULAR_DLL_DELETE(type) \
+    static int popCircularDLL__##type(CircularDLL__##type* cdll, struct DLLNode__##type* node, type* out) { \
+        if (node == NULL) { \
+            return 0; \
+        } \
+        \
+        if (out != NULL) { \
+            *out = node->data; \
+        } \
+        \
+        if (cdll->size == 1) { \
+            cdll->head = NULL; \
+            cdll->tail = NULL; \
+            cdll->size = 0; \
+            free(node); \
+        } else { \
+            unlinkCircularDLL__##type(cdll, node); \
+        } \
+        \
+        return 1; \
+    } \
+    \
+    int popHeadCircularDLL__##type(CircularDLL__##type* cdll, type* out) { \
+        return popCircularDLL__##type(cdll, cdll->head, out); \
+    } \
+    \
+    int popTailCircularDLL__##type(CircularDLL__##type* cdll, type* out) { \
+        return popCircularDLL__##type(cdll, cdll->tail, out); \
+    } \
+    \
+    void deleteHeadCircularDLL__##type(CircularDLL__##type* cdll) { \
+        popCircularDLL__##type(cdll, cdll->head, NULL); \
+    } \
+    \
+    void deleteTailCircularDLL__##type(CircularDLL__##type* cdll) { \
+        popCircularDLL__##type(cdll, cdll->tail, NULL); \
+    } \
+    \
+    int deleteCircularDLL__##type(CircularDLL__##type* cdll, type targetData) { \
+        struct DLLNode__##type* node = cdll->head; \
+        int i; \
+        \
+        for (i = 0; i < cdll->size; i++) { \
+            if (node->data == targetData) { \
+                return popCircularDLL__##type(cdll, node, NULL); \
+            } \
+            \
+            node = node->next; \
+        } \
+        \
+        return 0; \
+    } \
+
+CIRCULAR_DLL_DELETE(int)
+CIRCULAR_DLL_DELETE(float)
+CIRCULAR_DLL_DELETE(char)
+CIRCULAR_DLL_DELETE(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO ROTATE CIRCULAR DLL :            BY K / ONE ROUND-ROBIN TICK
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief rotateCircularDLL() makes the element at position k mod n the new head, by moving
+ *        `head` forward k mod n nodes or backward n - k mod n nodes, whichever is fewer; a
+ *        negative k rotates backwards. No node is allocated, freed or relinked.
+ *        nextCircularDLL() returns the head's data (or `data404Response` if the list is
+ *        empty) and then rotates by one.
+ *
+ * @param cdll Pointer to the circular list.
+ * @param k Number of positions to rotate forward.
+ */
+#define CIRCULAR_DLL_ROTATE(type) \
+    void rotateCircularDLL__##type(CircularDLL__##type* cdll, int k) { \
+        if (cdll->size == 0) { \
+            return; \
+        } \
+        \
+        k %= cdll->size; \
+        \
+        if (k < 0) { \
+            k += cdll->size; \
+        } \
+        \
+        if (k <= cdll->size - k) { \
+            while (k-- > 0) { \
+                cdll->head = cdll->head->next; \
+            } \
+        } else { \
+            for (k = cdll->size - k; k > 0; k--) { \
+                cdll->head = cdll->head->prev; \
+            } \
+        } \
+        \
+        cdll->tail = cdll->head->prev; \
+    } \
+    \
+    type nextCircularDLL__##type(CircularDLL__##type* cdll, type data404Response) { \
+        type data; \
+        \
+        if (cdll->size == 0) { \
+            return data404Response; \
+        } \
+        \
+        data = cdll->head->data; \
+        cdll->tail = cdll->head; \
+        cdll->head = cdll->head->next; \
+        return data; \
+    } \
+
+CIRCULAR_DLL_ROTATE(int)
+CIRCULAR_DLL_ROTATE(float)
+CIRCULAR_DLL_ROTATE(char)
+CIRCULAR_DLL_ROTATE(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO GET / UPDATE / VISIT DATA OF CIRCULAR DLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Positional access counts from the current head. getDataAtCircularDLL() returns
+ *        `data404Response` and updateAtCircularDLL() does nothing for an index outside
+ *        [0, size). forEachCircularDLL() calls `visit(data, ctx)` once per element, starting
+ *        at the head and stopping after one lap.
+ *
+ * @param cdll Pointer to the circular list.
+ */
+#define CIRCULAR_DLL_ACCESS(type) \
+    type getDataAtCircularDLL__##type(CircularDLL__##type* cdll, int targetIdx, type data404Response) { \
+        if (targetIdx < 0 || targetIdx >= cdll->size) { \
+            return data404Response; \
+        } \
+        \
+        return nodeAtCircularDLL__##type(cdll, targetIdx)->data; \
+    } \
+    \
+    void updateAtCircularDLL__##type(CircularDLL__##type* cdll, int targetIdx, type newData) { \
+        if (targetIdx < 0 || targetIdx >= cdll->size) { \
+            return; \
+        } \
+        \
+        nodeAtCircularDLL__##type(cdll, targetIdx)->data = newData; \
+    } \
+    \
+    int sizeCircularDLL__##type(CircularDLL__##type* cdll) { \
+        return cdll->size; \
+    } \
+    \
+    void forEachCircularDLL__##type(CircularDLL__##type* cdll, \
+                                    void (*visit)(type data, void* ctx), void* ctx) { \
+        struct DLLNode__##type* node = cdll->head; \
+        int i; \
+        \
+        for (i = 0; i < cdll->size; i++) { \
+            visit(node->data, ctx); \
+            node = node->next; \
+        } \
+    } \
+
+CIRCULAR_DLL_ACCESS(int)
+CIRCULAR_DLL_ACCESS(float)
+CIRCULAR_DLL_ACCESS(char)
+CIRCULAR_DLL_ACCESS(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FREE CIRCULAR DLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Frees every node and leaves the list empty.
+ *
+ * @param cdll Pointer to the circular list.
+ */
+#define CIRCULAR_DLL_FREE(type) \
+    void freeCircularDLL__##type(CircularDLL__##type* cdll) { \
+        struct DLLNode__##type* node = cdll->head; \
+        struct DLLNode__##type* next; \
+        \
+        while (cdll->size-- > 0) { \
+            next = node->next; \
+            free(node); \
+            node = next; \
+        } \
+        \
+        cdll->head = NULL; \
+        cdll->tail = NULL; \
+        cdll->size = 0; \
+    } \
+
+CIRCULAR_DLL_FREE(int)
+CIRCULAR_DLL_FREE(float)
+CIRCULAR_DLL_FREE(char)
+CIRCULAR_DLL_FREE(double)
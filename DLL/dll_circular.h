@@ -0,0 +1,91 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_circular.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the circular doubly linked list with allocation-free rotation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef DLL_CIRCULAR_H
+#define DLL_CIRCULAR_H
+
+#include "dll.h"
+
+/**
+ * @brief Macro to declare a circular doubly linked list for a specific data type.
+ *
+ * Uses the DLLNode__type nodes of dll.h, but the ends link to each other: `tail->next == head`
+ * and `head->prev == tail` whenever the list is not empty. It has its own struct rather than an
+ * DLL__type so that it cannot be passed to dll.h functions, which would never reach a NULL.
+ *
+ * @param type The data type for the list.
+ */
+#define DECLARE_CIRCULAR_DLL(type) \
+    typedef struct { \
+        struct DLLNode__##type* head; \
+        struct DLLNode__##type* tail; \
+        int size; \
+    } CircularDLL__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for circular doubly linked list operations.
+ *
+ * Rotation only moves `head` and `tail` and never allocates: rotating by k walks whichever
+ * way round is shorter, O(min(k, n - k)), and a negative k rotates backwards.
+ * nextCircularDLL() returns the head and rotates by one, which is a complete round-robin tick.
+ * Both ends are O(1) to insert and delete, and iteration stops after one lap.
+ *
+ * @param type The data type for the list.
+ */
+#define CIRCULAR_DLL_PROTO(type) \
+    void initCircularDLL__##type(CircularDLL__##type* cdll); \
+    void adoptCircularDLL__##type(CircularDLL__##type* cdll, DLL__##type* dll); \
+    int insertAtHeadCircularDLL__##type(CircularDLL__##type* cdll, type data); \
+    int insertAtTailCircularDLL__##type(CircularDLL__##type* cdll, type data); \
+    int popHeadCircularDLL__##type(CircularDLL__##type* cdll, type* out); \
+    int popTailCircularDLL__##type(CircularDLL__##type* cdll, type* out); \
+    void deleteHeadCircularDLL__##type(CircularDLL__##type* cdll); \
+    void deleteTailCircularDLL__##type(CircularDLL__##type* cdll); \
+    int deleteCircularDLL__##type(CircularDLL__##type* cdll, type targetData); \
+    void rotateCircularDLL__##type(CircularDLL__##type* cdll, int k); \
+    type nextCircularDLL__##type(CircularDLL__##type* cdll, type data404Response); \
+    type getDataAtCircularDLL__##type(CircularDLL__##type* cdll, int targetIdx, type data404Response); \
+    void updateAtCircularDLL__##type(CircularDLL__##type* cdll, int targetIdx, type newData); \
+    int sizeCircularDLL__##type(CircularDLL__##type* cdll); \
+    void forEachCircularDLL__##type(CircularDLL__##type* cdll, void (*visit)(type data, void* ctx), void* ctx); \
+    void freeCircularDLL__##type(CircularDLL__##type* cdll); \
+
+// Declaration for int data type
+DECLARE_CIRCULAR_DLL(int);
+// Declaration for float data type
+DECLARE_CIRCULAR_DLL(float);
+// Declaration for char data type
+DECLARE_CIRCULAR_DLL(char);
+// Declaration for double data type
+DECLARE_CIRCULAR_DLL(double);
+
+CIRCULAR_DLL_PROTO(int)
+CIRCULAR_DLL_PROTO(float)
+CIRCULAR_DLL_PROTO(char)
+CIRCULAR_DLL_PROTO(double)
+
+// Macro aliases for function calls
+#define initCircularDLL(cdll, type) initCircularDLL__##type(cdll)
+#define adoptCircularDLL(cdll, dll, type) adoptCircularDLL__##type(cdll, dll)
+#define insertAtHeadCircularDLL(cdll, data, type) insertAtHeadCircularDLL__##type(cdll, data)
+#define insertAtTailCircularDLL(cdll, data, type) insertAtTailCircularDLL__##type(cdll, data)
+#define popHeadCircularDLL(cdll, out, type) popHeadCircularDLL__##type(cdll, out)
+#define popTailCircularDLL(cdll, out, type) popTailCircularDLL__##type(cdll, out)
+#define deleteHeadCircularDLL(cdll, type) deleteHeadCircularDLL__##type(cdll)
+#define deleteTailCircularDLL(cdll, type) deleteTailCircularDLL__##type(cdll)
+#define deleteCircularDLL(cdll, targetData, type) deleteCircularDLL__##type(cdll, targetData)
+#define rotateCircularDLL(cdll, k, type) rotateCircularDLL__##type(cdll, k)
+#define nextCircularDLL(cdll, data404Response, type) nextCircularDLL__##type(cdll, data404Response)
+#define getDataAtCircularDLL(cdll, targetIdx, data404Response, type) getDataAtCircularDLL__##type(cdll, targetIdx, data404Response)
+#define updateAtCircularDLL(cdll, targetIdx, newData, type) updateAtCircularDLL__##type(cdll, targetIdx, newData)
+#define sizeCircularDLL(cdll, type) sizeCircularDLL__##type(cdll)
+#define forEachCircularDLL(cdll, visit, ctx, type) forEachCircularDLL__##type(cdll, visit, ctx)
+#define freeCircularDLL(cdll, type) freeCircularDLL__##type(cdll)
+
+
+#endif /* DLL_CIRCULAR_H */
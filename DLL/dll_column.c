@@ -0,0 +1,90 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_column.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the dll_column.h header file containing the columnar export / import
+ *          of doubly linked lists.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include <limits.h>
+#include "dll_column.h"
+#include "dll_view.h"
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO EXPORT DLL :                     COLUMNAR FILE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Writes the list to `path` as a single column.
+ *
+ * The nodes are walked once straight into the writer's chunk buffer, so no array of the whole
+ * list is built and no text is formatted on the way.
+ *
+ * @param dll Pointer to the doubly linked list structure.
+ * @param path Output file.
+ * @param chunkElems Elements per chunk; 0 or less selects COLUMN_CHUNK_ELEMS.
+ * @param withStats Non-zero to store the min and max of every chunk.
+ *
+ * @return 1 on success, 0 on an I/O or allocation error.
+ */
+#define DLL_EXPORT_COLUMN(type) \
+    int exportColumnDLL__##type(DLL__##type* dll, const char* path, int chunkElems, int withStats) { \
+        ColumnWriter__##type w; \
+        struct DLLNode__##type* node; \
+        \
+        if (!openColumnWriter__##type(&w, path, chunkElems, withStats)) { \
+            return 0; \
+        } \
+        \
+        for (node = dll->head; node != NULL && !w.error; node = node->next) { \
+            appendColumn__##type(&w, node->data); \
+        } \
+        \
+        return closeColumnWriter__##type(&w); \
+    } \
+
+DLL_EXPORT_COLUMN(int)
+DLL_EXPORT_COLUMN(float)
+DLL_EXPORT_COLUMN(char)
+DLL_EXPORT_COLUMN(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO IMPORT DLL :                     COLUMNAR FILE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Appends every value of the column in `path` to `dll`.
+ *
+ * The file is mapped and materialised through a read-only view, so it is read exactly once and
+ * a failure leaves `dll` unchanged.
+ *
+ * @param dll Pointer to the doubly linked list structure (may already hold data).
+ * @param path Column file written by exportColumnDLL() or a ColumnWriter.
+ *
+ * @return 1 on success, 0 if the file is not a valid column of this type, is too long for a
+ *         list, or memory ran out.
+ */
+#define DLL_IMPORT_COLUMN(type) \
+    int importColumnDLL__##type(DLL__##type* dll, const char* path) { \
+        ColumnReader__##type r; \
+        DLLView__##type view; \
+        int ok; \
+        \
+        if (!openColumnReader__##type(&r, path)) { \
+            return 0; \
+        } \
+        \
+        ok = r.count <= (uint64_t) (INT_MAX - dll->size); \
+        \
+        if (ok) { \
+            initDLLView__##type(&view, r.data, (int) r.count); \
+            ok = materializeDLLView__##type(&view, dll); \
+        } \
+        \
+        closeColumnReader__##type(&r); \
+        \
+        return ok; \
+    } \
+
+DLL_IMPORT_COLUMN(int)
+DLL_IMPORT_COLUMN(float)
+DLL_IMPORT_COLUMN(char)
+DLL_IMPORT_COLUMN(double)
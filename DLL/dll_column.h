@@ -0,0 +1,38 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_column.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for exporting doubly linked lists to columnar files and importing them
+ *          back.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef DLL_COLUMN_H
+#define DLL_COLUMN_H
+
+#include "dll.h"
+#include "../COLUMN/column.h"
+
+/**
+ * @brief Macro to declare function prototypes for columnar export / import of a list.
+ *
+ * The file format is the one described in column.h, so the exported file can be mapped with
+ * openColumnReader() and scanned chunk by chunk.
+ *
+ * @param type The data type for the list.
+ */
+#define DLL_COLUMN_PROTO(type) \
+    int exportColumnDLL__##type(DLL__##type* dll, const char* path, int chunkElems, int withStats); \
+    int importColumnDLL__##type(DLL__##type* dll, const char* path); \
+
+DLL_COLUMN_PROTO(int)
+DLL_COLUMN_PROTO(float)
+DLL_COLUMN_PROTO(char)
+DLL_COLUMN_PROTO(double)
+
+// Macro aliases for function calls
+#define exportColumnDLL(dll, path, chunkElems, withStats, type) exportColumnDLL__##type(dll, path, chunkElems, withStats)
+#define importColumnDLL(dll, path, type) importColumnDLL__##type(dll, path)
+
+
+#endif /* DLL_COLUMN_H */
@@ -0,0 +1,44 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_heap.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the dll_heap.h header file containing the list to heap bulk build.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "dll_heap.h"
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO BUILD HEAP FROM DLL :            O(n)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Adds every element of `dll` to the heap `h` and restores the heap order bottom-up.
+ *
+ * The heap array is grown once, the nodes are copied straight into it in one walk, and
+ * rebuildHEAP() then orders the whole array in O(n), instead of one O(log n) push per element.
+ * The list is left unchanged.
+ *
+ * @param h Pointer to the heap.
+ * @param dll Pointer to the list.
+ * @return 1 on success, 0 if the heap could not grow (the heap is unchanged).
+ */
+#define DLL_HEAPIFY(type) \
+    int heapifyFromDLL__##type(HEAP__##type* h, DLL__##type* dll) { \
+        struct DLLNode__##type* node; \
+        \
+        if (!reserveHEAP__##type(h, h->size + dll->size)) { \
+            return 0; \
+        } \
+        \
+        for (node = dll->head; node != NULL; node = node->next) { \
+            h->data[h->size++] = node->data; \
+        } \
+        \
+        rebuildHEAP__##type(h); \
+        return 1; \
+    } \
+
+DLL_HEAPIFY(int)
+DLL_HEAPIFY(float)
+DLL_HEAPIFY(char)
+DLL_HEAPIFY(double)
@@ -0,0 +1,34 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_heap.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for building heaps from doubly linked lists.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef DLL_HEAP_H
+#define DLL_HEAP_H
+
+#include "dll.h"
+#include "../HEAP/heap.h"
+
+/**
+ * @brief Macro to declare function prototypes for building a heap from a list.
+ *
+ * The heap types and operations are the ones described in heap.h.
+ *
+ * @param type The data type for the list.
+ */
+#define DLL_HEAP_PROTO(type) \
+    int heapifyFromDLL__##type(HEAP__##type* h, DLL__##type* dll); \
+
+DLL_HEAP_PROTO(int)
+DLL_HEAP_PROTO(float)
+DLL_HEAP_PROTO(char)
+DLL_HEAP_PROTO(double)
+
+// Macro aliases for function calls
+#define heapifyFromDLL(h, dll, type) heapifyFromDLL__##type(h, dll)
+
+
+#endif /* DLL_HEAP_H */
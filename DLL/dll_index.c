@@ -0,0 +1,576 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_index.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the dll_index.h header file containing the skip-list index over a
+ *          doubly linked list.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "dll_index.h"
+
+// -------------------------------------------------------------------------------------------->
+// INDEX HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Draws the number of lanes for a new node: k lanes with probability (1/4)^k * 3/4.
+ *
+ * Uses two bits of one xorshift32 draw per level, which covers all DLL_INDEX_MAX_LEVEL levels.
+ */
+static int randomHeightIndexedDLL(uint32_t* seed) {
+    uint32_t r = *seed;
+    int height = 0;
+
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    *seed = r;
+
+    while (height < DLL_INDEX_MAX_LEVEL && (r & 3) == 0) {
+        height++;
+        r >>= 2;
+    }
+
+    return height;
+}
+
+/**
+ * @brief Generates the static lane helpers for one element type.
+ *
+ * - search: for every lane, stores in `update` the last lane node at a position up to `target`
+ *   (-1 selects the sentinels) and its position in `rank`. O(log n) expected.
+ * - walk: steps along the list from the node of `lane` (at position `pos`) to position
+ *   `target`; the sentinel stands for position -1, so walking to -1 returns NULL. The lanes
+ *   leave an expected 3 steps.
+ * - bound: the value-ordered counterpart of search + walk for a sorted list. Returns the
+ *   position of the first element not less than `value` (greater than, if `upper`), fills
+ *   `update` / `rank` for the position before it and stores the node there in `pred`.
+ * - link: links `node` in at position `idx`, after `pred`, and gives it a random number of
+ *   lanes; `update` / `rank` must describe position `idx - 1`. A lane node that cannot be
+ *   allocated just leaves the node with fewer lanes.
+ * - unlinkRange: unlinks and frees the `count` elements starting at position `idx`, after
+ *   `pred`, together with their lane nodes, in O(log n + count).
+ */
+#define INDEXED_DLL_HELPERS(type) \
+    static void searchIndexedDLL__##type(IndexedDLL__##type* idll, int target, struct DLLLane__##type** update, int* rank) { \
+        struct DLLLane__##type* lane; \
+        int pos = -1, l; \
+        \
+        if (idll->levels == 0) { \
+            return; \
+        } \
+        \
+        lane = &idll->heads[idll->levels - 1]; \
+        \
+        for (l = idll->levels - 1; l >= 0; l--) { \
+            while (lane->next != NULL && pos + lane->span <= target) { \
+                pos += lane->span; \
+                lane = lane->next; \
+            } \
+            \
+            update[l] = lane; \
+            rank[l] = pos; \
+            lane = lane->down; \
+        } \
+    } \
+    \
+    static struct DLLNode__##type* walkIndexedDLL__##type(IndexedDLL__##type* idll, struct DLLLane__##type* lane, int pos, int target) { \
+        struct DLLNode__##type* node = lane != NULL ? lane->node : NULL; \
+        \
+        if (node == NULL) { \
+            if (target < 0) { \
+                return NULL; \
+            } \
+            node = idll->list.head; \
+            pos = 0; \
+        } \
+        \
+        while (pos < target) { \
+            node = node->next; \
+            pos++; \
+        } \
+        \
+        return node; \
+    } \
+    \
+    static int boundIndexedDLL__##type(IndexedDLL__##type* idll, type value, int upper, struct DLLLane__##type** update, int* rank, struct DLLNode__##type** pred) { \
+        struct DLLLane__##type* lane = idll->levels > 0 ? &idll->heads[idll->levels - 1] : NULL; \
+        struct DLLNode__##type* node; \
+        struct DLLNode__##type* next; \
+        int pos = -1, l; \
+        \
+        for (l = idll->levels - 1; l >= 0; l--) { \
+            while (lane->next != NULL && (upper ? lane->next->key <= value : lane->next->key < value)) { \
+                pos += lane->span; \
+                lane = lane->next; \
+            } \
+            \
+            update[l] = lane; \
+            rank[l] = pos; \
+            lane = lane->down; \
+        } \
+        \
+        node = idll->levels > 0 ? update[0]->node : NULL; \
+        next = node != NULL ? node->next : idll->list.head; \
+        \
+        while (next != NULL && (upper ? next->data <= value : next->data < value)) { \
+            node = next; \
+            next = next->next; \
+            pos++; \
+        } \
+        \
+        *pred = node; \
+        \
+        return pos + 1; \
+    } \
+    \
+    static void linkIndexedDLL__##type(IndexedDLL__##type* idll, struct DLLNode__##type* node, int idx, struct DLLLane__##type** update, int* rank, struct DLLNode__##type* pred) { \
+        struct DLLLane__##type* below = NULL; \
+        struct DLLLane__##type* lane; \
+        int height = randomHeightIndexedDLL(&idll->seed), l; \
+        \
+        for (l = idll->levels; l < height; l++) { \
+            idll->heads[l].next = NULL; \
+            idll->heads[l].span = idll->list.size + 1; \
+            update[l] = &idll->heads[l]; \
+            rank[l] = -1; \
+        } \
+        \
+        idll->levels = height > idll->levels ? height : idll->levels; \
+        \
+        for (l = 0; l < idll->levels; l++) { \
+            lane = l < height ? (struct DLLLane__##type*) malloc(sizeof(struct DLLLane__##type)) : NULL; \
+            \
+            if (lane == NULL) { \
+                height = l; \
+                update[l]->span++; \
+                continue; \
+            } \
+            \
+            lane->node = node; \
+            lane->key = node->data; \
+            lane->down = below; \
+            lane->next = update[l]->next; \
+            lane->span = rank[l] + update[l]->span + 1 - idx; \
+            update[l]->next = lane; \
+            update[l]->span = idx - rank[l]; \
+            below = lane; \
+        } \
+        \
+        node->prev = pred; \
+        node->next = pred != NULL ? pred->next : idll->list.head; \
+        \
+        if (pred != NULL) { \
+            pred->next = node; \
+        } else { \
+            idll->list.head = node; \
+        } \
+        \
+        if (node->next != NULL) { \
+            node->next->prev = node; \
+        } else { \
+            idll->list.tail = node; \
+        } \
+        \
+        idll->list.size++; \
+        \
+        while (idll->levels > 0 && idll->heads[idll->levels - 1].next == NULL) { \
+            idll->levels--; \
+        } \
+    } \
+    \
+    static void unlinkRangeIndexedDLL__##type(IndexedDLL__##type* idll, int idx, int count, struct DLLLane__##type** update, int* rank, struct DLLNode__##type* pred) { \
+        struct DLLLane__##type* lane; \
+        struct DLLNode__##type* node; \
+        struct DLLNode__##type* next; \
+        int l, i; \
+        \
+        for (l = 0; l < idll->levels; l++) { \
+            while ((lane = update[l]->next) != NULL && rank[l] + update[l]->span < idx + count) { \
+                update[l]->span += lane->span; \
+                update[l]->next = lane->next; \
+                free(lane); \
+            } \
+            \
+            update[l]->span -= count; \
+        } \
+        \
+        node = pred != NULL ? pred->next : idll->list.head; \
+        \
+        for (i = 0; i < count; i++) { \
+            next = node->next; \
+            free(node); \
+            node = next; \
+        } \
+        \
+        if (pred != NULL) { \
+            pred->next = node; \
+        } else { \
+            idll->list.head = node; \
+        } \
+        \
+        if (node != NULL) { \
+            node->prev = pred; \
+        } else { \
+            idll->list.tail = pred; \
+        } \
+        \
+        idll->list.size -= count; \
+        \
+        while (idll->levels > 0 && idll->heads[idll->levels - 1].next == NULL) { \
+            idll->levels--; \
+        } \
+    } \
+
+INDEXED_DLL_HELPERS(int)
+INDEXED_DLL_HELPERS(float)
+INDEXED_DLL_HELPERS(char)
+INDEXED_DLL_HELPERS(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE INDEXED DLL :         EMPTY / ADOPT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief initIndexedDLL() makes an empty indexed list; adoptIndexedDLL() takes over the nodes of
+ *        an existing list and builds its lanes.
+ *
+ * Adopting moves the nodes without copying them and builds every lane in one O(n) pass, which
+ * is much faster than inserting the elements one by one. Whatever `idll` held before is freed,
+ * and `dll` is left empty. If a lane node cannot be allocated, that node simply gets fewer
+ * lanes: the index stays correct, only a little slower.
+ *
+ * @param idll Pointer to the indexed list.
+ * @param dll Pointer to the list whose nodes are taken over.
+ */
+#define INDEXED_DLL_INIT(type) \
+    void initIndexedDLL__##type(IndexedDLL__##type* idll) { \
+        int l; \
+        \
+        idll->list.head = NULL; \
+        idll->list.tail = NULL; \
+        idll->list.size = 0; \
+        idll->levels = 0; \
+        idll->seed = 0x9e3779b9u; \
+        \
+        for (l = 0; l < DLL_INDEX_MAX_LEVEL; l++) { \
+            idll->heads[l].next = NULL; \
+            idll->heads[l].down = l > 0 ? &idll->heads[l - 1] : NULL; \
+            idll->heads[l].node = NULL; \
+            idll->heads[l].span = 1; \
+        } \
+    } \
+    \
+    void adoptIndexedDLL__##type(IndexedDLL__##type* idll, DLL__##type* dll) { \
+        struct DLLLane__##type* last[DLL_INDEX_MAX_LEVEL]; \
+        struct DLLLane__##type* lane; \
+        struct DLLNode__##type* node; \
+        int lastPos[DLL_INDEX_MAX_LEVEL]; \
+        int pos = 0, height, l; \
+        \
+        freeIndexedDLL__##type(idll); \
+        idll->list = *dll; \
+        dll->head = NULL; \
+        dll->tail = NULL; \
+        dll->size = 0; \
+        \
+        for (l = 0; l < DLL_INDEX_MAX_LEVEL; l++) { \
+            last[l] = &idll->heads[l]; \
+            lastPos[l] = -1; \
+        } \
+        \
+        for (node = idll->list.head; node != NULL; node = node->next, pos++) { \
+            height = randomHeightIndexedDLL(&idll->seed); \
+            \
+            for (l = 0; l < height; l++) { \
+                lane = (struct DLLLane__##type*) malloc(sizeof(struct DLLLane__##type)); \
+                \
+                if (lane == NULL) { \
+                    break; \
+                } \
+                \
+                lane->node = node; \
+                lane->key = node->data; \
+                lane->down = l > 0 ? last[l - 1] : NULL; \
+                last[l]->next = lane; \
+                last[l]->span = pos - lastPos[l]; \
+                last[l] = lane; \
+                lastPos[l] = pos; \
+            } \
+            \
+            idll->levels = l > idll->levels ? l : idll->levels; \
+        } \
+        \
+        for (l = 0; l < idll->levels; l++) { \
+            last[l]->next = NULL; \
+            last[l]->span = idll->list.size - lastPos[l]; \
+        } \
+    } \
+
+INDEXED_DLL_INIT(int)
+INDEXED_DLL_INIT(float)
+INDEXED_DLL_INIT(char)
+INDEXED_DLL_INIT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INSERT DATA TO INDEXED DLL :     K'th Index / HEAD / TAIL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Inserts `data` at `targetIdx` in O(log n) expected time.
+ *
+ * As in insertAt(), an index at or below 0 inserts at the head and one at or past the size
+ * inserts at the tail. The new node gets a random number of lanes; every lane it does not reach
+ * only has the span over it incremented.
+ *
+ * @param idll Pointer to the indexed list.
+ * @param data Data to be inserted.
+ * @param targetIdx Index at which the new element should end up.
+ *
+ * @return 1 on success, 0 if the node could not be allocated.
+ */
+#define INDEXED_DLL_INSERT(type) \
+    int insertAtIndexedDLL__##type(IndexedDLL__##type* idll, type data, int targetIdx) { \
+        struct DLLLane__##type* update[DLL_INDEX_MAX_LEVEL]; \
+        struct DLLNode__##type* pred; \
+        struct DLLNode__##type* node; \
+        int rank[DLL_INDEX_MAX_LEVEL]; \
+        int idx; \
+        \
+        idx = targetIdx < 0 ? 0 : (targetIdx > idll->list.size ? idll->list.size : targetIdx); \
+        node = (struct DLLNode__##type*) malloc(sizeof(struct DLLNode__##type)); \
+        \
+        if (node == NULL) { \
+            return 0; \
+        } \
+        \
+        node->data = data; \
+        searchIndexedDLL__##type(idll, idx - 1, update, rank); \
+        pred = walkIndexedDLL__##type(idll, idll->levels > 0 ? update[0] : NULL, idll->levels > 0 ? rank[0] : -1, idx - 1); \
+        linkIndexedDLL__##type(idll, node, idx, update, rank, pred); \
+        \
+        return 1; \
+    } \
+    \
+    int insertAtHeadIndexedDLL__##type(IndexedDLL__##type* idll, type data) { \
+        return insertAtIndexedDLL__##type(idll, data, 0); \
+    } \
+    \
+    int insertAtTailIndexedDLL__##type(IndexedDLL__##type* idll, type data) { \
+        return insertAtIndexedDLL__##type(idll, data, idll->list.size); \
+    } \
+
+INDEXED_DLL_INSERT(int)
+INDEXED_DLL_INSERT(float)
+INDEXED_DLL_INSERT(char)
+INDEXED_DLL_INSERT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DELETE DATA OF INDEXED DLL :     K'th Index / HEAD
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes the element at `targetIdx` in O(log n) expected time. Out-of-range and
+ *        negative indices are ignored, as in deleteAt().
+ *
+ * Lanes that had a node on the removed element lose it and absorb its span; the others have the
+ * span over it decremented. Lanes left empty at the top are dropped.
+ *
+ * @param idll Pointer to the indexed list.
+ * @param targetIdx Index of the element to remove.
+ */
+#define INDEXED_DLL_DELETE(type) \
+    void deleteAtIndexedDLL__##type(IndexedDLL__##type* idll, int targetIdx) { \
+        struct DLLLane__##type* update[DLL_INDEX_MAX_LEVEL]; \
+        struct DLLNode__##type* pred; \
+        int rank[DLL_INDEX_MAX_LEVEL]; \
+        \
+        if (targetIdx < 0 || targetIdx >= idll->list.size) { \
+            return; \
+        } \
+        \
+        searchIndexedDLL__##type(idll, targetIdx - 1, update, rank); \
+        pred = walkIndexedDLL__##type(idll, idll->levels > 0 ? update[0] : NULL, idll->levels > 0 ? rank[0] : -1, targetIdx - 1); \
+        unlinkRangeIndexedDLL__##type(idll, targetIdx, 1, update, rank, pred); \
+    } \
+    \
+    void deleteHeadIndexedDLL__##type(IndexedDLL__##type* idll) { \
+        deleteAtIndexedDLL__##type(idll, 0); \
+    } \
+
+INDEXED_DLL_DELETE(int)
+INDEXED_DLL_DELETE(float)
+INDEXED_DLL_DELETE(char)
+INDEXED_DLL_DELETE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO GET / UPDATE DATA OF INDEXED DLL :   BY INDEX
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Reads or overwrites the element at `targetIdx` in O(log n) expected time.
+ *
+ * As in getDataAt() / updateAt(), negative indices are out of range. An update also refreshes
+ * the key copies in the lane nodes standing on that element.
+ *
+ * @param idll Pointer to the indexed list.
+ * @param targetIdx Index of the element.
+ * @param data404Response Value returned by getDataAtIndexedDLL() when the index is out of
+ *                        range.
+ */
+#define INDEXED_DLL_ACCESS(type) \
+    type getDataAtIndexedDLL__##type(IndexedDLL__##type* idll, int targetIdx, type data404Response) { \
+        struct DLLLane__##type* update[DLL_INDEX_MAX_LEVEL]; \
+        int rank[DLL_INDEX_MAX_LEVEL]; \
+        \
+        if (targetIdx < 0 || targetIdx >= idll->list.size) { \
+            return data404Response; \
+        } \
+        \
+        searchIndexedDLL__##type(idll, targetIdx, update, rank); \
+        \
+        return walkIndexedDLL__##type(idll, idll->levels > 0 ? update[0] : NULL, idll->levels > 0 ? rank[0] : -1, targetIdx)->data; \
+    } \
+    \
+    void updateAtIndexedDLL__##type(IndexedDLL__##type* idll, int targetIdx, type newData) { \
+        struct DLLLane__##type* update[DLL_INDEX_MAX_LEVEL]; \
+        int rank[DLL_INDEX_MAX_LEVEL]; \
+        int l; \
+        \
+        if (targetIdx < 0 || targetIdx >= idll->list.size) { \
+            return; \
+        } \
+        \
+        searchIndexedDLL__##type(idll, targetIdx, update, rank); \
+        walkIndexedDLL__##type(idll, idll->levels > 0 ? update[0] : NULL, idll->levels > 0 ? rank[0] : -1, targetIdx)->data = newData; \
+        \
+        for (l = 0; l < idll->levels && rank[l] == targetIdx; l++) { \
+            update[l]->key = newData; \
+        } \
+    } \
+    \
+    int sizeIndexedDLL__##type(IndexedDLL__##type* idll) { \
+        return idll->list.size; \
+    } \
+
+INDEXED_DLL_ACCESS(int)
+INDEXED_DLL_ACCESS(float)
+INDEXED_DLL_ACCESS(char)
+INDEXED_DLL_ACCESS(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO USE INDEXED DLL AS SORTED LIST : INSERT / BOUNDS / RANGES
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Ordered operations for an indexed list kept in ascending order.
+ *
+ * The lanes are searched by value instead of by position: a lane is followed while the element
+ * under its next node is still smaller than the key, and the spans give the position on the
+ * way. Each call therefore takes O(log n) expected time, plus the number of elements removed
+ * for rangeErase. The list must be sorted, e.g. built only with insertSortedIndexedDLL();
+ * positional inserts and updates that break the order make the results undefined.
+ *
+ * - insertSorted inserts after any elements equal to `data`, so equal elements keep their
+ *   insertion order. Returns 1 on success, 0 if the node could not be allocated.
+ * - lowerBound / upperBound return the index of the first element >= / > `value`, or the size
+ *   if there is none.
+ * - rangeCount returns how many elements lie in [lo, hi]; rangeErase removes them and returns
+ *   how many it removed.
+ *
+ * @param idll Pointer to the sorted indexed list.
+ */
+#define INDEXED_DLL_SORTED(type) \
+    int insertSortedIndexedDLL__##type(IndexedDLL__##type* idll, type data) { \
+        struct DLLLane__##type* update[DLL_INDEX_MAX_LEVEL]; \
+        struct DLLNode__##type* pred; \
+        struct DLLNode__##type* node = (struct DLLNode__##type*) malloc(sizeof(struct DLLNode__##type)); \
+        int rank[DLL_INDEX_MAX_LEVEL]; \
+        int idx; \
+        \
+        if (node == NULL) { \
+            return 0; \
+        } \
+        \
+        node->data = data; \
+        idx = boundIndexedDLL__##type(idll, data, 1, update, rank, &pred); \
+        linkIndexedDLL__##type(idll, node, idx, update, rank, pred); \
+        \
+        return 1; \
+    } \
+    \
+    int lowerBoundIndexedDLL__##type(IndexedDLL__##type* idll, type value) { \
+        struct DLLLane__##type* update[DLL_INDEX_MAX_LEVEL]; \
+        struct DLLNode__##type* pred; \
+        int rank[DLL_INDEX_MAX_LEVEL]; \
+        \
+        return boundIndexedDLL__##type(idll, value, 0, update, rank, &pred); \
+    } \
+    \
+    int upperBoundIndexedDLL__##type(IndexedDLL__##type* idll, type value) { \
+        struct DLLLane__##type* update[DLL_INDEX_MAX_LEVEL]; \
+        struct DLLNode__##type* pred; \
+        int rank[DLL_INDEX_MAX_LEVEL]; \
+        \
+        return boundIndexedDLL__##type(idll, value, 1, update, rank, &pred); \
+    } \
+    \
+    int rangeCountIndexedDLL__##type(IndexedDLL__##type* idll, type lo, type hi) { \
+        int first, last; \
+        \
+        if (hi < lo) { \
+            return 0; \
+        } \
+        \
+        first = lowerBoundIndexedDLL__##type(idll, lo); \
+        last = upperBoundIndexedDLL__##type(idll, hi); \
+        \
+        return last - first; \
+    } \
+    \
+    int rangeEraseIndexedDLL__##type(IndexedDLL__##type* idll, type lo, type hi) { \
+        struct DLLLane__##type* update[DLL_INDEX_MAX_LEVEL]; \
+        struct DLLNode__##type* pred; \
+        int rank[DLL_INDEX_MAX_LEVEL]; \
+        int first, count; \
+        \
+        if (hi < lo) { \
+            return 0; \
+        } \
+        \
+        count = rangeCountIndexedDLL__##type(idll, lo, hi); \
+        \
+        if (count > 0) { \
+            first = boundIndexedDLL__##type(idll, lo, 0, update, rank, &pred); \
+            unlinkRangeIndexedDLL__##type(idll, first, count, update, rank, pred); \
+        } \
+        \
+        return count; \
+    } \
+
+INDEXED_DLL_SORTED(int)
+INDEXED_DLL_SORTED(float)
+INDEXED_DLL_SORTED(char)
+INDEXED_DLL_SORTED(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FREE INDEXED DLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Frees every lane node and every list node, leaving an empty indexed list.
+ *
+ * @param idll Pointer to the indexed list.
+ */
+#define INDEXED_DLL_FREE(type) \
+    void freeIndexedDLL__##type(IndexedDLL__##type* idll) { \
+        struct DLLLane__##type* lane; \
+        struct DLLLane__##type* next; \
+        int l; \
+        \
+        for (l = 0; l < idll->levels; l++) { \
+            for (lane = idll->heads[l].next; lane != NULL; lane = next) { \
+                next = lane->next; \
+                free(lane); \
+            } \
+            \
+            idll->heads[l].next = NULL; \
+            idll->heads[l].span = 1; \
+        } \
+        \
+        idll->levels = 0; \
+        freeDLL__##type(&idll->list); \
+    } \
+
+INDEXED_DLL_FREE(int)
+INDEXED_DLL_FREE(float)
+INDEXED_DLL_FREE(char)
+INDEXED_DLL_FREE(double)
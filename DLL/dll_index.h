@@ -0,0 +1,115 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_index.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the doubly linked list with a skip-list index for positional access.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef DLL_INDEX_H
+#define DLL_INDEX_H
+
+#include <stdint.h>
+#include "dll.h"
+
+/**
+ * @brief Maximum number of express lanes above the list. Each lane holds about a quarter of the
+ *        nodes of the one below, so 16 lanes cover lists of billions of elements.
+ */
+#ifndef DLL_INDEX_MAX_LEVEL
+#define DLL_INDEX_MAX_LEVEL 16
+#endif
+
+/**
+ * @brief Macro to declare an indexed doubly linked list for a specific data type.
+ *
+ * `list` is an ordinary DLL__type holding every element. Above it sit up to
+ * DLL_INDEX_MAX_LEVEL express lanes. A lane node points at one list node (`node`), at the lane
+ * node below it (`down`, NULL in the lowest lane), and at the next lane node of its lane. Its
+ * `span` is the number of list positions from its node to the next lane node's node, or to
+ * the end of the list for the last node of a lane. `key` is a copy of the node's element, so
+ * searching by value does not have to touch the list node. `heads[l]` is a sentinel for lane
+ * `l` that stands before the first element (position -1) and has no `node`.
+ *
+ * @param type The data type for the list.
+ */
+#define DECLARE_INDEXED_DLL(type) \
+    struct DLLLane__##type { \
+        struct DLLLane__##type* next; \
+        struct DLLLane__##type* down; \
+        struct DLLNode__##type* node; \
+        type key; \
+        int span; \
+    }; \
+    typedef struct { \
+        DLL__##type list; \
+        struct DLLLane__##type heads[DLL_INDEX_MAX_LEVEL]; \
+        int levels; \
+        uint32_t seed; \
+    } IndexedDLL__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for indexed doubly linked list operations.
+ *
+ * Positional operations take O(log n) expected time instead of O(n). In-order iteration is
+ * still a plain walk over `list.head` and `next` (or `list.tail` and `prev`), and `list` can be
+ * passed to any read-only dll.h function. It must only be modified through these functions, or
+ * the lanes go stale.
+ *
+ * The sorted operations (insertSorted, lowerBound, upperBound, rangeCount, rangeErase) search
+ * the lanes by value and assume the list is kept in ascending order.
+ *
+ * @param type The data type for the list.
+ */
+#define INDEXED_DLL_PROTO(type) \
+    void initIndexedDLL__##type(IndexedDLL__##type* idll); \
+    void adoptIndexedDLL__##type(IndexedDLL__##type* idll, DLL__##type* dll); \
+    int insertAtIndexedDLL__##type(IndexedDLL__##type* idll, type data, int targetIdx); \
+    int insertAtHeadIndexedDLL__##type(IndexedDLL__##type* idll, type data); \
+    int insertAtTailIndexedDLL__##type(IndexedDLL__##type* idll, type data); \
+    void deleteAtIndexedDLL__##type(IndexedDLL__##type* idll, int targetIdx); \
+    void deleteHeadIndexedDLL__##type(IndexedDLL__##type* idll); \
+    type getDataAtIndexedDLL__##type(IndexedDLL__##type* idll, int targetIdx, type data404Response); \
+    void updateAtIndexedDLL__##type(IndexedDLL__##type* idll, int targetIdx, type newData); \
+    int sizeIndexedDLL__##type(IndexedDLL__##type* idll); \
+    int insertSortedIndexedDLL__##type(IndexedDLL__##type* idll, type data); \
+    int lowerBoundIndexedDLL__##type(IndexedDLL__##type* idll, type value); \
+    int upperBoundIndexedDLL__##type(IndexedDLL__##type* idll, type value); \
+    int rangeCountIndexedDLL__##type(IndexedDLL__##type* idll, type lo, type hi); \
+    int rangeEraseIndexedDLL__##type(IndexedDLL__##type* idll, type lo, type hi); \
+    void freeIndexedDLL__##type(IndexedDLL__##type* idll); \
+
+// Declaration for int data type
+DECLARE_INDEXED_DLL(int);
+// Declaration for float data type
+DECLARE_INDEXED_DLL(float);
+// Declaration for char data type
+DECLARE_INDEXED_DLL(char);
+// Declaration for double data type
+DECLARE_INDEXED_DLL(double);
+
+INDEXED_DLL_PROTO(int)
+INDEXED_DLL_PROTO(float)
+INDEXED_DLL_PROTO(char)
+INDEXED_DLL_PROTO(double)
+
+// Macro aliases for function calls
+#define initIndexedDLL(idll, type) initIndexedDLL__##type(idll)
+#define adoptIndexedDLL(idll, dll, type) adoptIndexedDLL__##type(idll, dll)
+#define insertAtIndexedDLL(idll, data, targetIdx, type) insertAtIndexedDLL__##type(idll, data, targetIdx)
+#define insertAtHeadIndexedDLL(idll, data, type) insertAtHeadIndexedDLL__##type(idll, data)
+#define insertAtTailIndexedDLL(idll, data, type) insertAtTailIndexedDLL__##type(idll, data)
+#define deleteAtIndexedDLL(idll, targetIdx, type) deleteAtIndexedDLL__##type(idll, targetIdx)
+#define deleteHeadIndexedDLL(idll, type) deleteHeadIndexedDLL__##type(idll)
+#define getDataAtIndexedDLL(idll, targetIdx, data404Response, type) getDataAtIndexedDLL__##type(idll, targetIdx, data404Response)
+#define updateAtIndexedDLL(idll, targetIdx, newData, type) updateAtIndexedDLL__##type(idll, targetIdx, newData)
+#define sizeIndexedDLL(idll, type) sizeIndexedDLL__##type(idll)
+#define insertSortedIndexedDLL(idll, data, type) insertSortedIndexedDLL__##type(idll, data)
+#define lowerBoundIndexedDLL(idll, value, type) lowerBoundIndexedDLL__##type(idll, value)
+#define upperBoundIndexedDLL(idll, value, type) upperBoundIndexedDLL__##type(idll, value)
+#define rangeCountIndexedDLL(idll, lo, hi, type) rangeCountIndexedDLL__##type(idll, lo, hi)
+#define rangeEraseIndexedDLL(idll, lo, hi, type) rangeEraseIndexedDLL__##type(idll, lo, hi)
+#define freeIndexedDLL(idll, type) freeIndexedDLL__##type(idll)
+
+
+#endif /* DLL_INDEX_H */
@@ -0,0 +1,888 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_io.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the dll_io.h header file containing doubly linked list serialization
+ *          and text import / export.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "dll_io.h"
+
+#define DLL_IO_ENDIAN 0x01020304u
+#define DLL_TEXT_MAX 64
+
+#define DLL_TEXT_FORMAT_int(p, v) formatIntText(p, v)
+#define DLL_TEXT_FORMAT_float(p, v) formatRealText(p, v, 1)
+#define DLL_TEXT_FORMAT_char(p, v) formatCharText(p, v)
+#define DLL_TEXT_FORMAT_double(p, v) formatRealText(p, v, 0)
+
+// -------------------------------------------------------------------------------------------->
+// BINARY FORMAT HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Reads 8 bytes as a little-endian word, independent of the host byte order.
+ */
+static uint64_t load64le(const unsigned char* p) {
+    return (uint64_t) p[0] | (uint64_t) p[1] << 8 | (uint64_t) p[2] << 16 | (uint64_t) p[3] << 24 |
+           (uint64_t) p[4] << 32 | (uint64_t) p[5] << 40 | (uint64_t) p[6] << 48 | (uint64_t) p[7] << 56;
+}
+
+/**
+ * @brief Folds `len` payload bytes into the running checksum `h` (start from DLL_IO_SEED).
+ *
+ * The payload is consumed as 64-bit little-endian words (a trailing partial word is zero padded),
+ * so the checksum only depends on the bytes in the file. Callers feed every chunk but the last
+ * in multiples of 8 bytes.
+ */
+uint64_t checksumPayloadDLL(uint64_t h, const unsigned char* buf, size_t len) {
+    unsigned char tail[8] = {0};
+    size_t i;
+
+    for (i = 0; i + 8 <= len; i += 8) {
+        h = (h ^ load64le(buf + i)) * 0x100000001b3ULL;
+        h ^= h >> 29;
+    }
+
+    if (i < len) {
+        memcpy(tail, buf + i, len - i);
+        h = (h ^ load64le(tail)) * 0x100000001b3ULL;
+        h ^= h >> 29;
+    }
+
+    return h;
+}
+
+/**
+ * @brief Reverses the byte order of `count` consecutive elements of `size` bytes each.
+ */
+void swapElementsDLL(unsigned char* buf, size_t count, size_t size) {
+    unsigned char t;
+    size_t i, j;
+
+    for (i = 0; i < count; i++, buf += size) {
+        for (j = 0; j < size / 2; j++) {
+            t = buf[j];
+            buf[j] = buf[size - 1 - j];
+            buf[size - 1 - j] = t;
+        }
+    }
+}
+
+/**
+ * @brief Fills `header` with the DLL_IO_HEADER-byte header described in dll_io.h.
+ */
+void encodeHeaderDLL(unsigned char* header, int tag, size_t size, uint64_t count, uint64_t checksum) {
+    uint16_t version = DLL_IO_VERSION;
+    uint32_t endian = DLL_IO_ENDIAN;
+
+    memset(header, 0, DLL_IO_HEADER);
+    memcpy(header, "CDLL", 4);
+    memcpy(header + 4, &version, 2);
+    header[6] = (unsigned char) tag;
+    header[7] = (unsigned char) size;
+    memcpy(header + 8, &endian, 4);
+    memcpy(header + 16, &count, 8);
+    memcpy(header + 24, &checksum, 8);
+}
+
+/**
+ * @brief Validates a header produced by encodeHeaderDLL() and extracts its fields.
+ *
+ * @param swap Set to 1 when the file was written with the opposite byte order.
+ *
+ * @return 1 if the header is valid for `tag` / `size`, 0 otherwise.
+ */
+int decodeHeaderDLL(const unsigned char* header, int tag, size_t size, uint64_t* count, uint64_t* checksum, int* swap) {
+    uint16_t version;
+    uint32_t endian;
+
+    if (memcmp(header, "CDLL", 4) != 0) {
+        return 0;
+    }
+
+    memcpy(&version, header + 4, 2);
+    memcpy(&endian, header + 8, 4);
+    memcpy(count, header + 16, 8);
+    memcpy(checksum, header + 24, 8);
+
+    if (endian == DLL_IO_ENDIAN) {
+        *swap = 0;
+    } else if (endian == 0x04030201u) {
+        *swap = 1;
+        swapElementsDLL((unsigned char*) &version, 1, 2);
+        swapElementsDLL((unsigned char*) count, 1, 8);
+        swapElementsDLL((unsigned char*) checksum, 1, 8);
+    } else {
+        return 0;
+    }
+
+    return version >= 1 && version <= DLL_IO_VERSION && header[6] == tag && header[7] == size;
+}
+
+/**
+ * @brief Writes a header to `fp`.
+ *
+ * @return 1 on success, 0 on a short write.
+ */
+static int writeHeaderDLL(FILE* fp, int tag, size_t size, uint64_t count, uint64_t checksum) {
+    unsigned char header[DLL_IO_HEADER];
+
+    encodeHeaderDLL(header, tag, size, count, checksum);
+
+    return fwrite(header, 1, DLL_IO_HEADER, fp) == DLL_IO_HEADER;
+}
+
+/**
+ * @brief Reads a header from `fp` and validates it with decodeHeaderDLL().
+ *
+ * @return 1 if the header is valid for `tag` / `size`, 0 otherwise.
+ */
+static int readHeaderDLL(FILE* fp, int tag, size_t size, uint64_t* count, uint64_t* checksum, int* swap) {
+    unsigned char header[DLL_IO_HEADER];
+
+    return fread(header, 1, DLL_IO_HEADER, fp) == DLL_IO_HEADER && decodeHeaderDLL(header, tag, size, count, checksum, swap);
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO SAVE DLL :                       BINARY
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Writes the list to `fp` in the binary format described in dll_io.h.
+ *
+ * The chain is walked once. Elements are packed into a DLL_IO_BUFFER staging buffer that is
+ * checksummed and written with one fwrite() per buffer. Because the checksum is only known at
+ * the end, the header is written first and its checksum field is patched afterwards.
+ *
+ * @param dll Pointer to the doubly linked list structure.
+ * @param fp Seekable stream opened for binary writing; on success it is left after the payload.
+ *
+ * @return 1 on success, 0 on an allocation, write or seek failure.
+ */
+#define DLL_SAVE(type) \
+    int saveDLL__##type(DLL__##type* dll, FILE* fp) { \
+        size_t perBuffer = DLL_IO_BUFFER / sizeof(type); \
+        type* buf = (type*) malloc(DLL_IO_BUFFER); \
+        struct DLLNode__##type* itr = dll->head; \
+        uint64_t checksum = DLL_IO_SEED; \
+        long start = ftell(fp); \
+        size_t n; \
+        int ok = buf != NULL && start >= 0; \
+        \
+        ok = ok && writeHeaderDLL(fp, DLL_IO_TAG_##type, sizeof(type), (uint64_t) dll->size, 0); \
+        \
+        while (ok && itr != NULL) { \
+            for (n = 0; n < perBuffer && itr != NULL; n++, itr = itr->next) { \
+                buf[n] = itr->data; \
+            } \
+            \
+            checksum = checksumPayloadDLL(checksum, (unsigned char*) buf, n * sizeof(type)); \
+            ok = fwrite(buf, sizeof(type), n, fp) == n; \
+        } \
+        \
+        ok = ok && fseek(fp, start + 24, SEEK_SET) == 0; \
+        ok = ok && fwrite(&checksum, 8, 1, fp) == 1; \
+        ok = ok && fseek(fp, start + DLL_IO_HEADER + (long) (dll->size * sizeof(type)), SEEK_SET) == 0; \
+        \
+        free(buf); \
+        \
+        return ok; \
+    } \
+
+DLL_SAVE(int)
+DLL_SAVE(float)
+DLL_SAVE(char)
+DLL_SAVE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO LOAD DLL :                       BINARY
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Reads a list written by saveDLL() and appends its elements to `dll`.
+ *
+ * The payload is read in DLL_IO_BUFFER chunks and linked into a private chain in a single pass,
+ * byte-swapping first if the file came from a machine with the opposite endianness. The chain is
+ * spliced onto `dll` only after the checksum matched, so a corrupt file leaves `dll` untouched.
+ *
+ * @param dll Pointer to the doubly linked list structure (may already hold data).
+ * @param fp Stream opened for binary reading, positioned at a header.
+ *
+ * @return 1 on success, 0 if the header is invalid, the file is truncated, the checksum does not
+ *         match or memory ran out.
+ *
+ * @note Nodes are allocated one by one rather than as one block so the loaded list stays
+ *       compatible with deleteHead(), deleteTail(), delete() and freeDLL(), which free
+ *       individual nodes.
+ */
+#define DLL_LOAD(type) \
+    int loadDLL__##type(DLL__##type* dll, FILE* fp) { \
+        size_t perBuffer = DLL_IO_BUFFER / sizeof(type); \
+        type* buf; \
+        struct DLLNode__##type* head = NULL; \
+        struct DLLNode__##type* tail = NULL; \
+        struct DLLNode__##type* node; \
+        uint64_t count, expected, remaining; \
+        uint64_t checksum = DLL_IO_SEED; \
+        size_t n, i; \
+        int swap; \
+        int ok; \
+        \
+        if (!readHeaderDLL(fp, DLL_IO_TAG_##type, sizeof(type), &count, &expected, &swap) || \
+            count > (uint64_t) (INT_MAX - dll->size)) { \
+            return 0; \
+        } \
+        \
+        buf = (type*) malloc(DLL_IO_BUFFER); \
+        ok = buf != NULL; \
+        \
+        for (remaining = count; ok && remaining > 0; remaining -= n) { \
+            n = remaining < perBuffer ? (size_t) remaining : perBuffer; \
+            ok = fread(buf, sizeof(type), n, fp) == n; \
+            \
+            if (!ok) { \
+                break; \
+            } \
+            \
+            checksum = checksumPayloadDLL(checksum, (unsigned char*) buf, n * sizeof(type)); \
+            \
+            if (swap) { \
+                swapElementsDLL((unsigned char*) buf, n, sizeof(type)); \
+            } \
+            \
+            for (i = 0; i < n; i++) { \
+                node = (struct DLLNode__##type*) malloc(sizeof(struct DLLNode__##type)); \
+                \
+                if (node == NULL) { \
+                    ok = 0; \
+                    break; \
+                } \
+                \
+                node->data = buf[i]; \
+                node->prev = tail; \
+                node->next = NULL; \
+                \
+                if (tail == NULL) { \
+                    head = node; \
+                } else { \
+                    tail->next = node; \
+                } \
+                tail = node; \
+            } \
+        } \
+        \
+        free(buf); \
+        \
+        if (!ok || checksum != expected) { \
+            while (head != NULL) { \
+                node = head->next; \
+                free(head); \
+                head = node; \
+            } \
+            return 0; \
+        } \
+        \
+        if (head != NULL) { \
+            if (dll->tail == NULL) { \
+                dll->head = head; \
+            } else { \
+                dll->tail->next = head; \
+            } \
+            head->prev = dll->tail; \
+            dll->tail = tail; \
+            dll->size += (int) count; \
+        } \
+        \
+        return 1; \
+    } \
+
+DLL_LOAD(int)
+DLL_LOAD(float)
+DLL_LOAD(char)
+DLL_LOAD(double)
+// -------------------------------------------------------------------------------------------->
+// TEXT FORMAT HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Powers of ten that are exact in a double; any integer below 2^53 multiplied or divided
+ *        by one of them is rounded exactly once.
+ */
+static const double textPow10[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/**
+ * @brief Writes `v` in decimal at `p` and returns the position after it.
+ */
+static char* formatIntText(char* p, long long v) {
+    unsigned long long u = v < 0 ? 0ULL - (unsigned long long) v : (unsigned long long) v;
+    char digits[20];
+    int n = 0;
+
+    if (v < 0) {
+        *p++ = '-';
+    }
+
+    do {
+        digits[n++] = (char) ('0' + u % 10);
+        u /= 10;
+    } while (u != 0);
+
+    while (n > 0) {
+        *p++ = digits[--n];
+    }
+
+    return p;
+}
+
+/**
+ * @brief Writes `v` at `p` so that parseRealText() reads back exactly the same value.
+ *
+ * Tries `r / 10^d` for d = 0, 1, 2, ... with `r` the nearest integer to `|v| * 10^d`, and
+ * writes the first one that converts back to `v` (in float precision when `single` is set).
+ * That division is the same single rounding the reader's fast path performs, so the check is
+ * exact. Values that need more than ~15 significant digits, infinities and NaN fall back to
+ * snprintf().
+ */
+static char* formatRealText(char* p, double v, int single) {
+    double a = v < 0 ? -v : v;
+    unsigned long long r;
+    char digits[20];
+    int n, d;
+
+    if (a < 9007199254740992.0) {
+        for (d = 0; d < 23 && a * textPow10[d] < 9007199254740992.0; d++) {
+            r = (unsigned long long) (a * textPow10[d] + 0.5);
+
+            if (single ? (float) ((double) r / textPow10[d]) != (float) a : (double) r / textPow10[d] != a) {
+                continue;
+            }
+
+            if (signbit(v)) {
+                *p++ = '-';
+            }
+
+            for (n = 0; n == 0 || r != 0; r /= 10) {
+                digits[n++] = (char) ('0' + r % 10);
+            }
+
+            if (n <= d) {
+                *p++ = '0';
+                *p++ = '.';
+                for (; d > n; d--) {
+                    *p++ = '0';
+                }
+                d = 0;
+            }
+
+            while (n > 0) {
+                if (n == d) {
+                    *p++ = '.';
+                }
+                *p++ = digits[--n];
+            }
+
+            return p;
+        }
+    }
+
+    return p + snprintf(p, DLL_TEXT_MAX, single ? "%.9g" : "%.17g", v);
+}
+
+/**
+ * @brief Writes the raw byte `c` at `p`.
+ */
+static char* formatCharText(char* p, char c) {
+    *p = c;
+
+    return p + 1;
+}
+
+/**
+ * @brief Parses a whole token as a decimal integer in [min, max].
+ *
+ * @return 1 on success, 0 if the token is not an integer or out of range.
+ */
+static int parseIntText(const char* tok, size_t len, long long min, long long max, long long* out) {
+    unsigned long long limit, u = 0;
+    size_t i = 0;
+    int neg = 0;
+
+    if (i < len && (tok[i] == '-' || tok[i] == '+')) {
+        neg = tok[i++] == '-';
+    }
+
+    if (i == len) {
+        return 0;
+    }
+
+    limit = neg ? 0ULL - (unsigned long long) min : (unsigned long long) max;
+
+    for (; i < len; i++) {
+        if (tok[i] < '0' || tok[i] > '9' || u > (limit - (unsigned long long) (tok[i] - '0')) / 10) {
+            return 0;
+        }
+        u = u * 10 + (unsigned long long) (tok[i] - '0');
+    }
+
+    *out = neg ? (long long) (0ULL - u) : (long long) u;
+
+    return 1;
+}
+
+/**
+ * @brief Parses a whole token as a decimal floating-point number.
+ *
+ * Plain decimals with at most 19 significant digits whose value is `m * 10^e` with `m < 2^53`
+ * and `|e| <= 22` are converted with a single multiply or divide, which is correctly rounded.
+ * Everything else (long mantissas, large exponents, inf, nan, hex) goes through strtod(), on a
+ * stack copy of the token or, for tokens of DLL_TEXT_MAX bytes or more, a heap copy.
+ *
+ * @return 1 on success, 0 if the token is not a number or the heap copy cannot be allocated.
+ */
+static int parseRealText(const char* tok, size_t len, double* out) {
+    unsigned long long m = 0;
+    int digits = 0, frac = 0, exp = 0, expNeg = 0, neg = 0, any = 0, fast = 1;
+    char tmp[DLL_TEXT_MAX];
+    char* copy = tmp;
+    char* end;
+    size_t i = 0;
+    double x;
+    int ok;
+
+    if (i < len && (tok[i] == '-' || tok[i] == '+')) {
+        neg = tok[i++] == '-';
+    }
+
+    for (; i < len && tok[i] >= '0' && tok[i] <= '9'; i++, any = 1) {
+        if (digits < 19) {
+            m = m * 10 + (unsigned long long) (tok[i] - '0');
+            digits += m != 0;
+        } else {
+            fast = 0;
+        }
+    }
+
+    if (i < len && tok[i] == '.') {
+        for (i++; i < len && tok[i] >= '0' && tok[i] <= '9'; i++, any = 1) {
+            if (digits < 19) {
+                m = m * 10 + (unsigned long long) (tok[i] - '0');
+                digits += m != 0;
+                frac++;
+            } else {
+                fast = 0;
+            }
+        }
+    }
+
+    if (any && i < len && (tok[i] == 'e' || tok[i] == 'E')) {
+        i++;
+        if (i < len && (tok[i] == '-' || tok[i] == '+')) {
+            expNeg = tok[i++] == '-';
+        }
+        for (any = 0; i < len && tok[i] >= '0' && tok[i] <= '9'; i++, any = 1) {
+            exp = exp < 10000 ? exp * 10 + (tok[i] - '0') : exp;
+        }
+    }
+
+    exp = (expNeg ? -exp : exp) - frac;
+
+    if (fast && any && i == len && m <= 9007199254740992ULL && exp >= -22 && exp <= 22) {
+        x = exp < 0 ? (double) m / textPow10[-exp] : (double) m * textPow10[exp];
+        *out = neg ? -x : x;
+        return 1;
+    }
+
+    if (len == 0) {
+        return 0;
+    }
+
+    if (len >= sizeof(tmp) && (copy = (char*) malloc(len + 1)) == NULL) {
+        return 0;
+    }
+
+    memcpy(copy, tok, len);
+    copy[len] = '\0';
+    *out = strtod(copy, &end);
+    ok = end == copy + len;
+
+    if (copy != tmp) {
+        free(copy);
+    }
+
+    return ok;
+}
+
+/**
+ * @brief Writes `len` bytes to `fp`, or to `fd` when `fp` is NULL, retrying short writes.
+ *
+ * @return 1 on success, 0 on a write error.
+ */
+static int flushTextDLL(FILE* fp, int fd, const char* buf, size_t len) {
+    ssize_t put;
+
+    if (fp != NULL) {
+        return fwrite(buf, 1, len, fp) == len;
+    }
+
+    while (len > 0) {
+        put = write(fd, buf, len);
+
+        if (put < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (put <= 0) {
+            return 0;
+        }
+
+        buf += put;
+        len -= (size_t) put;
+    }
+
+    return 1;
+}
+// -------------------------------------------------------------------------------------------->
+// TEXT READER OF DLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Prepares `r` to read text from `fp`, or from `fd` when `fp` is NULL.
+ *
+ * The reader never closes its source; closeTextReaderDLL() only releases the buffer.
+ *
+ * @return 1 on success, 0 if the buffer could not be allocated.
+ */
+int openTextReaderDLL(DLLTextReader* r, FILE* fp, int fd, char delimiter) {
+    r->fp = fp;
+    r->fd = fd;
+    r->buf = (char*) malloc(DLL_IO_BUFFER);
+    r->pos = 0;
+    r->len = 0;
+    r->eof = 0;
+    r->error = 0;
+    r->delimiter = delimiter;
+
+    return r->buf != NULL;
+}
+
+void closeTextReaderDLL(DLLTextReader* r) {
+    free(r->buf);
+    r->buf = NULL;
+    r->pos = 0;
+    r->len = 0;
+}
+
+/**
+ * @brief Moves the unread bytes to the front of the buffer and reads more behind them.
+ *
+ * @return 1 if new bytes arrived, 0 at end of input, on a read error (`r->error` is set) or
+ *         when the buffer is already full.
+ */
+static int fillTextReaderDLL(DLLTextReader* r) {
+    ssize_t got;
+
+    if (r->pos > 0) {
+        memmove(r->buf, r->buf + r->pos, r->len - r->pos);
+        r->len -= r->pos;
+        r->pos = 0;
+    }
+
+    if (r->eof || r->len == DLL_IO_BUFFER) {
+        return 0;
+    }
+
+    if (r->fp != NULL) {
+        got = (ssize_t) fread(r->buf + r->len, 1, DLL_IO_BUFFER - r->len, r->fp);
+        r->error = got == 0 && ferror(r->fp);
+    } else {
+        do {
+            got = read(r->fd, r->buf + r->len, DLL_IO_BUFFER - r->len);
+        } while (got < 0 && errno == EINTR);
+        r->error = got < 0;
+    }
+
+    if (got <= 0) {
+        r->eof = 1;
+        return 0;
+    }
+
+    r->len += (size_t) got;
+
+    return 1;
+}
+
+static int isTextSeparatorDLL(const DLLTextReader* r, char c) {
+    return c == r->delimiter || c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+/**
+ * @brief Finds the next numeric token, refilling the buffer as needed.
+ *
+ * The token stays valid until the next call.
+ *
+ * @return 1 for a token, 0 at end of input, -1 on a read error or a token longer than the buffer.
+ */
+static int nextTokenDLL(DLLTextReader* r, const char** tok, size_t* len) {
+    size_t i;
+
+    for (;;) {
+        while (r->pos < r->len && isTextSeparatorDLL(r, r->buf[r->pos])) {
+            r->pos++;
+        }
+
+        if (r->pos < r->len) {
+            break;
+        }
+
+        if (!fillTextReaderDLL(r)) {
+            return r->error ? -1 : 0;
+        }
+    }
+
+    for (i = r->pos;;) {
+        while (i < r->len && !isTextSeparatorDLL(r, r->buf[i])) {
+            i++;
+        }
+
+        if (i < r->len || r->eof) {
+            break;
+        }
+
+        i -= r->pos;
+
+        if (!fillTextReaderDLL(r) && (r->error || !r->eof)) {
+            return -1;
+        }
+    }
+
+    *tok = r->buf + r->pos;
+    *len = i - r->pos;
+    r->pos = i;
+
+    return 1;
+}
+
+/**
+ * @brief Reads one value per element type. Each returns 1, 0 at end of input or -1 on a read
+ *        or parse error.
+ */
+static int readValueDLL__int(DLLTextReader* r, int* out) {
+    const char* tok;
+    size_t len;
+    long long v;
+    int got = nextTokenDLL(r, &tok, &len);
+
+    if (got != 1) {
+        return got;
+    }
+
+    if (!parseIntText(tok, len, INT_MIN, INT_MAX, &v)) {
+        return -1;
+    }
+
+    *out = (int) v;
+
+    return 1;
+}
+
+static int readValueDLL__double(DLLTextReader* r, double* out) {
+    const char* tok;
+    size_t len;
+    int got = nextTokenDLL(r, &tok, &len);
+
+    if (got != 1) {
+        return got;
+    }
+
+    return parseRealText(tok, len, out) ? 1 : -1;
+}
+
+static int readValueDLL__float(DLLTextReader* r, float* out) {
+    double v;
+    int got = readValueDLL__double(r, &v);
+
+    if (got == 1) {
+        *out = (float) v;
+    }
+
+    return got;
+}
+
+static int readValueDLL__char(DLLTextReader* r, char* out) {
+    if (r->pos == r->len && !fillTextReaderDLL(r)) {
+        return r->error ? -1 : 0;
+    }
+
+    *out = r->buf[r->pos++];
+
+    if (r->pos == r->len) {
+        fillTextReaderDLL(r);
+    }
+
+    if (r->pos < r->len) {
+        if (r->buf[r->pos] != r->delimiter && r->buf[r->pos] != '\n') {
+            return -1;
+        }
+        r->pos++;
+    }
+
+    return r->error ? -1 : 1;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO WRITE DLL :                      TEXT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Writes the list as delimited text to `fp` (writeTextDLL) or to `fd` (writeTextFdDLL).
+ *
+ * Values are formatted by hand straight into a DLL_IO_BUFFER output buffer, which is handed
+ * to fwrite() / write() whenever it is nearly full. There is no per-element stdio call.
+ *
+ * @param dll Pointer to the doubly linked list structure.
+ * @param delimiter Character written between two elements.
+ *
+ * @return 1 on success, 0 on an allocation or write failure.
+ */
+#define DLL_WRITE_TEXT(type) \
+    static int writeTextToDLL__##type(DLL__##type* dll, FILE* fp, int fd, char delimiter) { \
+        char* buf = (char*) malloc(DLL_IO_BUFFER); \
+        char* p = buf; \
+        struct DLLNode__##type* itr = dll->head; \
+        int ok = buf != NULL; \
+        \
+        while (ok && itr != NULL) { \
+            p = DLL_TEXT_FORMAT_##type(p, itr->data); \
+            *p++ = itr->next != NULL ? delimiter : '\n'; \
+            itr = itr->next; \
+            \
+            if (buf + DLL_IO_BUFFER - p < DLL_TEXT_MAX) { \
+                ok = flushTextDLL(fp, fd, buf, (size_t) (p - buf)); \
+                p = buf; \
+            } \
+        } \
+        \
+        ok = ok && flushTextDLL(fp, fd, buf, (size_t) (p - buf)); \
+        free(buf); \
+        \
+        return ok; \
+    } \
+    \
+    int writeTextDLL__##type(DLL__##type* dll, FILE* fp, char delimiter) { \
+        return writeTextToDLL__##type(dll, fp, -1, delimiter); \
+    } \
+    \
+    int writeTextFdDLL__##type(DLL__##type* dll, int fd, char delimiter) { \
+        return writeTextToDLL__##type(dll, NULL, fd, delimiter); \
+    } \
+
+DLL_WRITE_TEXT(int)
+DLL_WRITE_TEXT(float)
+DLL_WRITE_TEXT(char)
+DLL_WRITE_TEXT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO READ DLL :                       TEXT / CHUNKED TEXT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Parses delimited text and appends the values to `dll`.
+ *
+ * readTextChunkDLL() appends at most `maxCount` values (no limit when `maxCount` <= 0) from an
+ * open DLLTextReader and can be called again to continue where it stopped, so an input larger
+ * than memory can be processed a chunk at a time. readTextDLL() / readTextFdDLL() read the
+ * whole input in one go.
+ *
+ * Nodes are linked into a private chain and spliced onto `dll` only once the chunk parsed
+ * cleanly, so a malformed value leaves `dll` unchanged.
+ *
+ * @param dll Pointer to the doubly linked list structure (may already hold data).
+ *
+ * @return readTextChunkDLL: the number of values appended (0 at end of input) or -1 on a read,
+ *         parse or allocation error. readTextDLL / readTextFdDLL: 1 on success, 0 on failure.
+ */
+#define DLL_READ_TEXT(type) \
+    int readTextChunkDLL__##type(DLL__##type* dll, DLLTextReader* r, int maxCount) { \
+        struct DLLNode__##type* head = NULL; \
+        struct DLLNode__##type* tail = NULL; \
+        struct DLLNode__##type* node; \
+        type value; \
+        int count = 0; \
+        int got = 1; \
+        \
+        if (maxCount <= 0 || maxCount > INT_MAX - dll->size) { \
+            maxCount = INT_MAX - dll->size; \
+        } \
+        \
+        while (count < maxCount && (got = readValueDLL__##type(r, &value)) == 1) { \
+            node = (struct DLLNode__##type*) malloc(sizeof(struct DLLNode__##type)); \
+            \
+            if (node == NULL) { \
+                got = -1; \
+                break; \
+            } \
+            \
+            node->data = value; \
+            node->prev = tail; \
+            node->next = NULL; \
+            \
+            if (tail == NULL) { \
+                head = node; \
+            } else { \
+                tail->next = node; \
+            } \
+            tail = node; \
+            count++; \
+        } \
+        \
+        if (got < 0) { \
+            while (head != NULL) { \
+                node = head->next; \
+                free(head); \
+                head = node; \
+            } \
+            return -1; \
+        } \
+        \
+        if (head != NULL) { \
+            head->prev = dll->tail; \
+            if (dll->tail == NULL) { \
+                dll->head = head; \
+            } else { \
+                dll->tail->next = head; \
+            } \
+            dll->tail = tail; \
+            dll->size += count; \
+        } \
+        \
+        return count; \
+    } \
+    \
+    static int readTextFromDLL__##type(DLL__##type* dll, FILE* fp, int fd, char delimiter) { \
+        DLLTextReader r; \
+        int got; \
+        \
+        if (!openTextReaderDLL(&r, fp, fd, delimiter)) { \
+            return 0; \
+        } \
+        \
+        got = readTextChunkDLL__##type(dll, &r, 0); \
+        closeTextReaderDLL(&r); \
+        \
+        return got >= 0; \
+    } \
+    \
+    int readTextDLL__##type(DLL__##type* dll, FILE* fp, char delimiter) { \
+        return readTextFromDLL__##type(dll, fp, -1, delimiter); \
+    } \
+    \
+    int readTextFdDLL__##type(DLL__##type* dll, int fd, char delimiter) { \
+        return readTextFromDLL__##type(dll, NULL, fd, delimiter); \
+    } \
+
+DLL_READ_TEXT(int)
+DLL_READ_TEXT(float)
+DLL_READ_TEXT(char)
+DLL_READ_TEXT(double)
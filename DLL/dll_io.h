@@ -0,0 +1,137 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_io.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for saving and loading doubly linked lists in binary and text form.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef DLL_IO_H
+#define DLL_IO_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "dll.h"
+
+/**
+ * @brief Size of the staging buffer used by every save / load call, in bytes.
+ *
+ * Must be a multiple of 8 so the payload checksum sees the same 64-bit words on both sides.
+ */
+#ifndef DLL_IO_BUFFER
+#define DLL_IO_BUFFER (1 << 20)
+#endif
+
+/**
+ * @brief Binary format version written by saveDLL().
+ */
+#define DLL_IO_VERSION 1
+
+/**
+ * @brief Size of the binary header, and the initial value of the payload checksum.
+ */
+#define DLL_IO_HEADER 32
+#define DLL_IO_SEED 0xcbf29ce484222325ULL
+
+/**
+ * @brief Type tags stored in the binary header.
+ */
+#define DLL_IO_TAG_int 1
+#define DLL_IO_TAG_float 2
+#define DLL_IO_TAG_char 3
+#define DLL_IO_TAG_double 4
+
+/**
+ * @brief State of a chunked text read.
+ *
+ * Holds the source (`fp`, or `fd` when `fp` is NULL) and a DLL_IO_BUFFER input buffer. A value
+ * split across two reads is carried over to the next refill, so successive
+ * readTextChunkDLL() calls see one continuous stream.
+ */
+typedef struct {
+    FILE* fp;
+    int fd;
+    char* buf;
+    size_t pos;
+    size_t len;
+    int eof;
+    int error;
+    char delimiter;
+} DLLTextReader;
+
+int openTextReaderDLL(DLLTextReader* r, FILE* fp, int fd, char delimiter);
+void closeTextReaderDLL(DLLTextReader* r);
+
+/**
+ * @brief Macro to declare function prototypes for doubly linked list serialization.
+ *
+ * Binary layout (32-byte header followed by the packed elements):
+ *
+ * | Offset | Size | Field                                             |
+ * |--------|------|---------------------------------------------------|
+ * | 0      | 4    | magic `"CDLL"`                                    |
+ * | 4      | 2    | format version (DLL_IO_VERSION)                   |
+ * | 6      | 1    | type tag (DLL_IO_TAG_type)                        |
+ * | 7      | 1    | element size in bytes                             |
+ * | 8      | 4    | endianness marker 0x01020304 in writer byte order |
+ * | 12     | 4    | reserved, zero                                    |
+ * | 16     | 8    | element count                                     |
+ * | 24     | 8    | checksum of the payload bytes                     |
+ * | 32     | ...  | `count` elements, packed, in writer byte order    |
+ *
+ * @param type The data type for the doubly linked list.
+ */
+#define DLL_IO_PROTO(type) \
+    int saveDLL__##type(DLL__##type* dll, FILE* fp); \
+    int loadDLL__##type(DLL__##type* dll, FILE* fp); \
+
+/**
+ * @brief Building blocks of the binary format, shared with the asynchronous save / load in
+ *        dll_aio.h.
+ */
+uint64_t checksumPayloadDLL(uint64_t h, const unsigned char* buf, size_t len);
+void swapElementsDLL(unsigned char* buf, size_t count, size_t size);
+void encodeHeaderDLL(unsigned char* header, int tag, size_t size, uint64_t count, uint64_t checksum);
+int decodeHeaderDLL(const unsigned char* header, int tag, size_t size, uint64_t* count, uint64_t* checksum, int* swap);
+
+DLL_IO_PROTO(int)
+DLL_IO_PROTO(float)
+DLL_IO_PROTO(char)
+DLL_IO_PROTO(double)
+
+/**
+ * @brief Macro to declare function prototypes for doubly linked list text import / export.
+ *
+ * Text layout: the elements in list order, separated by `delimiter`, with a newline after the
+ * last one (an empty list writes nothing). Numbers are written in decimal; float and double use
+ * the shortest fixed-point form that reads back to the same value, or `%.9g` / `%.17g` when more
+ * digits are needed. A char element is the raw byte itself.
+ *
+ * When reading numbers, any run of delimiters, spaces, tabs and newlines separates two values.
+ * A char element is exactly one byte followed by one delimiter or newline.
+ *
+ * @param type The data type for the doubly linked list.
+ */
+#define DLL_TEXT_PROTO(type) \
+    int writeTextDLL__##type(DLL__##type* dll, FILE* fp, char delimiter); \
+    int writeTextFdDLL__##type(DLL__##type* dll, int fd, char delimiter); \
+    int readTextDLL__##type(DLL__##type* dll, FILE* fp, char delimiter); \
+    int readTextFdDLL__##type(DLL__##type* dll, int fd, char delimiter); \
+    int readTextChunkDLL__##type(DLL__##type* dll, DLLTextReader* r, int maxCount); \
+
+DLL_TEXT_PROTO(int)
+DLL_TEXT_PROTO(float)
+DLL_TEXT_PROTO(char)
+DLL_TEXT_PROTO(double)
+
+// Macro aliases for function calls
+#define saveDLL(dll, fp, type) saveDLL__##type(dll, fp)
+#define loadDLL(dll, fp, type) loadDLL__##type(dll, fp)
+#define writeTextDLL(dll, fp, delimiter, type) writeTextDLL__##type(dll, fp, delimiter)
+#define writeTextFdDLL(dll, fd, delimiter, type) writeTextFdDLL__##type(dll, fd, delimiter)
+#define readTextDLL(dll, fp, delimiter, type) readTextDLL__##type(dll, fp, delimiter)
+#define readTextFdDLL(dll, fd, delimiter, type) readTextFdDLL__##type(dll, fd, delimiter)
+#define readTextChunkDLL(dll, r, maxCount, type) readTextChunkDLL__##type(dll, r, maxCount)
+
+
+#endif /* DLL_IO_H */
@@ -0,0 +1,545 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_journal.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the dll_journal.h header file containing the journaled doubly linked
+ *          list.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "dll_io.h"
+#include "dll_journal.h"
+
+#define DLL_JOURNAL_HEADER 16
+#define DLL_JOURNAL_VERSION 1
+#define DLL_JOURNAL_BATCH 4096
+
+#define JOURNAL_INSERT_HEAD 1
+#define JOURNAL_INSERT_TAIL 2
+#define JOURNAL_INSERT_AT 3
+#define JOURNAL_INSERT_AFTER 4
+#define JOURNAL_INSERT_BEFORE 5
+#define JOURNAL_DELETE_HEAD 6
+#define JOURNAL_DELETE 7
+#define JOURNAL_DELETE_ALL 8
+#define JOURNAL_DELETE_AT 9
+#define JOURNAL_UPDATE_AT 10
+#define JOURNAL_CLEAR 11
+#define JOURNAL_DELETE_TAIL 12
+
+// -------------------------------------------------------------------------------------------->
+// JOURNAL FILE HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Checksum of the first 24 bytes of a record, used to detect a torn or garbage tail.
+ */
+static uint64_t checksumRecord(const unsigned char* rec) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    uint64_t w;
+    int i;
+
+    for (i = 0; i < 24; i += 8) {
+        memcpy(&w, rec + i, 8);
+        h = (h ^ w) * 0x100000001b3ULL;
+        h ^= h >> 29;
+    }
+
+    return h;
+}
+
+/**
+ * @brief Writes `len` bytes to `fd`, retrying short and interrupted writes.
+ *
+ * @return 1 on success, 0 on a write error.
+ */
+static int writeAllJournal(int fd, const unsigned char* buf, size_t len) {
+    ssize_t put;
+
+    while (len > 0) {
+        put = write(fd, buf, len);
+
+        if (put < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (put <= 0) {
+            return 0;
+        }
+
+        buf += put;
+        len -= (size_t) put;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief fsync()s the directory holding `path`, so a rename() into it is durable.
+ *
+ * @return 1 on success, 0 on failure.
+ */
+static int syncParentDirJournal(const char* path) {
+    const char* slash = strrchr(path, '/');
+    char* dir;
+    int fd, ok;
+
+    if (slash == NULL) {
+        fd = open(".", O_RDONLY);
+    } else {
+        dir = (char*) malloc((size_t) (slash - path) + 2);
+        if (dir == NULL) {
+            return 0;
+        }
+        memcpy(dir, path, (size_t) (slash - path) + 1);
+        dir[slash - path + 1] = '\0';
+        fd = open(dir, O_RDONLY);
+        free(dir);
+    }
+
+    if (fd < 0) {
+        return 0;
+    }
+
+    ok = fsync(fd) == 0;
+    close(fd);
+
+    return ok;
+}
+
+/**
+ * @brief Empties the journal and writes a fresh header for snapshot checksum `base`.
+ *
+ * @return 1 on success, 0 on an I/O error.
+ */
+static int resetJournal(DLLJournal* jr, uint64_t base) {
+    unsigned char header[DLL_JOURNAL_HEADER] = {0};
+    uint32_t version = DLL_JOURNAL_VERSION;
+
+    memcpy(header, "JDLL", 4);
+    memcpy(header + 4, &version, 4);
+    memcpy(header + 8, &base, 8);
+
+    if (ftruncate(jr->fd, 0) != 0 || !writeAllJournal(jr->fd, header, DLL_JOURNAL_HEADER) ||
+        fsync(jr->fd) != 0) {
+        return 0;
+    }
+
+    jr->committed = DLL_JOURNAL_HEADER;
+    jr->base = base;
+
+    return 1;
+}
+
+/**
+ * @brief Opens (or creates) the journal file for a list restored from snapshot checksum `base`.
+ *
+ * A journal written against a different snapshot was already folded into the current one by a
+ * compaction that crashed before emptying it, so it is reset rather than replayed.
+ *
+ * @return 1 on success, 0 on an I/O error or if the file is not a journal.
+ */
+static int openJournal(DLLJournal* jr, const char* path, uint64_t base) {
+    unsigned char header[DLL_JOURNAL_HEADER];
+    uint32_t version;
+    uint64_t stored;
+    struct stat st;
+
+    jr->fd = open(path, O_RDWR | O_CREAT | O_APPEND, 0644);
+
+    if (jr->fd < 0 || fstat(jr->fd, &st) != 0) {
+        return 0;
+    }
+
+    if (st.st_size < DLL_JOURNAL_HEADER) {
+        return resetJournal(jr, base);
+    }
+
+    if (pread(jr->fd, header, DLL_JOURNAL_HEADER, 0) != DLL_JOURNAL_HEADER || memcmp(header, "JDLL", 4) != 0) {
+        return 0;
+    }
+
+    memcpy(&version, header + 4, 4);
+    memcpy(&stored, header + 8, 8);
+
+    if (version != DLL_JOURNAL_VERSION) {
+        return 0;
+    }
+
+    if (stored != base) {
+        return resetJournal(jr, base);
+    }
+
+    jr->committed = (uint64_t) st.st_size;
+    jr->base = base;
+
+    return 1;
+}
+
+/**
+ * @brief Appends one encoded record to the pending group.
+ *
+ * @return 1 on success, 0 if the pending buffer could not grow.
+ */
+static int queueJournal(DLLJournal* jr, int op, int idx, const void* data, const void* target, size_t size) {
+    unsigned char* rec;
+    unsigned char* grown;
+    size_t capacity;
+    int32_t index = idx;
+    uint64_t check;
+
+    if (jr->pendingLen + DLL_JOURNAL_RECORD > jr->pendingCapacity) {
+        capacity = jr->pendingCapacity != 0 ? jr->pendingCapacity * 2 : DLL_JOURNAL_RECORD * 64;
+        grown = (unsigned char*) realloc(jr->pending, capacity);
+
+        if (grown == NULL) {
+            return 0;
+        }
+
+        jr->pending = grown;
+        jr->pendingCapacity = capacity;
+    }
+
+    rec = jr->pending + jr->pendingLen;
+    memset(rec, 0, DLL_JOURNAL_RECORD);
+    rec[0] = (unsigned char) op;
+    memcpy(rec + 4, &index, 4);
+    memcpy(rec + 8, data, size);
+    memcpy(rec + 16, target, size);
+    check = checksumRecord(rec);
+    memcpy(rec + 24, &check, 8);
+
+    jr->pendingLen += DLL_JOURNAL_RECORD;
+    jr->pendingOps++;
+
+    return 1;
+}
+
+/**
+ * @brief Group commit: writes every pending record with one write() and makes it durable with
+ *        one fsync().
+ *
+ * On failure the file is cut back to the last commit and the records stay pending, so a retry
+ * neither loses nor duplicates them.
+ *
+ * @return 1 on success (or nothing pending), 0 on an I/O error.
+ */
+static int commitJournal(DLLJournal* jr) {
+    if (jr->pendingLen == 0) {
+        return 1;
+    }
+
+    if (!writeAllJournal(jr->fd, jr->pending, jr->pendingLen) || fsync(jr->fd) != 0) {
+        while (ftruncate(jr->fd, (off_t) jr->committed) != 0 && errno == EINTR) {
+        }
+        return 0;
+    }
+
+    jr->committed += jr->pendingLen;
+    jr->pendingLen = 0;
+    jr->pendingOps = 0;
+
+    return 1;
+}
+
+static void closeJournal(DLLJournal* jr) {
+    if (jr->fd >= 0) {
+        close(jr->fd);
+    }
+
+    free(jr->pending);
+    free(jr->snapshotPath);
+    memset(jr, 0, sizeof(*jr));
+    jr->fd = -1;
+}
+// -------------------------------------------------------------------------------------------->
+// APPLY / REPLAY OF JOURNALED DLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief applyJournaledDLL() performs one recorded mutation with the dll.h functions, both
+ *        live and during replay. replayJournaledDLL() applies every valid record after the
+ *        header and truncates the journal at the first torn or corrupt one.
+ */
+#define JOURNALED_DLL_APPLY(type) \
+    static void applyJournaledDLL__##type(DLL__##type* dll, int op, int idx, type data, type target) { \
+        switch (op) { \
+            case JOURNAL_INSERT_HEAD: insertAtHead__##type(dll, data); break; \
+            case JOURNAL_INSERT_TAIL: insertAtTail__##type(dll, data); break; \
+            case JOURNAL_INSERT_AT: insertAt__##type(dll, data, idx); break; \
+            case JOURNAL_INSERT_AFTER: insertAfter__##type(dll, data, target); break; \
+            case JOURNAL_INSERT_BEFORE: insertBefore__##type(dll, data, target); break; \
+            case JOURNAL_DELETE_HEAD: deleteHead__##type(dll); break; \
+            case JOURNAL_DELETE: delete__##type(dll, data); break; \
+            case JOURNAL_DELETE_ALL: deleteAll__##type(dll, data); break; \
+            case JOURNAL_DELETE_AT: deleteAt__##type(dll, idx); break; \
+            case JOURNAL_UPDATE_AT: updateAt__##type(dll, idx, data); break; \
+            case JOURNAL_CLEAR: freeDLL__##type(dll); break; \
+            case JOURNAL_DELETE_TAIL: deleteTail__##type(dll); break; \
+            default: break; \
+        } \
+    } \
+    \
+    static int replayJournaledDLL__##type(JournaledDLL__##type* j) { \
+        unsigned char* buf = (unsigned char*) malloc(DLL_JOURNAL_RECORD * DLL_JOURNAL_BATCH); \
+        uint64_t offset = DLL_JOURNAL_HEADER; \
+        uint64_t check; \
+        ssize_t got; \
+        size_t i; \
+        int32_t idx; \
+        type data, target; \
+        int torn = 0; \
+        \
+        if (buf == NULL) { \
+            return 0; \
+        } \
+        \
+        while (!torn && offset < j->journal.committed) { \
+            got = pread(j->journal.fd, buf, DLL_JOURNAL_RECORD * DLL_JOURNAL_BATCH, (off_t) offset); \
+            \
+            if (got < 0 && errno == EINTR) { \
+                continue; \
+            } \
+            \
+            if (got < 0) { \
+                free(buf); \
+                return 0; \
+            } \
+            \
+            torn = got < DLL_JOURNAL_RECORD; \
+            \
+            for (i = 0; !torn && i + DLL_JOURNAL_RECORD <= (size_t) got; i += DLL_JOURNAL_RECORD) { \
+                memcpy(&check, buf + i + 24, 8); \
+                \
+                if (check != checksumRecord(buf + i)) { \
+                    torn = 1; \
+                    break; \
+                } \
+                \
+                memcpy(&idx, buf + i + 4, 4); \
+                memcpy(&data, buf + i + 8, sizeof(type)); \
+                memcpy(&target, buf + i + 16, sizeof(type)); \
+                applyJournaledDLL__##type(&j->list, buf[i], idx, data, target); \
+                offset += DLL_JOURNAL_RECORD; \
+            } \
+            \
+            torn = torn || (size_t) got % DLL_JOURNAL_RECORD != 0; \
+        } \
+        \
+        free(buf); \
+        \
+        if (offset < j->journal.committed) { \
+            if (ftruncate(j->journal.fd, (off_t) offset) != 0 || fsync(j->journal.fd) != 0) { \
+                return 0; \
+            } \
+            j->journal.committed = offset; \
+        } \
+        \
+        return 1; \
+    } \
+    \
+    static int mutateJournaledDLL__##type(JournaledDLL__##type* j, int op, int idx, type data, type target) { \
+        if (!queueJournal(&j->journal, op, idx, &data, &target, sizeof(type))) { \
+            return 0; \
+        } \
+        \
+        applyJournaledDLL__##type(&j->list, op, idx, data, target); \
+        \
+        return j->journal.pendingOps < j->journal.groupSize || commitJournal(&j->journal); \
+    } \
+
+JOURNALED_DLL_APPLY(int)
+JOURNALED_DLL_APPLY(float)
+JOURNALED_DLL_APPLY(char)
+JOURNALED_DLL_APPLY(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO OPEN JOURNALED DLL :             SNAPSHOT + REPLAY
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Restores the list from `snapshotPath` (if it exists) and replays `journalPath`.
+ *
+ * @param j Pointer to the journaled list.
+ * @param snapshotPath Binary snapshot written by compactJournaledDLL() (see dll_io.h).
+ * @param journalPath Journal file; created if missing.
+ * @param groupSize Mutations per automatic group commit; <= 1 commits every mutation.
+ *
+ * @return 1 on success, 0 if the snapshot is corrupt or a file cannot be opened. A missing
+ *         snapshot is not an error: the list then starts empty.
+ */
+#define JOURNALED_DLL_OPEN(type) \
+    int openJournaledDLL__##type(JournaledDLL__##type* j, const char* snapshotPath, const char* journalPath, int groupSize) { \
+        size_t len = strlen(snapshotPath); \
+        uint64_t base = 0; \
+        FILE* fp; \
+        int ok = 1; \
+        \
+        j->list.head = NULL; \
+        j->list.tail = NULL; \
+        j->list.size = 0; \
+        memset(&j->journal, 0, sizeof(j->journal)); \
+        j->journal.fd = -1; \
+        j->journal.groupSize = groupSize; \
+        j->journal.snapshotPath = (char*) malloc(len + 1); \
+        \
+        if (j->journal.snapshotPath == NULL) { \
+            return 0; \
+        } \
+        memcpy(j->journal.snapshotPath, snapshotPath, len + 1); \
+        \
+        fp = fopen(snapshotPath, "rb"); \
+        \
+        if (fp != NULL) { \
+            ok = loadDLL__##type(&j->list, fp) && fseek(fp, 24, SEEK_SET) == 0 && fread(&base, 8, 1, fp) == 1; \
+            fclose(fp); \
+        } else { \
+            ok = errno == ENOENT; \
+        } \
+        \
+        ok = ok && openJournal(&j->journal, journalPath, base) && replayJournaledDLL__##type(j); \
+        \
+        if (!ok) { \
+            freeDLL__##type(&j->list); \
+            closeJournal(&j->journal); \
+        } \
+        \
+        return ok; \
+    } \
+
+JOURNALED_DLL_OPEN(int)
+JOURNALED_DLL_OPEN(float)
+JOURNALED_DLL_OPEN(char)
+JOURNALED_DLL_OPEN(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO MUTATE JOURNALED DLL :           INSERT / DELETE / UPDATE / CLEAR
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Journaled versions of the dll.h mutations, with the same semantics.
+ *
+ * @param j Pointer to the journaled list.
+ *
+ * @return 1 on success, 0 if the record could not be queued (the list is left unchanged) or
+ *         if the group commit it triggered failed.
+ */
+#define JOURNALED_DLL_MUTATE(type) \
+    int insertAtHeadJournaledDLL__##type(JournaledDLL__##type* j, type data) { \
+        return mutateJournaledDLL__##type(j, JOURNAL_INSERT_HEAD, 0, data, (type) 0); \
+    } \
+    \
+    int insertAtTailJournaledDLL__##type(JournaledDLL__##type* j, type data) { \
+        return mutateJournaledDLL__##type(j, JOURNAL_INSERT_TAIL, 0, data, (type) 0); \
+    } \
+    \
+    int insertAtJournaledDLL__##type(JournaledDLL__##type* j, type data, int targetIdx) { \
+        return mutateJournaledDLL__##type(j, JOURNAL_INSERT_AT, targetIdx, data, (type) 0); \
+    } \
+    \
+    int insertAfterJournaledDLL__##type(JournaledDLL__##type* j, type data, type targetData) { \
+        return mutateJournaledDLL__##type(j, JOURNAL_INSERT_AFTER, 0, data, targetData); \
+    } \
+    \
+    int insertBeforeJournaledDLL__##type(JournaledDLL__##type* j, type data, type targetData) { \
+        return mutateJournaledDLL__##type(j, JOURNAL_INSERT_BEFORE, 0, data, targetData); \
+    } \
+    \
+    int deleteHeadJournaledDLL__##type(JournaledDLL__##type* j) { \
+        return mutateJournaledDLL__##type(j, JOURNAL_DELETE_HEAD, 0, (type) 0, (type) 0); \
+    } \
+    \
+    int deleteTailJournaledDLL__##type(JournaledDLL__##type* j) { \
+        return mutateJournaledDLL__##type(j, JOURNAL_DELETE_TAIL, 0, (type) 0, (type) 0); \
+    } \
+    \
+    int deleteJournaledDLL__##type(JournaledDLL__##type* j, type targetData) { \
+        return mutateJournaledDLL__##type(j, JOURNAL_DELETE, 0, targetData, (type) 0); \
+    } \
+    \
+    int deleteAllJournaledDLL__##type(JournaledDLL__##type* j, type targetData) { \
+        return mutateJournaledDLL__##type(j, JOURNAL_DELETE_ALL, 0, targetData, (type) 0); \
+    } \
+    \
+    int deleteAtJournaledDLL__##type(JournaledDLL__##type* j, int targetIdx) { \
+        return mutateJournaledDLL__##type(j, JOURNAL_DELETE_AT, targetIdx, (type) 0, (type) 0); \
+    } \
+    \
+    int updateAtJournaledDLL__##type(JournaledDLL__##type* j, int targetIdx, type newData) { \
+        return mutateJournaledDLL__##type(j, JOURNAL_UPDATE_AT, targetIdx, newData, (type) 0); \
+    } \
+    \
+    int clearJournaledDLL__##type(JournaledDLL__##type* j) { \
+        return mutateJournaledDLL__##type(j, JOURNAL_CLEAR, 0, (type) 0, (type) 0); \
+    } \
+
+JOURNALED_DLL_MUTATE(int)
+JOURNALED_DLL_MUTATE(float)
+JOURNALED_DLL_MUTATE(char)
+JOURNALED_DLL_MUTATE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO COMMIT / COMPACT / CLOSE JOURNALED DLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief commit forces the pending group to disk. compact writes the whole list to a temporary
+ *        snapshot, fsync()s it, renames it over the old one and then empties the journal. close
+ *        commits, closes the journal and frees the list.
+ *
+ * A crash at any point of a compaction is safe: until the rename the old snapshot and journal
+ * are untouched, and after it the journal no longer matches the new snapshot's checksum, so it
+ * is discarded on the next open instead of being applied twice.
+ *
+ * @param j Pointer to the journaled list.
+ *
+ * @return 1 on success, 0 on an I/O or allocation error.
+ */
+#define JOURNALED_DLL_COMMIT(type) \
+    int commitJournaledDLL__##type(JournaledDLL__##type* j) { \
+        return commitJournal(&j->journal); \
+    } \
+    \
+    int compactJournaledDLL__##type(JournaledDLL__##type* j) { \
+        size_t len = strlen(j->journal.snapshotPath); \
+        char* tmp = (char*) malloc(len + 5); \
+        uint64_t base = 0; \
+        FILE* fp; \
+        int ok = tmp != NULL && commitJournal(&j->journal); \
+        \
+        if (!ok) { \
+            free(tmp); \
+            return 0; \
+        } \
+        \
+        memcpy(tmp, j->journal.snapshotPath, len); \
+        memcpy(tmp + len, ".tmp", 5); \
+        \
+        fp = fopen(tmp, "w+b"); \
+        ok = fp != NULL && saveDLL__##type(&j->list, fp) && fflush(fp) == 0 && fsync(fileno(fp)) == 0 && \
+             fseek(fp, 24, SEEK_SET) == 0 && fread(&base, 8, 1, fp) == 1; \
+        ok = fp != NULL && fclose(fp) == 0 && ok; \
+        ok = ok && rename(tmp, j->journal.snapshotPath) == 0; \
+        \
+        if (!ok) { \
+            remove(tmp); \
+        } \
+        \
+        free(tmp); \
+        \
+        return ok && syncParentDirJournal(j->journal.snapshotPath) && resetJournal(&j->journal, base); \
+    } \
+    \
+    int closeJournaledDLL__##type(JournaledDLL__##type* j) { \
+        int ok = commitJournal(&j->journal); \
+        \
+        closeJournal(&j->journal); \
+        freeDLL__##type(&j->list); \
+        \
+        return ok; \
+    } \
+
+JOURNALED_DLL_COMMIT(int)
+JOURNALED_DLL_COMMIT(float)
+JOURNALED_DLL_COMMIT(char)
+JOURNALED_DLL_COMMIT(double)
@@ -0,0 +1,133 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_journal.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the doubly linked list with a write-ahead mutation journal.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef DLL_JOURNAL_H
+#define DLL_JOURNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "dll.h"
+
+/**
+ * @brief Size of one journal record, in bytes.
+ *
+ * | Offset | Size | Field                                          |
+ * |--------|------|------------------------------------------------|
+ * | 0      | 1    | operation code                                 |
+ * | 4      | 4    | index argument                                 |
+ * | 8      | 8    | data argument, zero padded                     |
+ * | 16     | 8    | target argument (insertAfter / insertBefore)   |
+ * | 24     | 8    | checksum of bytes 0..23                        |
+ *
+ * The journal file starts with a 16-byte header: magic `"JDLL"`, a format version and the
+ * checksum of the snapshot the records apply to (0 when there is no snapshot yet).
+ */
+#define DLL_JOURNAL_RECORD 32
+
+/**
+ * @brief Journal file state shared by every element type.
+ *
+ * - `pending`: records of mutations already applied in memory but not yet written (group commit).
+ * - `groupSize`: number of pending records that triggers an automatic commit (<= 1 commits every
+ *   mutation on its own).
+ * - `committed`: journal length covered by the last successful commit; a failed write is cut
+ *   back to it so later commits never land behind a torn record.
+ * - `base`: checksum of the snapshot the journal applies to.
+ */
+typedef struct {
+    int fd;
+    char* snapshotPath;
+    unsigned char* pending;
+    size_t pendingLen;
+    size_t pendingCapacity;
+    int pendingOps;
+    int groupSize;
+    uint64_t committed;
+    uint64_t base;
+} DLLJournal;
+
+/**
+ * @brief Macro to declare a journaled doubly linked list for a specific data type.
+ *
+ * `list` is an ordinary DLL and can be read directly with the dll.h functions. Every mutation
+ * must go through the journaled functions so it is recorded.
+ *
+ * @param type The data type for the journaled list.
+ */
+#define DECLARE_JOURNALED_DLL(type) \
+    typedef struct { \
+        DLL__##type list; \
+        DLLJournal journal; \
+    } JournaledDLL__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for journaled doubly linked list operations.
+ *
+ * A mutation is applied to `list` at once and queued in the journal. commitJournaledDLL()
+ * writes all queued records with one write() and one fsync(); this also happens automatically
+ * every `groupSize` mutations. On a crash, everything up to the last commit is recovered by
+ * openJournaledDLL(), which loads the snapshot and replays the journal. compactJournaledDLL()
+ * folds the journal into a fresh binary snapshot and empties it.
+ *
+ * Mutations return 1, or 0 if the commit they triggered failed (the mutation stays queued and
+ * is retried by the next commit).
+ *
+ * @param type The data type for the journaled list.
+ */
+#define JOURNALED_DLL_PROTO(type) \
+    int openJournaledDLL__##type(JournaledDLL__##type* j, const char* snapshotPath, const char* journalPath, int groupSize); \
+    int insertAtHeadJournaledDLL__##type(JournaledDLL__##type* j, type data); \
+    int insertAtTailJournaledDLL__##type(JournaledDLL__##type* j, type data); \
+    int insertAtJournaledDLL__##type(JournaledDLL__##type* j, type data, int targetIdx); \
+    int insertAfterJournaledDLL__##type(JournaledDLL__##type* j, type data, type targetData); \
+    int insertBeforeJournaledDLL__##type(JournaledDLL__##type* j, type data, type targetData); \
+    int deleteHeadJournaledDLL__##type(JournaledDLL__##type* j); \
+    int deleteTailJournaledDLL__##type(JournaledDLL__##type* j); \
+    int deleteJournaledDLL__##type(JournaledDLL__##type* j, type targetData); \
+    int deleteAllJournaledDLL__##type(JournaledDLL__##type* j, type targetData); \
+    int deleteAtJournaledDLL__##type(JournaledDLL__##type* j, int targetIdx); \
+    int updateAtJournaledDLL__##type(JournaledDLL__##type* j, int targetIdx, type newData); \
+    int clearJournaledDLL__##type(JournaledDLL__##type* j); \
+    int commitJournaledDLL__##type(JournaledDLL__##type* j); \
+    int compactJournaledDLL__##type(JournaledDLL__##type* j); \
+    int closeJournaledDLL__##type(JournaledDLL__##type* j); \
+
+// Declaration for int data type
+DECLARE_JOURNALED_DLL(int);
+// Declaration for float data type
+DECLARE_JOURNALED_DLL(float);
+// Declaration for char data type
+DECLARE_JOURNALED_DLL(char);
+// Declaration for double data type
+DECLARE_JOURNALED_DLL(double);
+
+JOURNALED_DLL_PROTO(int)
+JOURNALED_DLL_PROTO(float)
+JOURNALED_DLL_PROTO(char)
+JOURNALED_DLL_PROTO(double)
+
+// Macro aliases for function calls
+#define openJournaledDLL(j, snapshotPath, journalPath, groupSize, type) openJournaledDLL__##type(j, snapshotPath, journalPath, groupSize)
+#define insertAtHeadJournaledDLL(j, data, type) insertAtHeadJournaledDLL__##type(j, data)
+#define insertAtTailJournaledDLL(j, data, type) insertAtTailJournaledDLL__##type(j, data)
+#define insertAtJournaledDLL(j, data, targetIdx, type) insertAtJournaledDLL__##type(j, data, targetIdx)
+#define insertAfterJournaledDLL(j, data, targetData, type) insertAfterJournaledDLL__##type(j, data, targetData)
+#define insertBeforeJournaledDLL(j, data, targetData, type) insertBeforeJournaledDLL__##type(j, data, targetData)
+#define deleteHeadJournaledDLL(j, type) deleteHeadJournaledDLL__##type(j)
+#define deleteTailJournaledDLL(j, type) deleteTailJournaledDLL__##type(j)
+#define deleteJournaledDLL(j, targetData, type) deleteJournaledDLL__##type(j, targetData)
+#define deleteAllJournaledDLL(j, targetData, type) deleteAllJournaledDLL__##type(j, targetData)
+#define deleteAtJournaledDLL(j, targetIdx, type) deleteAtJournaledDLL__##type(j, targetIdx)
+#define updateAtJournaledDLL(j, targetIdx, newData, type) updateAtJournaledDLL__##type(j, targetIdx, newData)
+#define clearJournaledDLL(j, type) clearJournaledDLL__##type(j)
+#define commitJournaledDLL(j, type) commitJournaledDLL__##type(j)
+#define compactJournaledDLL(j, type) compactJournaledDLL__##type(j)
+#define closeJournaledDLL(j, type) closeJournaledDLL__##type(j)
+
+
+#endif /* DLL_JOURNAL_H */
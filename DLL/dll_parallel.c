@@ -0,0 +1,724 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_parallel.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the dll_parallel.h header file containing the parallel bulk operations
+ *          over doubly linked lists.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "dll_parallel.h"
+
+// -------------------------------------------------------------------------------------------->
+// SEGMENT BOOKKEEPING FOR PARALLEL DLL OPERATIONS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Describes one contiguous run of nodes and the result computed for it.
+ *
+ * `first` / `last` / `count` describe the run. The remaining fields carry the operation's input
+ * (`targetData`, `keep`, `fn`, `out`) and output (`hits`, `sum`, `best`). During the merge rounds
+ * of parallelSortDLL() `hits` holds the distance to the segment being merged in.
+ */
+#define DLL_SEGMENT(type) \
+    typedef struct { \
+        struct DLLNode__##type* first; \
+        struct DLLNode__##type* last; \
+        int count; \
+        int offset; \
+        type targetData; \
+        int (*keep)(type); \
+        type (*fn)(type); \
+        type* out; \
+        int hits; \
+        double sum; \
+        type best; \
+    } DLLSegment__##type; \
+
+DLL_SEGMENT(int)
+DLL_SEGMENT(float)
+DLL_SEGMENT(char)
+DLL_SEGMENT(double)
+
+/**
+ * @brief Chooses how many segments a list of `size` nodes is cut into.
+ *
+ * @param size Number of nodes in the list.
+ * @param pool Pool that will run the segments, or NULL.
+ *
+ * @return A value between 1 and the pool's thread count.
+ */
+static int segmentCount(int size, ThreadPool* pool) {
+    int k;
+
+    if (pool == NULL || pool->threadCount <= 1) {
+        return 1;
+    }
+
+    k = size / PARALLEL_MIN_SEGMENT;
+
+    if (k > pool->threadCount) {
+        k = pool->threadCount;
+    }
+
+    return k < 1 ? 1 : k;
+}
+
+/**
+ * @brief Runs `task` once per segment and returns when all of them have finished.
+ *
+ * A single segment is processed on the calling thread without touching the pool.
+ *
+ * @param segs Array of segment structures.
+ * @param segSize Size of one segment structure in bytes.
+ * @param k Number of segments.
+ * @param task Per-segment work.
+ * @param pool Pool used when `k` is greater than one.
+ */
+static void runSegments(void* segs, size_t segSize, int k, ThreadTask task, ThreadPool* pool) {
+    int i;
+
+    if (k == 1) {
+        task(segs);
+        return;
+    }
+
+    for (i = 0; i < k; i++) {
+        if (!submitThreadPool(pool, task, (char*) segs + i * segSize)) {
+            task((char*) segs + i * segSize);
+        }
+    }
+
+    waitThreadPool(pool);
+}
+
+/**
+ * @brief Cuts the list into `k` nearly equal segments in a single walk.
+ *
+ * @param dll Pointer to the doubly linked list structure.
+ * @param k Number of segments to produce.
+ *
+ * @return A calloc'd array of `k` segments, or NULL if the allocation failed.
+ *
+ * @note Only `first`, `last`, `count` and `offset` are filled in; the links between segments are
+ *       left untouched.
+ */
+#define DLL_SPLIT(type) \
+    static DLLSegment__##type* splitDLL__##type(DLL__##type* dll, int k) { \
+        DLLSegment__##type* segs = (DLLSegment__##type*) calloc(k, sizeof(DLLSegment__##type)); \
+        struct DLLNode__##type* itr = dll->head; \
+        int offset = 0; \
+        int i, j; \
+        \
+        if (segs == NULL) { \
+            return NULL; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].count = dll->size / k + (i < dll->size % k ? 1 : 0); \
+            segs[i].offset = offset; \
+            segs[i].first = itr; \
+            \
+            for (j = 1; j < segs[i].count; j++) { \
+                itr = itr->next; \
+            } \
+            \
+            segs[i].last = segs[i].count > 0 ? itr : NULL; \
+            itr = segs[i].count > 0 ? itr->next : itr; \
+            offset += segs[i].count; \
+        } \
+        \
+        return segs; \
+    } \
+
+DLL_SPLIT(int)
+DLL_SPLIT(float)
+DLL_SPLIT(char)
+DLL_SPLIT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO COUNT DATA OF DLL :              PARALLEL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Counts the nodes whose data equals `targetData`.
+ *
+ * @param dll Pointer to the doubly linked list structure.
+ * @param targetData The value to count.
+ * @param pool Thread pool to run the segments on, or NULL.
+ *
+ * @return The number of matching nodes, or -1 if the segment table could not be allocated.
+ */
+#define DLL_PARALLEL_COUNT(type) \
+    static void countTaskDLL__##type(void* arg) { \
+        DLLSegment__##type* seg = (DLLSegment__##type*) arg; \
+        struct DLLNode__##type* itr = seg->first; \
+        int i; \
+        \
+        for (i = 0; i < seg->count; i++, itr = itr->next) { \
+            seg->hits += itr->data == seg->targetData; \
+        } \
+    } \
+    \
+    int parallelCountDLL__##type(DLL__##type* dll, type targetData, ThreadPool* pool) { \
+        int k = segmentCount(dll->size, pool); \
+        DLLSegment__##type* segs = splitDLL__##type(dll, k); \
+        int total = 0; \
+        int i; \
+        \
+        if (segs == NULL) { \
+            return -1; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].targetData = targetData; \
+        } \
+        \
+        runSegments(segs, sizeof(DLLSegment__##type), k, countTaskDLL__##type, pool); \
+        \
+        for (i = 0; i < k; i++) { \
+            total += segs[i].hits; \
+        } \
+        \
+        free(segs); \
+        \
+        return total; \
+    } \
+
+DLL_PARALLEL_COUNT(int)
+DLL_PARALLEL_COUNT(float)
+DLL_PARALLEL_COUNT(char)
+DLL_PARALLEL_COUNT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO SEARCH DATA OF DLL :             PARALLEL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Finds the index of the first node whose data equals `targetData`.
+ *
+ * Each segment stops at its own first match; the earliest segment with a match wins.
+ *
+ * @param dll Pointer to the doubly linked list structure.
+ * @param targetData The value to search for.
+ * @param pool Thread pool to run the segments on, or NULL.
+ *
+ * @return The index of the first match, or -1 if there is none.
+ */
+#define DLL_PARALLEL_INDEX_OF(type) \
+    static void indexOfTaskDLL__##type(void* arg) { \
+        DLLSegment__##type* seg = (DLLSegment__##type*) arg; \
+        struct DLLNode__##type* itr = seg->first; \
+        int i; \
+        \
+        seg->hits = -1; \
+        \
+        for (i = 0; i < seg->count; i++, itr = itr->next) { \
+            if (itr->data == seg->targetData) { \
+                seg->hits = seg->offset + i; \
+                return; \
+            } \
+        } \
+    } \
+    \
+    int parallelIndexOfDLL__##type(DLL__##type* dll, type targetData, ThreadPool* pool) { \
+        int k = segmentCount(dll->size, pool); \
+        DLLSegment__##type* segs = splitDLL__##type(dll, k); \
+        int found = -1; \
+        int i; \
+        \
+        if (segs == NULL) { \
+            return -1; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].targetData = targetData; \
+        } \
+        \
+        runSegments(segs, sizeof(DLLSegment__##type), k, indexOfTaskDLL__##type, pool); \
+        \
+        for (i = 0; i < k && found == -1; i++) { \
+            found = segs[i].hits; \
+        } \
+        \
+        free(segs); \
+        \
+        return found; \
+    } \
+
+DLL_PARALLEL_INDEX_OF(int)
+DLL_PARALLEL_INDEX_OF(float)
+DLL_PARALLEL_INDEX_OF(char)
+DLL_PARALLEL_INDEX_OF(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO REDUCE DATA OF DLL :             SUM
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Adds up every element of the list.
+ *
+ * @param dll Pointer to the doubly linked list structure.
+ * @param pool Thread pool to run the segments on, or NULL.
+ *
+ * @return The sum as a double (0 for an empty list or a failed allocation).
+ */
+#define DLL_PARALLEL_SUM(type) \
+    static void sumTaskDLL__##type(void* arg) { \
+        DLLSegment__##type* seg = (DLLSegment__##type*) arg; \
+        struct DLLNode__##type* itr = seg->first; \
+        int i; \
+        \
+        for (i = 0; i < seg->count; i++, itr = itr->next) { \
+            seg->sum += itr->data; \
+        } \
+    } \
+    \
+    double parallelSumDLL__##type(DLL__##type* dll, ThreadPool* pool) { \
+        int k = segmentCount(dll->size, pool); \
+        DLLSegment__##type* segs = splitDLL__##type(dll, k); \
+        double total = 0; \
+        int i; \
+        \
+        if (segs == NULL) { \
+            return 0; \
+        } \
+        \
+        runSegments(segs, sizeof(DLLSegment__##type), k, sumTaskDLL__##type, pool); \
+        \
+        for (i = 0; i < k; i++) { \
+            total += segs[i].sum; \
+        } \
+        \
+        free(segs); \
+        \
+        return total; \
+    } \
+
+DLL_PARALLEL_SUM(int)
+DLL_PARALLEL_SUM(float)
+DLL_PARALLEL_SUM(char)
+DLL_PARALLEL_SUM(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO REDUCE DATA OF DLL :             MIN / MAX
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Returns the smallest (or largest) element of the list.
+ *
+ * @param dll Pointer to the doubly linked list structure.
+ * @param data404Response Value returned when the list is empty.
+ * @param pool Thread pool to run the segments on, or NULL.
+ *
+ * @return The minimum (or maximum) element, or `data404Response`.
+ */
+#define DLL_PARALLEL_EXTREMUM(type, name, op) \
+    static void name##TaskDLL__##type(void* arg) { \
+        DLLSegment__##type* seg = (DLLSegment__##type*) arg; \
+        struct DLLNode__##type* itr = seg->first; \
+        int i; \
+        \
+        seg->best = itr->data; \
+        \
+        for (i = 0; i < seg->count; i++, itr = itr->next) { \
+            if (itr->data op seg->best) { \
+                seg->best = itr->data; \
+            } \
+        } \
+    } \
+    \
+    type parallel##name##DLL__##type(DLL__##type* dll, type data404Response, ThreadPool* pool) { \
+        int k; \
+        DLLSegment__##type* segs; \
+        type best; \
+        int i; \
+        \
+        if (dll->size == 0) { \
+            return data404Response; \
+        } \
+        \
+        k = segmentCount(dll->size, pool); \
+        segs = splitDLL__##type(dll, k); \
+        \
+        if (segs == NULL) { \
+            return data404Response; \
+        } \
+        \
+        runSegments(segs, sizeof(DLLSegment__##type), k, name##TaskDLL__##type, pool); \
+        best = segs[0].best; \
+        \
+        for (i = 1; i < k; i++) { \
+            if (segs[i].best op best) { \
+                best = segs[i].best; \
+            } \
+        } \
+        \
+        free(segs); \
+        \
+        return best; \
+    } \
+
+DLL_PARALLEL_EXTREMUM(int, Min, <)
+DLL_PARALLEL_EXTREMUM(float, Min, <)
+DLL_PARALLEL_EXTREMUM(char, Min, <)
+DLL_PARALLEL_EXTREMUM(double, Min, <)
+DLL_PARALLEL_EXTREMUM(int, Max, >)
+DLL_PARALLEL_EXTREMUM(float, Max, >)
+DLL_PARALLEL_EXTREMUM(char, Max, >)
+DLL_PARALLEL_EXTREMUM(double, Max, >)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO UPDATE DATA OF DLL :             MAP IN PLACE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Replaces every element `x` with `fn(x)`.
+ *
+ * @param dll Pointer to the doubly linked list structure.
+ * @param fn Pure function applied to each element; it is called concurrently from several threads.
+ * @param pool Thread pool to run the segments on, or NULL.
+ */
+#define DLL_PARALLEL_MAP(type) \
+    static void mapTaskDLL__##type(void* arg) { \
+        DLLSegment__##type* seg = (DLLSegment__##type*) arg; \
+        struct DLLNode__##type* itr = seg->first; \
+        int i; \
+        \
+        for (i = 0; i < seg->count; i++, itr = itr->next) { \
+            itr->data = seg->fn(itr->data); \
+        } \
+    } \
+    \
+    void parallelMapDLL__##type(DLL__##type* dll, type (*fn)(type), ThreadPool* pool) { \
+        int k = segmentCount(dll->size, pool); \
+        DLLSegment__##type* segs = splitDLL__##type(dll, k); \
+        int i; \
+        \
+        if (segs == NULL) { \
+            return; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].fn = fn; \
+        } \
+        \
+        runSegments(segs, sizeof(DLLSegment__##type), k, mapTaskDLL__##type, pool); \
+        free(segs); \
+    } \
+
+DLL_PARALLEL_MAP(int)
+DLL_PARALLEL_MAP(float)
+DLL_PARALLEL_MAP(char)
+DLL_PARALLEL_MAP(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DELETE DATA OF DLL :             FILTER / DELETE ALL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes and frees every node that fails the predicate.
+ *
+ * Each segment relinks its own survivors (both `next` and `prev`), so no two threads ever write
+ * the same node. The surviving runs are then spliced together in O(k) and `head`, `tail` and
+ * `size` are recomputed.
+ * parallelDeleteAllDLL() is the same pass with the predicate `data != targetData`.
+ *
+ * @param dll Pointer to the doubly linked list structure.
+ * @param keep Predicate returning non-zero for nodes that must stay; called concurrently.
+ * @param pool Thread pool to run the segments on, or NULL.
+ */
+#define DLL_PARALLEL_FILTER(type) \
+    static void filterTaskDLL__##type(void* arg) { \
+        DLLSegment__##type* seg = (DLLSegment__##type*) arg; \
+        struct DLLNode__##type* itr = seg->first; \
+        struct DLLNode__##type* keptFirst = NULL; \
+        struct DLLNode__##type* keptLast = NULL; \
+        struct DLLNode__##type* next; \
+        int i; \
+        \
+        for (i = 0; i < seg->count; i++, itr = next) { \
+            next = itr->next; \
+            \
+            if (seg->keep != NULL ? seg->keep(itr->data) : itr->data != seg->targetData) { \
+                if (keptLast == NULL) { \
+                    keptFirst = itr; \
+                } else { \
+                    keptLast->next = itr; \
+                } \
+                itr->prev = keptLast; \
+                keptLast = itr; \
+                seg->hits++; \
+            } else { \
+                free(itr); \
+            } \
+        } \
+        \
+        seg->first = keptFirst; \
+        seg->last = keptLast; \
+    } \
+    \
+    static void filterDLL__##type(DLL__##type* dll, int (*keep)(type), type targetData, ThreadPool* pool) { \
+        int k = segmentCount(dll->size, pool); \
+        DLLSegment__##type* segs = splitDLL__##type(dll, k); \
+        struct DLLNode__##type* last = NULL; \
+        int i; \
+        \
+        if (segs == NULL) { \
+            return; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].keep = keep; \
+            segs[i].targetData = targetData; \
+        } \
+        \
+        runSegments(segs, sizeof(DLLSegment__##type), k, filterTaskDLL__##type, pool); \
+        \
+        dll->head = NULL; \
+        dll->size = 0; \
+        \
+        for (i = 0; i < k; i++) { \
+            if (segs[i].first == NULL) { \
+                continue; \
+            } \
+            \
+            if (last == NULL) { \
+                dll->head = segs[i].first; \
+            } else { \
+                last->next = segs[i].first; \
+            } \
+            \
+            segs[i].first->prev = last; \
+            \
+            last = segs[i].last; \
+            dll->size += segs[i].hits; \
+        } \
+        \
+        if (last != NULL) { \
+            last->next = NULL; \
+        } \
+        \
+        dll->tail = last; \
+        free(segs); \
+    } \
+    \
+    void parallelFilterDLL__##type(DLL__##type* dll, int (*keep)(type), ThreadPool* pool) { \
+        filterDLL__##type(dll, keep, (type) 0, pool); \
+    } \
+    \
+    void parallelDeleteAllDLL__##type(DLL__##type* dll, type targetData, ThreadPool* pool) { \
+        filterDLL__##type(dll, NULL, targetData, pool); \
+    } \
+
+DLL_PARALLEL_FILTER(int)
+DLL_PARALLEL_FILTER(float)
+DLL_PARALLEL_FILTER(char)
+DLL_PARALLEL_FILTER(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO COPY DATA OF DLL :               TO ARRAY
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Copies the list into a caller-provided array, each segment writing its own slice.
+ *
+ * @param dll Pointer to the doubly linked list structure.
+ * @param out Destination array with room for `dll->size` elements.
+ * @param pool Thread pool to run the segments on, or NULL.
+ *
+ * @return The number of elements written, or -1 if the segment table could not be allocated.
+ */
+#define DLL_PARALLEL_TO_ARRAY(type) \
+    static void toArrayTaskDLL__##type(void* arg) { \
+        DLLSegment__##type* seg = (DLLSegment__##type*) arg; \
+        struct DLLNode__##type* itr = seg->first; \
+        type* dst = seg->out + seg->offset; \
+        int i; \
+        \
+        for (i = 0; i < seg->count; i++, itr = itr->next) { \
+            dst[i] = itr->data; \
+        } \
+    } \
+    \
+    int parallelToArrayDLL__##type(DLL__##type* dll, type* out, ThreadPool* pool) { \
+        int k = segmentCount(dll->size, pool); \
+        DLLSegment__##type* segs = splitDLL__##type(dll, k); \
+        int i; \
+        \
+        if (segs == NULL) { \
+            return -1; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].out = out; \
+        } \
+        \
+        runSegments(segs, sizeof(DLLSegment__##type), k, toArrayTaskDLL__##type, pool); \
+        free(segs); \
+        \
+        return dll->size; \
+    } \
+
+DLL_PARALLEL_TO_ARRAY(int)
+DLL_PARALLEL_TO_ARRAY(float)
+DLL_PARALLEL_TO_ARRAY(char)
+DLL_PARALLEL_TO_ARRAY(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO SORT DLL :                       PARALLEL MERGE SORT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Merges two NULL-terminated sorted runs by relinking their nodes.
+ *
+ * Ties are taken from `a` first, so merging an earlier run into `a` keeps the sort stable.
+ * `prev` pointers are rewritten as nodes are linked, so a run is always a valid doubly linked
+ * chain whose first node has a NULL `prev`.
+ *
+ * @param a First sorted run.
+ * @param b Second sorted run.
+ * @param tail Receives the last node of the merged run.
+ *
+ * @return The first node of the merged run.
+ */
+#define DLL_MERGE_RUNS(type) \
+    static struct DLLNode__##type* mergeRunsDLL__##type(struct DLLNode__##type* a, struct DLLNode__##type* b, struct DLLNode__##type** tail) { \
+        struct DLLNode__##type dummy; \
+        struct DLLNode__##type* last = &dummy; \
+        \
+        while (a != NULL && b != NULL) { \
+            if (b->data < a->data) { \
+                last->next = b; \
+                b = b->next; \
+            } else { \
+                last->next = a; \
+                a = a->next; \
+            } \
+            last->next->prev = last; \
+            last = last->next; \
+        } \
+        \
+        last->next = a != NULL ? a : b; \
+        \
+        if (last->next != NULL) { \
+            last->next->prev = last; \
+        } \
+        \
+        if (dummy.next != NULL) { \
+            dummy.next->prev = NULL; \
+        } \
+        \
+        if (tail != NULL) { \
+            while (last->next != NULL) { \
+                last = last->next; \
+            } \
+            *tail = last; \
+        } \
+        \
+        return dummy.next; \
+    } \
+
+DLL_MERGE_RUNS(int)
+DLL_MERGE_RUNS(float)
+DLL_MERGE_RUNS(char)
+DLL_MERGE_RUNS(double)
+
+/**
+ * @brief Sorts the list in ascending order using every worker of the pool.
+ *
+ * 1. The list is cut into one segment per worker and each segment is detached.
+ * 2. Every worker sorts its segment with a bottom-up merge sort that keeps sorted runs in a
+ *    fixed array of 64 bins (run `i` holds 2^i nodes), so no memory is allocated.
+ * 3. Neighbouring segments are merged pairwise in rounds, each round running its merges in
+ *    parallel, until one run is left.
+ * 4. `head` and `tail` are taken from the final run; `prev` pointers are already correct because
+ *    every merge rewrites them.
+ *
+ * Only the O(threads) segment table is allocated; all nodes are relinked in place and the sort
+ * is stable.
+ *
+ * @param dll Pointer to the doubly linked list structure.
+ * @param pool Thread pool to run the segments on, or NULL to sort on the calling thread.
+ *
+ * @note The last merge round is a single sequential merge of two halves, so the speed-up is
+ *       bounded by that final O(n) pass.
+ */
+#define DLL_PARALLEL_SORT(type) \
+    static void sortTaskDLL__##type(void* arg) { \
+        DLLSegment__##type* seg = (DLLSegment__##type*) arg; \
+        struct DLLNode__##type* bins[64] = {NULL}; \
+        struct DLLNode__##type* itr = seg->first; \
+        struct DLLNode__##type* run; \
+        struct DLLNode__##type* sorted = NULL; \
+        int maxBin = 0; \
+        int i; \
+        \
+        while (itr != NULL) { \
+            run = itr; \
+            itr = itr->next; \
+            run->next = NULL; \
+            \
+            for (i = 0; bins[i] != NULL; i++) { \
+                run = mergeRunsDLL__##type(bins[i], run, NULL); \
+                bins[i] = NULL; \
+            } \
+            \
+            bins[i] = run; \
+            \
+            if (i >= maxBin) { \
+                maxBin = i + 1; \
+            } \
+        } \
+        \
+        for (i = 0; i < maxBin; i++) { \
+            if (bins[i] != NULL) { \
+                sorted = sorted == NULL ? bins[i] : mergeRunsDLL__##type(bins[i], sorted, NULL); \
+            } \
+        } \
+        \
+        sorted->prev = NULL; \
+        seg->first = sorted; \
+        seg->last = sorted; \
+        \
+        while (seg->last != NULL && seg->last->next != NULL) { \
+            seg->last = seg->last->next; \
+        } \
+    } \
+    \
+    static void mergeTaskDLL__##type(void* arg) { \
+        DLLSegment__##type* left = (DLLSegment__##type*) arg; \
+        DLLSegment__##type* right = left + left->hits; \
+        \
+        left->first = mergeRunsDLL__##type(left->first, right->first, &left->last); \
+    } \
+    \
+    void parallelSortDLL__##type(DLL__##type* dll, ThreadPool* pool) { \
+        int k = segmentCount(dll->size, pool); \
+        DLLSegment__##type* segs; \
+        int width, i; \
+        \
+        if (dll->size < 2) { \
+            return; \
+        } \
+        \
+        segs = splitDLL__##type(dll, k); \
+        \
+        if (segs == NULL) { \
+            return; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].last->next = NULL; \
+        } \
+        \
+        runSegments(segs, sizeof(DLLSegment__##type), k, sortTaskDLL__##type, pool); \
+        \
+        for (width = 1; width < k; width *= 2) { \
+            for (i = 0; i + width < k; i += 2 * width) { \
+                segs[i].hits = width; \
+                \
+                if (k <= 2 * width) { \
+                    mergeTaskDLL__##type(&segs[i]); \
+                } else if (!submitThreadPool(pool, mergeTaskDLL__##type, &segs[i])) { \
+                    mergeTaskDLL__##type(&segs[i]); \
+                } \
+            } \
+            \
+            if (k > 2 * width) { \
+                waitThreadPool(pool); \
+            } \
+        } \
+        \
+        dll->head = segs[0].first; \
+        dll->tail = segs[0].last; \
+        free(segs); \
+    } \
+
+DLL_PARALLEL_SORT(int)
+DLL_PARALLEL_SORT(float)
+DLL_PARALLEL_SORT(char)
+DLL_PARALLEL_SORT(double)
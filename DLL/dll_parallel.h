@@ -0,0 +1,66 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_parallel.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the parallel bulk operations over doubly linked lists.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef DLL_PARALLEL_H
+#define DLL_PARALLEL_H
+
+#include "dll.h"
+#include "../TPOOL/tpool.h"
+
+/**
+ * @brief Smallest number of nodes worth handing to a separate worker.
+ *
+ * Lists shorter than two segments of this size are processed on the calling thread.
+ */
+#ifndef PARALLEL_MIN_SEGMENT
+#define PARALLEL_MIN_SEGMENT 16384
+#endif
+
+/**
+ * @brief Macro to declare function prototypes for parallel doubly linked list operations.
+ *
+ * Every operation cuts the list into at most `pool->threadCount` contiguous segments in one walk,
+ * runs the per-segment work on the pool and then combines the per-segment results. Operations
+ * that remove nodes stitch the surviving segments back together with O(1) splices.
+ *
+ * @param type The data type for the doubly linked list.
+ *
+ * @note The list must not be modified by other threads while an operation is running. Passing a
+ *       NULL pool runs the operation on the calling thread.
+ */
+#define DLL_PARALLEL_PROTO(type) \
+    int parallelCountDLL__##type(DLL__##type* dll, type targetData, ThreadPool* pool); \
+    int parallelIndexOfDLL__##type(DLL__##type* dll, type targetData, ThreadPool* pool); \
+    double parallelSumDLL__##type(DLL__##type* dll, ThreadPool* pool); \
+    type parallelMinDLL__##type(DLL__##type* dll, type data404Response, ThreadPool* pool); \
+    type parallelMaxDLL__##type(DLL__##type* dll, type data404Response, ThreadPool* pool); \
+    void parallelMapDLL__##type(DLL__##type* dll, type (*fn)(type), ThreadPool* pool); \
+    void parallelFilterDLL__##type(DLL__##type* dll, int (*keep)(type), ThreadPool* pool); \
+    void parallelDeleteAllDLL__##type(DLL__##type* dll, type targetData, ThreadPool* pool); \
+    int parallelToArrayDLL__##type(DLL__##type* dll, type* out, ThreadPool* pool); \
+    void parallelSortDLL__##type(DLL__##type* dll, ThreadPool* pool); \
+
+DLL_PARALLEL_PROTO(int)
+DLL_PARALLEL_PROTO(float)
+DLL_PARALLEL_PROTO(char)
+DLL_PARALLEL_PROTO(double)
+
+// Macro aliases for function calls
+#define parallelCountDLL(dll, targetData, pool, type) parallelCountDLL__##type(dll, targetData, pool)
+#define parallelIndexOfDLL(dll, targetData, pool, type) parallelIndexOfDLL__##type(dll, targetData, pool)
+#define parallelSumDLL(dll, pool, type) parallelSumDLL__##type(dll, pool)
+#define parallelMinDLL(dll, data404Response, pool, type) parallelMinDLL__##type(dll, data404Response, pool)
+#define parallelMaxDLL(dll, data404Response, pool, type) parallelMaxDLL__##type(dll, data404Response, pool)
+#define parallelMapDLL(dll, fn, pool, type) parallelMapDLL__##type(dll, fn, pool)
+#define parallelFilterDLL(dll, keep, pool, type) parallelFilterDLL__##type(dll, keep, pool)
+#define parallelDeleteAllDLL(dll, targetData, pool, type) parallelDeleteAllDLL__##type(dll, targetData, pool)
+#define parallelSortDLL(dll, pool, type) parallelSortDLL__##type(dll, pool)
+#define parallelToArrayDLL(dll, out, pool, type) parallelToArrayDLL__##type(dll, out, pool)
+
+
+#endif /* DLL_PARALLEL_H */
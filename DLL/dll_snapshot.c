@@ -0,0 +1,483 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_snapshot.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the dll_snapshot.h header file containing the versioned doubly linked
+ *          list implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include <sched.h>
+#include "dll_snapshot.h"
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE VERSIONED DLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Initializes an empty versioned list.
+ *
+ * @param v Pointer to the versioned list structure.
+ *
+ * @return 1 on success, 0 if the writer lock could not be created.
+ */
+#define VERSIONED_DLL_INIT(type) \
+    int initVersionedDLL__##type(VersionedDLL__##type* v) { \
+        int i; \
+        \
+        v->list.head = NULL; \
+        v->list.tail = NULL; \
+        v->list.size = 0; \
+        v->retiredHead = NULL; \
+        v->retiredTail = NULL; \
+        atomic_init(&v->version, 0); \
+        atomic_init(&v->nextReader, 0); \
+        \
+        for (i = 0; i < VERSIONED_DLL_MAX_READERS; i++) { \
+            atomic_init(&v->readerSince[i], 0); \
+        } \
+        \
+        return pthread_mutex_init(&v->writeLock, NULL) == 0; \
+    } \
+
+VERSIONED_DLL_INIT(int)
+VERSIONED_DLL_INIT(float)
+VERSIONED_DLL_INIT(char)
+VERSIONED_DLL_INIT(double)
+// -------------------------------------------------------------------------------------------->
+// WRITER HELPERS OF VERSIONED DLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Writer-side building blocks shared by every mutation.
+ *
+ * - beginWrite takes the writer lock and makes the version odd.
+ * - endWrite makes the version even again and frees every retired node stamped no later than
+ *   the oldest version published in `readerSince`. The version bump and the slot loads are
+ *   sequentially consistent, so a reader whose slot the scan missed can only have loaded the
+ *   new version and can only see the list without the retired nodes.
+ * - linkAfter fully initialises a new node and issues a release fence before linking it, so a
+ *   concurrent reader that reaches the node never sees uninitialised links. It returns 0 if the
+ *   node cannot be allocated.
+ * - retire unlinks a node but leaves its own `prev` / `next` untouched, so a reader standing on
+ *   it can still walk off it, and queues it stamped with the version this write ends at.
+ * - nodeAt walks from whichever end is closer.
+ */
+#define VERSIONED_DLL_HELPERS(type) \
+    static void beginWriteVersionedDLL__##type(VersionedDLL__##type* v) { \
+        pthread_mutex_lock(&v->writeLock); \
+        atomic_fetch_add(&v->version, 1); \
+    } \
+    \
+    static void endWriteVersionedDLL__##type(VersionedDLL__##type* v) { \
+        struct VersionedDLLNode__##type* retired; \
+        unsigned long oldest = atomic_fetch_add(&v->version, 1) + 1; \
+        unsigned long since; \
+        int i; \
+        \
+        if (v->retiredHead != NULL) { \
+            for (i = 0; i < VERSIONED_DLL_MAX_READERS; i++) { \
+                since = atomic_load(&v->readerSince[i]); \
+                \
+                if (since != 0 && since - 1 < oldest) { \
+                    oldest = since - 1; \
+                } \
+            } \
+            \
+            while (v->retiredHead != NULL && v->retiredHead->retiredAt <= oldest) { \
+                retired = v->retiredHead; \
+                v->retiredHead = retired->nextRetired; \
+                free(retired); \
+            } \
+            \
+            if (v->retiredHead == NULL) { \
+                v->retiredTail = NULL; \
+            } \
+        } \
+        \
+        pthread_mutex_unlock(&v->writeLock); \
+    } \
+    \
+    static int linkAfterVersionedDLL__##type(VersionedDLL__##type* v, struct DLLNode__##type* after, type data) { \
+        struct VersionedDLLNode__##type* wrapper; \
+        struct DLLNode__##type* node; \
+        \
+        wrapper = (struct VersionedDLLNode__##type*) malloc(sizeof(struct VersionedDLLNode__##type)); \
+        \
+        if (wrapper == NULL) { \
+            return 0; \
+        } \
+        \
+        node = &wrapper->node; \
+        node->data = data; \
+        node->prev = after; \
+        node->next = after == NULL ? v->list.head : after->next; \
+        atomic_thread_fence(memory_order_release); \
+        \
+        if (node->next != NULL) { \
+            node->next->prev = node; \
+        } else { \
+            v->list.tail = node; \
+        } \
+        \
+        if (after != NULL) { \
+            after->next = node; \
+        } else { \
+            v->list.head = node; \
+        } \
+        \
+        v->list.size++; \
+        \
+        return 1; \
+    } \
+    \
+    static void retireVersionedDLL__##type(VersionedDLL__##type* v, struct DLLNode__##type* node) { \
+        struct VersionedDLLNode__##type* wrapper = (struct VersionedDLLNode__##type*) node; \
+        \
+        if (node->prev != NULL) { \
+            node->prev->next = node->next; \
+        } else { \
+            v->list.head = node->next; \
+        } \
+        \
+        if (node->next != NULL) { \
+            node->next->prev = node->prev; \
+        } else { \
+            v->list.tail = node->prev; \
+        } \
+        \
+        v->list.size--; \
+        wrapper->retiredAt = atomic_load_explicit(&v->version, memory_order_relaxed) + 1; \
+        wrapper->nextRetired = NULL; \
+        \
+        if (v->retiredTail != NULL) { \
+            v->retiredTail->nextRetired = wrapper; \
+        } else { \
+            v->retiredHead = wrapper; \
+        } \
+        \
+        v->retiredTail = wrapper; \
+    } \
+    \
+    static struct DLLNode__##type* nodeAtVersionedDLL__##type(VersionedDLL__##type* v, int targetIdx) { \
+        struct DLLNode__##type* itr; \
+        int i; \
+        \
+        if (targetIdx < v->list.size / 2) { \
+            for (itr = v->list.head, i = 0; i < targetIdx; i++) { \
+                itr = itr->next; \
+            } \
+        } else { \
+            for (itr = v->list.tail, i = v->list.size - 1; i > targetIdx; i--) { \
+                itr = itr->prev; \
+            } \
+        } \
+        \
+        return itr; \
+    } \
+
+VERSIONED_DLL_HELPERS(int)
+VERSIONED_DLL_HELPERS(float)
+VERSIONED_DLL_HELPERS(char)
+VERSIONED_DLL_HELPERS(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INSERT DATA TO VERSIONED DLL :   HEAD / TAIL / K'th Index
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Inserts `data` at the head, at the tail or at `targetIdx`, bumping the version.
+ *
+ * Out-of-range indices are clamped: `targetIdx <= 0` inserts at the head and
+ * `targetIdx >= size` at the tail, as insertAt() does.
+ *
+ * @param v Pointer to the versioned list structure.
+ * @param data Data to be inserted.
+ * @param targetIdx Position the new element will occupy.
+ *
+ * @return 1 on success, 0 if the node cannot be allocated.
+ */
+#define VERSIONED_DLL_INSERT(type) \
+    int insertAtHeadVersionedDLL__##type(VersionedDLL__##type* v, type data) { \
+        int ok; \
+        \
+        beginWriteVersionedDLL__##type(v); \
+        ok = linkAfterVersionedDLL__##type(v, NULL, data); \
+        endWriteVersionedDLL__##type(v); \
+        \
+        return ok; \
+    } \
+    \
+    int insertAtTailVersionedDLL__##type(VersionedDLL__##type* v, type data) { \
+        int ok; \
+        \
+        beginWriteVersionedDLL__##type(v); \
+        ok = linkAfterVersionedDLL__##type(v, v->list.tail, data); \
+        endWriteVersionedDLL__##type(v); \
+        \
+        return ok; \
+    } \
+    \
+    int insertAtVersionedDLL__##type(VersionedDLL__##type* v, type data, int targetIdx) { \
+        int ok; \
+        \
+        beginWriteVersionedDLL__##type(v); \
+        \
+        if (targetIdx <= 0) { \
+            ok = linkAfterVersionedDLL__##type(v, NULL, data); \
+        } else if (targetIdx >= v->list.size) { \
+            ok = linkAfterVersionedDLL__##type(v, v->list.tail, data); \
+        } else { \
+            ok = linkAfterVersionedDLL__##type(v, nodeAtVersionedDLL__##type(v, targetIdx - 1), data); \
+        } \
+        \
+        endWriteVersionedDLL__##type(v); \
+        \
+        return ok; \
+    } \
+
+VERSIONED_DLL_INSERT(int)
+VERSIONED_DLL_INSERT(float)
+VERSIONED_DLL_INSERT(char)
+VERSIONED_DLL_INSERT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DELETE DATA OF VERSIONED DLL :   HEAD / TAIL / BY DATA / BY INDEX
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes one node, bumping the version; the node is retired rather than freed and is
+ *        released by a later write once every reader that might still see it has finished.
+ *
+ * deleteVersionedDLL() removes the first occurrence of `targetData`. Empty lists, missing values
+ * and out-of-range indices leave the list unchanged.
+ *
+ * @param v Pointer to the versioned list structure.
+ */
+#define VERSIONED_DLL_DELETE(type) \
+    void deleteHeadVersionedDLL__##type(VersionedDLL__##type* v) { \
+        beginWriteVersionedDLL__##type(v); \
+        \
+        if (v->list.head != NULL) { \
+            retireVersionedDLL__##type(v, v->list.head); \
+        } \
+        \
+        endWriteVersionedDLL__##type(v); \
+    } \
+    \
+    void deleteTailVersionedDLL__##type(VersionedDLL__##type* v) { \
+        beginWriteVersionedDLL__##type(v); \
+        \
+        if (v->list.tail != NULL) { \
+            retireVersionedDLL__##type(v, v->list.tail); \
+        } \
+        \
+        endWriteVersionedDLL__##type(v); \
+    } \
+    \
+    void deleteVersionedDLL__##type(VersionedDLL__##type* v, type targetData) { \
+        struct DLLNode__##type* itr; \
+        \
+        beginWriteVersionedDLL__##type(v); \
+        \
+        for (itr = v->list.head; itr != NULL; itr = itr->next) { \
+            if (itr->data == targetData) { \
+                retireVersionedDLL__##type(v, itr); \
+                break; \
+            } \
+        } \
+        \
+        endWriteVersionedDLL__##type(v); \
+    } \
+    \
+    void deleteAtVersionedDLL__##type(VersionedDLL__##type* v, int targetIdx) { \
+        beginWriteVersionedDLL__##type(v); \
+        \
+        if (targetIdx >= 0 && targetIdx < v->list.size) { \
+            retireVersionedDLL__##type(v, nodeAtVersionedDLL__##type(v, targetIdx)); \
+        } \
+        \
+        endWriteVersionedDLL__##type(v); \
+    } \
+
+VERSIONED_DLL_DELETE(int)
+VERSIONED_DLL_DELETE(float)
+VERSIONED_DLL_DELETE(char)
+VERSIONED_DLL_DELETE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO UPDATE DATA OF VERSIONED DLL :   BY INDEX
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Overwrites the element at `targetIdx`, bumping the version.
+ *
+ * @param v Pointer to the versioned list structure.
+ * @param targetIdx Index of the element to update; out-of-range indices are ignored.
+ * @param newData New value.
+ */
+#define VERSIONED_DLL_UPDATE(type) \
+    void updateAtVersionedDLL__##type(VersionedDLL__##type* v, int targetIdx, type newData) { \
+        beginWriteVersionedDLL__##type(v); \
+        \
+        if (targetIdx >= 0 && targetIdx < v->list.size) { \
+            nodeAtVersionedDLL__##type(v, targetIdx)->data = newData; \
+        } \
+        \
+        endWriteVersionedDLL__##type(v); \
+    } \
+
+VERSIONED_DLL_UPDATE(int)
+VERSIONED_DLL_UPDATE(float)
+VERSIONED_DLL_UPDATE(char)
+VERSIONED_DLL_UPDATE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO READ VERSIONED DLL :             SNAPSHOT BEGIN / END
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Brackets a lock-free walk of `v->list`.
+ *
+ * beginReadVersionedDLL() claims a free `readerSince` slot, publishes the version the reader
+ * starts at (which keeps nodes retired after it alive) and returns a ticket holding that version
+ * and the slot. endReadVersionedDLL() releases the slot and reports whether the walk saw a
+ * consistent snapshot: the version must be even and unchanged. On 0 the caller discards what it
+ * read and tries again.
+ *
+ * @param v Pointer to the versioned list structure.
+ * @param ticket Value returned by the matching beginReadVersionedDLL().
+ *
+ * @return beginRead: the ticket. endRead: 1 if the snapshot is consistent, 0 if it must be retried.
+ *
+ * @note The walk itself uses plain loads of `next` / `data`, relying on aligned pointer-sized
+ *       loads being indivisible; values read during a concurrent write are never trusted because
+ *       the version check rejects them. If all VERSIONED_DLL_MAX_READERS slots are taken, begin
+ *       yields until one is released.
+ */
+#define VERSIONED_DLL_READ(type) \
+    unsigned long beginReadVersionedDLL__##type(VersionedDLL__##type* v) { \
+        unsigned int slot = atomic_fetch_add(&v->nextReader, 1) % VERSIONED_DLL_MAX_READERS; \
+        unsigned long expected = 0; \
+        unsigned long version; \
+        \
+        while (!atomic_compare_exchange_strong(&v->readerSince[slot], &expected, 1)) { \
+            expected = 0; \
+            slot = (slot + 1) % VERSIONED_DLL_MAX_READERS; \
+            \
+            if (slot == 0) { \
+                sched_yield(); \
+            } \
+        } \
+        \
+        version = atomic_load(&v->version); \
+        atomic_store(&v->readerSince[slot], version + 1); \
+        \
+        return (version << VERSIONED_DLL_READER_BITS) | slot; \
+    } \
+    \
+    int endReadVersionedDLL__##type(VersionedDLL__##type* v, unsigned long ticket) { \
+        unsigned long version = ticket >> VERSIONED_DLL_READER_BITS; \
+        unsigned long now; \
+        \
+        atomic_thread_fence(memory_order_acquire); \
+        now = atomic_load_explicit(&v->version, memory_order_relaxed); \
+        atomic_store_explicit(&v->readerSince[ticket % VERSIONED_DLL_MAX_READERS], 0, memory_order_release); \
+        \
+        return (version & 1) == 0 && now == version; \
+    } \
+
+VERSIONED_DLL_READ(int)
+VERSIONED_DLL_READ(float)
+VERSIONED_DLL_READ(char)
+VERSIONED_DLL_READ(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO READ VERSIONED DLL :             VISIT ALL / BY INDEX
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Convenience readers built on the begin / end pair.
+ *
+ * readVersionedDLL() calls `visit` for every element from head to tail and returns whether the
+ * pass was consistent; on 0 the visitor must discard what it accumulated and the caller retries.
+ * getDataAtVersionedDLL() retries internally until it reads a consistent value.
+ *
+ * @param v Pointer to the versioned list structure.
+ * @param visit Callback receiving each element and `ctx`.
+ * @param ctx Caller context passed to `visit`.
+ * @param targetIdx Index of the element to read.
+ * @param data404Response Value returned when `targetIdx` is out of range.
+ *
+ * @return readVersionedDLL: 1 if consistent, 0 if the caller must retry.
+ *         getDataAtVersionedDLL: the element, or `data404Response`.
+ */
+#define VERSIONED_DLL_VISIT(type) \
+    int readVersionedDLL__##type(VersionedDLL__##type* v, void (*visit)(type data, void* ctx), void* ctx) { \
+        unsigned long ticket = beginReadVersionedDLL__##type(v); \
+        struct DLLNode__##type* itr; \
+        int budget; \
+        \
+        if ((ticket >> VERSIONED_DLL_READER_BITS) & 1) { \
+            return endReadVersionedDLL__##type(v, ticket); \
+        } \
+        \
+        budget = v->list.size; \
+        \
+        for (itr = v->list.head; itr != NULL && budget-- > 0; itr = itr->next) { \
+            visit(itr->data, ctx); \
+        } \
+        \
+        return endReadVersionedDLL__##type(v, ticket); \
+    } \
+    \
+    type getDataAtVersionedDLL__##type(VersionedDLL__##type* v, int targetIdx, type data404Response) { \
+        struct DLLNode__##type* itr; \
+        unsigned long ticket; \
+        type result; \
+        int i; \
+        \
+        while (1) { \
+            ticket = beginReadVersionedDLL__##type(v); \
+            result = data404Response; \
+            \
+            if (((ticket >> VERSIONED_DLL_READER_BITS) & 1) == 0 && targetIdx >= 0 && targetIdx < v->list.size) { \
+                for (itr = v->list.head, i = 0; itr != NULL && i < targetIdx; i++) { \
+                    itr = itr->next; \
+                } \
+                \
+                if (itr != NULL) { \
+                    result = itr->data; \
+                } \
+            } \
+            \
+            if (endReadVersionedDLL__##type(v, ticket)) { \
+                return result; \
+            } \
+            \
+            sched_yield(); \
+        } \
+    } \
+
+VERSIONED_DLL_VISIT(int)
+VERSIONED_DLL_VISIT(float)
+VERSIONED_DLL_VISIT(char)
+VERSIONED_DLL_VISIT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FREE MEMORY ALLOCATED FOR VERSIONED DLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Frees every live and retired node and the writer lock.
+ *
+ * @param v Pointer to the versioned list structure.
+ *
+ * @note No reader or writer may be active.
+ */
+#define VERSIONED_DLL_FREE(type) \
+    void freeVersionedDLL__##type(VersionedDLL__##type* v) { \
+        struct VersionedDLLNode__##type* retired; \
+        \
+        freeDLL__##type(&v->list); \
+        \
+        while (v->retiredHead != NULL) { \
+            retired = v->retiredHead; \
+            v->retiredHead = retired->nextRetired; \
+            free(retired); \
+        } \
+        \
+        v->retiredTail = NULL; \
+        pthread_mutex_destroy(&v->writeLock); \
+    } \
+
+VERSIONED_DLL_FREE(int)
+VERSIONED_DLL_FREE(float)
+VERSIONED_DLL_FREE(char)
+VERSIONED_DLL_FREE(double)
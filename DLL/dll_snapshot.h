@@ -0,0 +1,112 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_snapshot.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the versioned doubly linked list with snapshot (retry-based) reads.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef DLL_SNAPSHOT_H
+#define DLL_SNAPSHOT_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "dll.h"
+
+/**
+ * @brief Number of readers that can be inside a snapshot read at the same time. Further readers
+ *        wait in beginReadVersionedDLL() until one finishes.
+ */
+#define VERSIONED_DLL_READER_BITS 6
+#define VERSIONED_DLL_MAX_READERS (1 << VERSIONED_DLL_READER_BITS)
+
+/**
+ * @brief Macro to declare a versioned doubly linked list for a specific data type.
+ *
+ * `version` is a sequence counter: writers make it odd while they mutate `list` and even again
+ * when they are done. A reader that saw the same even version before and after its walk read a
+ * consistent point-in-time view; otherwise it is told to retry.
+ *
+ * Every node of `list` is the head of a VersionedDLLNode__type. A node removed by a writer is
+ * stamped with the version its write ends at and queued on `retiredHead` / `retiredTail`. Each
+ * active reader publishes the version it started at in a `readerSince` slot (0 = free slot,
+ * otherwise version + 1), and a writer frees every retired node stamped no later than the
+ * oldest published version, so a reader that is still standing on an unlinked node never
+ * touches freed memory while newer readers do not hold back reclamation.
+ *
+ * @param type The data type for the versioned list.
+ */
+#define DECLARE_VERSIONED_DLL(type) \
+    struct VersionedDLLNode__##type { \
+        struct DLLNode__##type node; \
+        unsigned long retiredAt; \
+        struct VersionedDLLNode__##type* nextRetired; \
+    }; \
+    typedef struct { \
+        DLL__##type list; \
+        _Atomic unsigned long version; \
+        _Atomic unsigned long readerSince[VERSIONED_DLL_MAX_READERS]; \
+        _Atomic unsigned int nextReader; \
+        pthread_mutex_t writeLock; \
+        struct VersionedDLLNode__##type* retiredHead; \
+        struct VersionedDLLNode__##type* retiredTail; \
+    } VersionedDLL__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for versioned doubly linked list operations.
+ *
+ * Mutations are serialised by `writeLock`. Readers never take the lock: they bracket a plain
+ * walk of `v->list` with beginReadVersionedDLL() / endReadVersionedDLL(), or use the helpers
+ * readVersionedDLL() and getDataAtVersionedDLL(). Inserts return 1 on success and 0 if the
+ * node cannot be allocated, leaving the list unchanged.
+ *
+ * @param type The data type for the versioned list.
+ */
+#define VERSIONED_DLL_PROTO(type) \
+    int initVersionedDLL__##type(VersionedDLL__##type* v); \
+    int insertAtHeadVersionedDLL__##type(VersionedDLL__##type* v, type data); \
+    int insertAtTailVersionedDLL__##type(VersionedDLL__##type* v, type data); \
+    int insertAtVersionedDLL__##type(VersionedDLL__##type* v, type data, int targetIdx); \
+    void deleteHeadVersionedDLL__##type(VersionedDLL__##type* v); \
+    void deleteTailVersionedDLL__##type(VersionedDLL__##type* v); \
+    void deleteVersionedDLL__##type(VersionedDLL__##type* v, type targetData); \
+    void deleteAtVersionedDLL__##type(VersionedDLL__##type* v, int targetIdx); \
+    void updateAtVersionedDLL__##type(VersionedDLL__##type* v, int targetIdx, type newData); \
+    unsigned long beginReadVersionedDLL__##type(VersionedDLL__##type* v); \
+    int endReadVersionedDLL__##type(VersionedDLL__##type* v, unsigned long ticket); \
+    int readVersionedDLL__##type(VersionedDLL__##type* v, void (*visit)(type data, void* ctx), void* ctx); \
+    type getDataAtVersionedDLL__##type(VersionedDLL__##type* v, int targetIdx, type data404Response); \
+    void freeVersionedDLL__##type(VersionedDLL__##type* v); \
+
+// Declaration for int data type
+DECLARE_VERSIONED_DLL(int);
+// Declaration for float data type
+DECLARE_VERSIONED_DLL(float);
+// Declaration for char data type
+DECLARE_VERSIONED_DLL(char);
+// Declaration for double data type
+DECLARE_VERSIONED_DLL(double);
+
+VERSIONED_DLL_PROTO(int)
+VERSIONED_DLL_PROTO(float)
+VERSIONED_DLL_PROTO(char)
+VERSIONED_DLL_PROTO(double)
+
+// Macro aliases for function calls
+#define initVersionedDLL(v, type) initVersionedDLL__##type(v)
+#define insertAtHeadVersionedDLL(v, data, type) insertAtHeadVersionedDLL__##type(v, data)
+#define insertAtTailVersionedDLL(v, data, type) insertAtTailVersionedDLL__##type(v, data)
+#define insertAtVersionedDLL(v, data, targetIdx, type) insertAtVersionedDLL__##type(v, data, targetIdx)
+#define deleteHeadVersionedDLL(v, type) deleteHeadVersionedDLL__##type(v)
+#define deleteTailVersionedDLL(v, type) deleteTailVersionedDLL__##type(v)
+#define deleteVersionedDLL(v, targetData, type) deleteVersionedDLL__##type(v, targetData)
+#define deleteAtVersionedDLL(v, targetIdx, type) deleteAtVersionedDLL__##type(v, targetIdx)
+#define updateAtVersionedDLL(v, targetIdx, newData, type) updateAtVersionedDLL__##type(v, targetIdx, newData)
+#define beginReadVersionedDLL(v, type) beginReadVersionedDLL__##type(v)
+#define endReadVersionedDLL(v, ticket, type) endReadVersionedDLL__##type(v, ticket)
+#define readVersionedDLL(v, visit, ctx, type) readVersionedDLL__##type(v, visit, ctx)
+#define getDataAtVersionedDLL(v, targetIdx, data404Response, type) getDataAtVersionedDLL__##type(v, targetIdx, data404Response)
+#define freeVersionedDLL(v, type) freeVersionedDLL__##type(v)
+
+
+#endif /* DLL_SNAPSHOT_H */
@@ -0,0 +1,153 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_view.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the dll_view.h header file containing the read-only list view.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "dll_view.h"
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INIT DLL VIEW :                  BORROW ARRAY
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Points `view` at `size` elements of `data` without copying them.
+ *
+ * @param view Pointer to the view.
+ * @param data Caller-owned array; it must outlive the view.
+ * @param size Number of elements (negative is treated as 0).
+ */
+#define DLL_VIEW_INIT(type) \
+    void initDLLView__##type(DLLView__##type* view, const type* data, int size) { \
+        view->data = data; \
+        view->size = size > 0 && data != NULL ? size : 0; \
+    } \
+
+DLL_VIEW_INIT(int)
+DLL_VIEW_INIT(float)
+DLL_VIEW_INIT(char)
+DLL_VIEW_INIT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO READ DLL VIEW :                  BY INDEX / SIZE / SEARCH / ITERATE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Read operations over the borrowed array.
+ *
+ * getDataAt is O(1) rather than the O(n) walk of getDataAt() on a real list. indexOf returns
+ * the first matching index or -1; count returns the number of matches. forEach calls `visit`
+ * once per element in order.
+ *
+ * @param view Pointer to the view.
+ */
+#define DLL_VIEW_READ(type) \
+    type getDataAtDLLView__##type(const DLLView__##type* view, int targetIdx, type data404Response) { \
+        if (targetIdx < 0 || targetIdx >= view->size) { \
+            return data404Response; \
+        } \
+        \
+        return view->data[targetIdx]; \
+    } \
+    \
+    int sizeDLLView__##type(const DLLView__##type* view) { \
+        return view->size; \
+    } \
+    \
+    int indexOfDLLView__##type(const DLLView__##type* view, type targetData) { \
+        int i; \
+        \
+        for (i = 0; i < view->size; i++) { \
+            if (view->data[i] == targetData) { \
+                return i; \
+            } \
+        } \
+        \
+        return -1; \
+    } \
+    \
+    int countDLLView__##type(const DLLView__##type* view, type targetData) { \
+        int i, hits = 0; \
+        \
+        for (i = 0; i < view->size; i++) { \
+            hits += view->data[i] == targetData; \
+        } \
+        \
+        return hits; \
+    } \
+    \
+    void forEachDLLView__##type(const DLLView__##type* view, void (*visit)(type data, void* ctx), void* ctx) { \
+        int i; \
+        \
+        for (i = 0; i < view->size; i++) { \
+            visit(view->data[i], ctx); \
+        } \
+    } \
+
+DLL_VIEW_READ(int)
+DLL_VIEW_READ(float)
+DLL_VIEW_READ(char)
+DLL_VIEW_READ(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO MATERIALIZE DLL VIEW :           COPY ON WRITE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Copies the viewed elements onto the tail of `dll`, for callers that need to mutate.
+ *
+ * The nodes are linked into a private chain first and spliced on at the end, so running out of
+ * memory leaves `dll` unchanged. They are allocated one by one so the result works with every
+ * dll.h function, including freeDLL().
+ *
+ * @param view Pointer to the view.
+ * @param dll Pointer to the destination list (may already hold data).
+ *
+ * @return 1 on success, 0 if memory ran out.
+ */
+#define DLL_VIEW_MATERIALIZE(type) \
+    int materializeDLLView__##type(const DLLView__##type* view, DLL__##type* dll) { \
+        struct DLLNode__##type* head = NULL; \
+        struct DLLNode__##type* tail = NULL; \
+        struct DLLNode__##type* node; \
+        int i; \
+        \
+        for (i = 0; i < view->size; i++) { \
+            node = (struct DLLNode__##type*) malloc(sizeof(struct DLLNode__##type)); \
+            \
+            if (node == NULL) { \
+                while (head != NULL) { \
+                    node = head->next; \
+                    free(head); \
+                    head = node; \
+                } \
+                return 0; \
+            } \
+            \
+            node->data = view->data[i]; \
+            node->prev = tail; \
+            node->next = NULL; \
+            \
+            if (tail == NULL) { \
+                head = node; \
+            } else { \
+                tail->next = node; \
+            } \
+            tail = node; \
+        } \
+        \
+        if (head != NULL) { \
+            head->prev = dll->tail; \
+            if (dll->tail == NULL) { \
+                dll->head = head; \
+            } else { \
+                dll->tail->next = head; \
+            } \
+            dll->tail = tail; \
+            dll->size += view->size; \
+        } \
+        \
+        return 1; \
+    } \
+
+DLL_VIEW_MATERIALIZE(int)
+DLL_VIEW_MATERIALIZE(float)
+DLL_VIEW_MATERIALIZE(char)
+DLL_VIEW_MATERIALIZE(double)
@@ -0,0 +1,70 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : dll_view.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the read-only doubly linked list view over an external array.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef DLL_VIEW_H
+#define DLL_VIEW_H
+
+#include "dll.h"
+
+/**
+ * @brief Macro to declare a read-only list view for a specific data type.
+ *
+ * A view borrows a caller-owned array: nothing is copied or allocated, and the array must stay
+ * alive and unchanged while the view is in use. Mutating the data means materialising the view
+ * into a real DLL first.
+ *
+ * @param type The data type for the view.
+ */
+#define DECLARE_DLL_VIEW(type) \
+    typedef struct { \
+        const type* data; \
+        int size; \
+    } DLLView__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for read-only list view operations.
+ *
+ * getDataAt follows dll.h, including the `data404Response` fallback; every read is O(1) or a
+ * single pass over the array.
+ *
+ * @param type The data type for the view.
+ */
+#define DLL_VIEW_PROTO(type) \
+    void initDLLView__##type(DLLView__##type* view, const type* data, int size); \
+    type getDataAtDLLView__##type(const DLLView__##type* view, int targetIdx, type data404Response); \
+    int sizeDLLView__##type(const DLLView__##type* view); \
+    int indexOfDLLView__##type(const DLLView__##type* view, type targetData); \
+    int countDLLView__##type(const DLLView__##type* view, type targetData); \
+    void forEachDLLView__##type(const DLLView__##type* view, void (*visit)(type data, void* ctx), void* ctx); \
+    int materializeDLLView__##type(const DLLView__##type* view, DLL__##type* dll); \
+
+// Declaration for int data type
+DECLARE_DLL_VIEW(int);
+// Declaration for float data type
+DECLARE_DLL_VIEW(float);
+// Declaration for char data type
+DECLARE_DLL_VIEW(char);
+// Declaration for double data type
+DECLARE_DLL_VIEW(double);
+
+DLL_VIEW_PROTO(int)
+DLL_VIEW_PROTO(float)
+DLL_VIEW_PROTO(char)
+DLL_VIEW_PROTO(double)
+
+// Macro aliases for function calls
+#define initDLLView(view, data, size, type) initDLLView__##type(view, data, size)
+#define getDataAtDLLView(view, targetIdx, data404Response, type) getDataAtDLLView__##type(view, targetIdx, data404Response)
+#define sizeDLLView(view, type) sizeDLLView__##type(view)
+#define indexOfDLLView(view, targetData, type) indexOfDLLView__##type(view, targetData)
+#define countDLLView(view, targetData, type) countDLLView__##type(view, targetData)
+#define forEachDLLView(view, visit, ctx, type) forEachDLLView__##type(view, visit, ctx)
+#define materializeDLLView(view, dll, type) materializeDLLView__##type(view, dll)
+
+
+#endif /* DLL_VIEW_H */
@@ -0,0 +1,465 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : graph.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the graph.h header file containing the adjacency-list graph
+ *          implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include <limits.h>
+#include <string.h>
+#include "graph.h"
+
+// -------------------------------------------------------------------------------------------->
+// ARENA HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Grows the edge arena to hold at least `needed` edges, at least doubling it so that
+ *        repeated appends and small bulk inserts stay amortized O(1) per edge.
+ *
+ * @return 1 on success, 0 if memory runs out (the arena is unchanged).
+ */
+static int growArenaGraph(Graph* g, int needed) {
+    GraphEdge* grown;
+    int capacity = g->arenaCapacity;
+
+    if (needed <= capacity) {
+        return 1;
+    }
+
+    capacity = capacity > INT_MAX / 2 ? INT_MAX : 2 * capacity;
+
+    if (capacity < 64) {
+        capacity = 64;
+    }
+
+    if (capacity < needed) {
+        capacity = needed;
+    }
+
+    grown = (GraphEdge*) realloc(g->arena, (size_t) capacity * sizeof(GraphEdge));
+
+    if (grown == NULL) {
+        return 0;
+    }
+
+    g->arena = grown;
+    g->arenaCapacity = capacity;
+    return 1;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE GRAPH
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Creates a mutable graph with `vertexCount` vertices and no edges.
+ *
+ * @param g Pointer to the graph.
+ * @param vertexCount Number of vertices; they are numbered 0 to vertexCount - 1.
+ *
+ * @return 1 on success, 0 if `vertexCount` is negative or memory runs out.
+ */
+int initGraph(Graph* g, int vertexCount) {
+    size_t n = vertexCount > 0 ? (size_t) vertexCount : 1;
+
+    memset(g, 0, sizeof(Graph));
+
+    if (vertexCount < 0) {
+        return 0;
+    }
+
+    g->heads = (int*) malloc(n * sizeof(int));
+    g->degree = (int*) calloc(n, sizeof(int));
+
+    if (g->heads == NULL || g->degree == NULL) {
+        free(g->heads);
+        free(g->degree);
+        g->heads = NULL;
+        g->degree = NULL;
+        return 0;
+    }
+
+    memset(g->heads, 0xff, n * sizeof(int));
+    g->vertexCount = vertexCount;
+    return 1;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO ADD EDGES TO GRAPH :             ONE / BULK
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief reserveEdgesGraph() grows the arena to hold `edgeCount` edges in total, so that a
+ *        known number of edges can be added without any reallocation.
+ *
+ *        addEdgeGraph() adds the edge from -> to in amortized O(1). addEdgesGraph() adds
+ *        `count` edges from two parallel arrays, validating all of them and growing the arena
+ *        once before linking any. Both return 0, changing nothing, if the graph is frozen, a
+ *        vertex is out of range or memory runs out. Duplicate edges and self loops are kept.
+ *
+ * @param g Pointer to the graph.
+ */
+int reserveEdgesGraph(Graph* g, int edgeCount) {
+    GraphEdge* grown;
+
+    if (g->frozen || edgeCount < 0) {
+        return 0;
+    }
+
+    if (edgeCount <= g->arenaCapacity) {
+        return 1;
+    }
+
+    grown = (GraphEdge*) realloc(g->arena, (size_t) edgeCount * sizeof(GraphEdge));
+
+    if (grown == NULL) {
+        return 0;
+    }
+
+    g->arena = grown;
+    g->arenaCapacity = edgeCount;
+    return 1;
+}
+
+int addEdgeGraph(Graph* g, int from, int to) {
+    GraphEdge* edge;
+
+    if (g->frozen || from < 0 || from >= g->vertexCount || to < 0 || to >= g->vertexCount) {
+        return 0;
+    }
+
+    if (g->edgeCount == INT_MAX || !growArenaGraph(g, g->edgeCount + 1)) {
+        return 0;
+    }
+
+    edge = &g->arena[g->edgeCount];
+    edge->target = to;
+    edge->next = g->heads[from];
+    g->heads[from] = g->edgeCount++;
+    g->degree[from]++;
+
+    return 1;
+}
+
+int addEdgesGraph(Graph* g, const int* from, const int* to, int count) {
+    GraphEdge* edge;
+    int i;
+
+    if (g->frozen || count < 0 || count > INT_MAX - g->edgeCount) {
+        return 0;
+    }
+
+    for (i = 0; i < count; i++) {
+        if (from[i] < 0 || from[i] >= g->vertexCount || to[i] < 0 || to[i] >= g->vertexCount) {
+            return 0;
+        }
+    }
+
+    if (!growArenaGraph(g, g->edgeCount + count)) {
+        return 0;
+    }
+
+    for (i = 0; i < count; i++) {
+        edge = &g->arena[g->edgeCount];
+        edge->target = to[i];
+        edge->next = g->heads[from[i]];
+        g->heads[from[i]] = g->edgeCount++;
+        g->degree[from[i]]++;
+    }
+
+    return 1;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FREEZE GRAPH INTO CSR :          O(V + E)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Compresses the graph into CSR form and releases the arena.
+ *
+ * `offsets` is the prefix sum of the degrees. Each vertex's chain runs from its newest edge to
+ * its oldest, so it is written into its row from the back, which leaves the row in insertion
+ * order. Freezing a frozen graph does nothing.
+ *
+ * @param g Pointer to the graph.
+ *
+ * @return 1 on success, 0 if memory runs out (the graph stays mutable and unchanged).
+ */
+int freezeGraph(Graph* g) {
+    int v, e, pos;
+
+    if (g->frozen) {
+        return 1;
+    }
+
+    g->offsets = (int*) malloc(((size_t) g->vertexCount + 1) * sizeof(int));
+    g->targets = (int*) malloc((g->edgeCount > 0 ? (size_t) g->edgeCount : 1) * sizeof(int));
+
+    if (g->offsets == NULL || g->targets == NULL) {
+        free(g->offsets);
+        free(g->targets);
+        g->offsets = NULL;
+        g->targets = NULL;
+        return 0;
+    }
+
+    g->offsets[0] = 0;
+
+    for (v = 0; v < g->vertexCount; v++) {
+        g->offsets[v + 1] = g->offsets[v] + g->degree[v];
+    }
+
+    for (v = 0; v < g->vertexCount; v++) {
+        pos = g->offsets[v + 1];
+
+        for (e = g->heads[v]; e != -1; e = g->arena[e].next) {
+            g->targets[--pos] = g->arena[e].target;
+        }
+    }
+
+    free(g->arena);
+    free(g->heads);
+    free(g->degree);
+    g->arena = NULL;
+    g->heads = NULL;
+    g->degree = NULL;
+    g->arenaCapacity = 0;
+    g->frozen = 1;
+
+    return 1;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO READ NEIGHBOURS OF GRAPH
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief degreeGraph() returns the number of edges leaving `vertex`, or -1 if it is out of
+ *        range. neighborsGraph() returns the row of a frozen graph and stores its length in
+ *        `degree` (which may be NULL); it returns NULL for a mutable graph or an out-of-range
+ *        vertex. forEachNeighborGraph() calls `visit(target, ctx)` for every edge leaving
+ *        `vertex` in either mode: in insertion order once frozen, newest first before.
+ *
+ * @param g Pointer to the graph.
+ */
+int degreeGraph(const Graph* g, int vertex) {
+    if (vertex < 0 || vertex >= g->vertexCount) {
+        return -1;
+    }
+
+    return g->frozen ? g->offsets[vertex + 1] - g->offsets[vertex] : g->degree[vertex];
+}
+
+const int* neighborsGraph(const Graph* g, int vertex, int* degree) {
+    if (!g->frozen || vertex < 0 || vertex >= g->vertexCount) {
+        if (degree != NULL) {
+            *degree = 0;
+        }
+
+        return NULL;
+    }
+
+    if (degree != NULL) {
+        *degree = g->offsets[vertex + 1] - g->offsets[vertex];
+    }
+
+    return g->targets + g->offsets[vertex];
+}
+
+void forEachNeighborGraph(const Graph* g, int vertex, void (*visit)(int target, void* ctx), void* ctx) {
+    int e;
+
+    if (vertex < 0 || vertex >= g->vertexCount) {
+        return;
+    }
+
+    if (g->frozen) {
+        for (e = g->offsets[vertex]; e < g->offsets[vertex + 1]; e++) {
+            visit(g->targets[e], ctx);
+        }
+    } else {
+        for (e = g->heads[vertex]; e != -1; e = g->arena[e].next) {
+            visit(g->arena[e].target, ctx);
+        }
+    }
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO VISIT EVERY VERTEX IN PARALLEL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Range of vertices handed to one worker.
+ */
+typedef struct {
+    const Graph* g;
+    void (*visit)(int vertex, const int* neighbors, int degree, void* ctx);
+    void* ctx;
+    int from;
+    int to;
+} GraphSegment;
+
+/**
+ * @brief Worker task: visits the vertices [from, to) of one segment.
+ */
+static void visitSegmentGraph(void* arg) {
+    GraphSegment* seg = (GraphSegment*) arg;
+    const int* offsets = seg->g->offsets;
+    int v;
+
+    for (v = seg->from; v < seg->to; v++) {
+        seg->visit(v, seg->g->targets + offsets[v], offsets[v + 1] - offsets[v], seg->ctx);
+    }
+}
+
+/**
+ * @brief Calls `visit(vertex, neighbors, degree, ctx)` for every vertex of a frozen graph,
+ *        spreading the vertices over the pool.
+ *
+ * The vertices are cut into at most `pool->threadCount` contiguous ranges that hold about the
+ * same number of vertices plus edges, found by binary search over `offsets`, so a few
+ * high-degree vertices do not leave one worker with most of the work. Graphs smaller than two
+ * GRAPH_MIN_SEGMENT ranges, or a NULL pool, are visited on the calling thread. `visit` runs
+ * concurrently for different vertices and must only write state it owns for its vertex.
+ *
+ * @param g Pointer to a frozen graph.
+ * @param visit Callback invoked once per vertex with its CSR row.
+ * @param ctx User pointer passed to the callback.
+ * @param pool Pool that runs the ranges, or NULL.
+ *
+ * @return 1 on success, 0 if the graph is not frozen or memory runs out.
+ */
+int parallelForEachVertexGraph(const Graph* g, void (*visit)(int vertex, const int* neighbors, int degree, void* ctx), void* ctx, ThreadPool* pool) {
+    GraphSegment single;
+    GraphSegment* segs;
+    long long work = (long long) g->vertexCount + g->edgeCount, goal;
+    int k = 1, i, lo, hi, mid;
+
+    if (!g->frozen) {
+        return 0;
+    }
+
+    if (pool != NULL && pool->threadCount > 1) {
+        k = (int) (work / GRAPH_MIN_SEGMENT < pool->threadCount ? work / GRAPH_MIN_SEGMENT : pool->threadCount);
+    }
+
+    single.g = g;
+    single.visit = visit;
+    single.ctx = ctx;
+    single.from = 0;
+    single.to = g->vertexCount;
+
+    if (k <= 1) {
+        visitSegmentGraph(&single);
+        return 1;
+    }
+
+    segs = (GraphSegment*) malloc((size_t) k * sizeof(GraphSegment));
+
+    if (segs == NULL) {
+        return 0;
+    }
+
+    for (i = 0; i < k; i++) {
+        segs[i] = single;
+
+        if (i > 0) {
+            goal = work * i / k;
+            lo = segs[i - 1].from;
+            hi = g->vertexCount;
+
+            while (lo < hi) {
+                mid = lo + (hi - lo) / 2;
+
+                if ((long long) g->offsets[mid] + mid < goal) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+
+            segs[i].from = lo;
+            segs[i - 1].to = lo;
+        }
+    }
+
+    for (i = 0; i < k; i++) {
+        if (!submitThreadPool(pool, visitSegmentGraph, &segs[i])) {
+            visitSegmentGraph(&segs[i]);
+        }
+    }
+
+    waitThreadPool(pool);
+    free(segs);
+
+    return 1;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION FOR BREADTH-FIRST SEARCH :          O(V + E)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Fills `dist[v]` with the number of edges on a shortest path from `source` to `v`, or
+ *        -1 if `v` cannot be reached. Works in both modes; the queue is one array of
+ *        vertexCount ints.
+ *
+ * @param g Pointer to the graph.
+ * @param source Start vertex.
+ * @param dist Array of vertexCount ints to fill.
+ *
+ * @return Number of vertices reached, including `source`, or -1 if `source` is out of range
+ *         or memory runs out.
+ */
+int bfsGraph(const Graph* g, int source, int* dist) {
+    int* queue;
+    int head = 0, tail = 0, v, e, t;
+
+    if (source < 0 || source >= g->vertexCount) {
+        return -1;
+    }
+
+    queue = (int*) malloc((size_t) g->vertexCount * sizeof(int));
+
+    if (queue == NULL) {
+        return -1;
+    }
+
+    memset(dist, 0xff, (size_t) g->vertexCount * sizeof(int));
+    dist[source] = 0;
+    queue[tail++] = source;
+
+    while (head < tail) {
+        v = queue[head++];
+
+        if (g->frozen) {
+            for (e = g->offsets[v]; e < g->offsets[v + 1]; e++) {
+                t = g->targets[e];
+
+                if (dist[t] < 0) {
+                    dist[t] = dist[v] + 1;
+                    queue[tail++] = t;
+                }
+            }
+        } else {
+            for (e = g->heads[v]; e != -1; e = g->arena[e].next) {
+                t = g->arena[e].target;
+
+                if (dist[t] < 0) {
+                    dist[t] = dist[v] + 1;
+                    queue[tail++] = t;
+                }
+            }
+        }
+    }
+
+    free(queue);
+
+    return tail;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FREE GRAPH
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Releases every array of the graph, in either mode.
+ *
+ * @param g Pointer to the graph.
+ */
+void freeGraph(Graph* g) {
+    free(g->heads);
+    free(g->degree);
+    free(g->arena);
+    free(g->offsets);
+    free(g->targets);
+    memset(g, 0, sizeof(Graph));
+}
@@ -0,0 +1,71 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : graph.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the adjacency-list graph with a shared edge arena and CSR freezing.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <stddef.h>
+#include <stdlib.h>
+#include "../TPOOL/tpool.h"
+
+/**
+ * @brief Smallest number of vertices plus edges worth handing to a separate worker in
+ *        parallelForEachVertexGraph().
+ */
+#ifndef GRAPH_MIN_SEGMENT
+#define GRAPH_MIN_SEGMENT 16384
+#endif
+
+/**
+ * @brief One edge of a mutable graph: its target vertex and the arena index of the next edge
+ *        leaving the same vertex, or -1.
+ */
+typedef struct {
+    int target;
+    int next;
+} GraphEdge;
+
+/**
+ * @brief Directed graph over the vertices 0 to vertexCount - 1.
+ *
+ * While the graph is mutable, `heads[v]` is the arena index of the newest edge leaving `v`
+ * (or -1) and the edges of a vertex are chained through `GraphEdge.next`. Every edge of every
+ * vertex lives in the one growable `arena`, so adding an edge is an 8-byte append rather than a
+ * malloc, and links are indexes so the arena can be moved when it grows.
+ *
+ * freezeGraph() turns the graph into compressed sparse row form: the neighbours of `v` are
+ * `targets[offsets[v]]` to `targets[offsets[v + 1] - 1]`, in insertion order, and the arena,
+ * `heads` and `degree` are released. A frozen graph takes 4 bytes per edge plus 4 per vertex
+ * and can no longer be changed.
+ */
+typedef struct {
+    int vertexCount;
+    int edgeCount;
+    int frozen;
+    int* heads;
+    int* degree;
+    GraphEdge* arena;
+    int arenaCapacity;
+    int* offsets;
+    int* targets;
+} Graph;
+
+int initGraph(Graph* g, int vertexCount);
+int reserveEdgesGraph(Graph* g, int edgeCount);
+int addEdgeGraph(Graph* g, int from, int to);
+int addEdgesGraph(Graph* g, const int* from, const int* to, int count);
+int freezeGraph(Graph* g);
+int degreeGraph(const Graph* g, int vertex);
+const int* neighborsGraph(const Graph* g, int vertex, int* degree);
+void forEachNeighborGraph(const Graph* g, int vertex, void (*visit)(int target, void* ctx), void* ctx);
+int parallelForEachVertexGraph(const Graph* g, void (*visit)(int vertex, const int* neighbors, int degree, void* ctx), void* ctx, ThreadPool* pool);
+int bfsGraph(const Graph* g, int source, int* dist);
+void freeGraph(Graph* g);
+
+
+#endif /* GRAPH_H */
@@ -0,0 +1,505 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : heap.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the heap.h header file containing the d-ary heap and pairing heap
+ *          implementations.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include <string.h>
+#include "heap.h"
+
+// -------------------------------------------------------------------------------------------->
+// D-ARY HEAP HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Generates the sift helpers for one element type. Both move a hole instead of swapping,
+ *        so each level costs one write.
+ *
+ * - siftUp: moves `data[i]` towards the root while it is smaller than its parent.
+ * - siftDown: moves `data[i]` towards the leaves while its smallest child is smaller than it.
+ */
+#define HEAP_HELPERS(type) \
+    static void siftUpHEAP__##type(HEAP__##type* h, int i) { \
+        type x = h->data[i]; \
+        int parent; \
+        \
+        while (i > 0) { \
+            parent = (i - 1) / HEAP_ARITY; \
+            \
+            if (!(x < h->data[parent])) { \
+                break; \
+            } \
+            \
+            h->data[i] = h->data[parent]; \
+            i = parent; \
+        } \
+        \
+        h->data[i] = x; \
+    } \
+    \
+    static void siftDownHEAP__##type(HEAP__##type* h, int i) { \
+        type x = h->data[i]; \
+        int first, last, best, c; \
+        \
+        for (;;) { \
+            first = HEAP_ARITY * i + 1; \
+            \
+            if (first >= h->size) { \
+                break; \
+            } \
+            \
+            last = first + HEAP_ARITY < h->size ? first + HEAP_ARITY : h->size; \
+            best = first; \
+            \
+            for (c = first + 1; c < last; c++) { \
+                if (h->data[c] < h->data[best]) { \
+                    best = c; \
+                } \
+            } \
+            \
+            if (!(h->data[best] < x)) { \
+                break; \
+            } \
+            \
+            h->data[i] = h->data[best]; \
+            i = best; \
+        } \
+        \
+        h->data[i] = x; \
+    } \
+
+HEAP_HELPERS(int)
+HEAP_HELPERS(float)
+HEAP_HELPERS(char)
+HEAP_HELPERS(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE / GROW D-ARY HEAP
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief initHEAP() makes an empty heap without allocating. reserveHEAP() grows the array to
+ *        hold at least `capacity` elements, at least doubling it, and returns 0 if memory runs
+ *        out (the heap is unchanged).
+ *
+ * @param h Pointer to the heap.
+ */
+#define HEAP_INIT(type) \
+    void initHEAP__##type(HEAP__##type* h) { \
+        h->data = NULL; \
+        h->size = 0; \
+        h->capacity = 0; \
+    } \
+    \
+    int reserveHEAP__##type(HEAP__##type* h, int capacity) { \
+        type* grown; \
+        \
+        if (capacity <= h->capacity) { \
+            return 1; \
+        } \
+        \
+        if (capacity < 2 * h->capacity) { \
+            capacity = 2 * h->capacity; \
+        } \
+        \
+        if (capacity < 16) { \
+            capacity = 16; \
+        } \
+        \
+        grown = (type*) realloc(h->data, (size_t) capacity * sizeof(type)); \
+        \
+        if (grown == NULL) { \
+            return 0; \
+        } \
+        \
+        h->data = grown; \
+        h->capacity = capacity; \
+        return 1; \
+    } \
+
+HEAP_INIT(int)
+HEAP_INIT(float)
+HEAP_INIT(char)
+HEAP_INIT(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO PUSH / POP / PEEK D-ARY HEAP :   O(log n)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief pushHEAP() adds an element and returns 0 if the array could not grow. popHEAP()
+ *        removes the smallest element into `out` (which may be NULL) and returns 0 if the heap
+ *        is empty. peekHEAP() returns the smallest element, or `data404Response`.
+ *
+ * @param h Pointer to the heap.
+ */
+#define HEAP_PUSH_POP(type) \
+    int pushHEAP__##type(HEAP__##type* h, type data) { \
+        if (h->size == h->capacity && !reserveHEAP__##type(h, h->size + 1)) { \
+            return 0; \
+        } \
+        \
+        h->data[h->size++] = data; \
+        siftUpHEAP__##type(h, h->size - 1); \
+        return 1; \
+    } \
+    \
+    int popHEAP__##type(HEAP__##type* h, type* out) { \
+        if (h->size == 0) { \
+            return 0; \
+        } \
+        \
+        if (out != NULL) { \
+            *out = h->data[0]; \
+        } \
+        \
+        if (--h->size > 0) { \
+            h->data[0] = h->data[h->size]; \
+            siftDownHEAP__##type(h, 0); \
+        } \
+        \
+        return 1; \
+    } \
+    \
+    type peekHEAP__##type(HEAP__##type* h, type data404Response) { \
+        return h->size > 0 ? h->data[0] : data404Response; \
+    } \
+    \
+    int sizeHEAP__##type(HEAP__##type* h) { \
+        return h->size; \
+    } \
+
+HEAP_PUSH_POP(int)
+HEAP_PUSH_POP(float)
+HEAP_PUSH_POP(char)
+HEAP_PUSH_POP(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO BUILD D-ARY HEAP IN BULK :       O(n)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief heapifyHEAP() appends `count` values and restores the heap order bottom-up, which is
+ *        O(size + count) instead of the O(count log n) of pushing them one by one. It returns
+ *        0 if the array could not grow (the heap is unchanged). rebuildHEAP() restores the
+ *        order after elements were written to `h->data` directly, as the list extensions do.
+ *
+ * @param h Pointer to the heap.
+ * @param values The values to add.
+ * @param count Number of values.
+ */
+#define HEAP_HEAPIFY(type) \
+    void rebuildHEAP__##type(HEAP__##type* h) { \
+        int i; \
+        \
+        for (i = (h->size - 2) / HEAP_ARITY; i >= 0 && h->size > 1; i--) { \
+            siftDownHEAP__##type(h, i); \
+        } \
+    } \
+    \
+    int heapifyHEAP__##type(HEAP__##type* h, const type* values, int count) { \
+        if (count < 0 || !reserveHEAP__##type(h, h->size + count)) { \
+            return 0; \
+        } \
+        \
+        if (count > 0) { \
+            memcpy(h->data + h->size, values, (size_t) count * sizeof(type)); \
+            h->size += count; \
+        } \
+        \
+        rebuildHEAP__##type(h); \
+        return 1; \
+    } \
+
+HEAP_HEAPIFY(int)
+HEAP_HEAPIFY(float)
+HEAP_HEAPIFY(char)
+HEAP_HEAPIFY(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO CLEAR / FREE D-ARY HEAP
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief clearHEAP() empties the heap and keeps its array; freeHEAP() releases the array.
+ *
+ * @param h Pointer to the heap.
+ */
+#define HEAP_CLEAR_FREE(type) \
+    void clearHEAP__##type(HEAP__##type* h) { \
+        h->size = 0; \
+    } \
+    \
+    void freeHEAP__##type(HEAP__##type* h) { \
+        free(h->data); \
+        initHEAP__##type(h); \
+    } \
+
+HEAP_CLEAR_FREE(int)
+HEAP_CLEAR_FREE(float)
+HEAP_CLEAR_FREE(char)
+HEAP_CLEAR_FREE(double)
+
+// -------------------------------------------------------------------------------------------->
+// PAIRING HEAP HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Generates the pairing heap helpers for one element type.
+ *
+ * - meld: links two roots, making the larger one the leftmost child of the smaller, and returns
+ *   the new root with `sibling` and `prev` cleared.
+ * - combine: melds a list of siblings into one tree with the standard two passes: pairs from
+ *   left to right, then the pairs from right to left. Pass one stacks the pairs on `sibling`,
+ *   so neither pass needs recursion or extra memory.
+ * - cut: detaches the subtree of a non-root node from its parent and siblings.
+ */
+#define PHEAP_HELPERS(type) \
+    static struct PHEAPNode__##type* meldPHEAPNodes__##type(struct PHEAPNode__##type* a, struct PHEAPNode__##type* b) { \
+        struct PHEAPNode__##type* t; \
+        \
+        if (b->data < a->data) { \
+            t = a; \
+            a = b; \
+            b = t; \
+        } \
+        \
+        b->sibling = a->child; \
+        b->prev = a; \
+        \
+        if (a->child != NULL) { \
+            a->child->prev = b; \
+        } \
+        \
+        a->child = b; \
+        a->sibling = NULL; \
+        a->prev = NULL; \
+        return a; \
+    } \
+    \
+    static struct PHEAPNode__##type* combinePHEAP__##type(struct PHEAPNode__##type* first) { \
+        struct PHEAPNode__##type* pairs = NULL; \
+        struct PHEAPNode__##type* next; \
+        struct PHEAPNode__##type* tree; \
+        \
+        while (first != NULL) { \
+            if (first->sibling == NULL) { \
+                tree = first; \
+                next = NULL; \
+            } else { \
+                next = first->sibling->sibling; \
+                tree = meldPHEAPNodes__##type(first, first->sibling); \
+            } \
+            \
+            tree->sibling = pairs; \
+            pairs = tree; \
+            first = next; \
+        } \
+        \
+        tree = pairs; \
+        pairs = pairs->sibling; \
+        tree->sibling = NULL; \
+        tree->prev = NULL; \
+        \
+        while (pairs != NULL) { \
+            next = pairs->sibling; \
+            tree = meldPHEAPNodes__##type(tree, pairs); \
+            pairs = next; \
+        } \
+        \
+        return tree; \
+    } \
+    \
+    static void cutPHEAP__##type(struct PHEAPNode__##type* node) { \
+        if (node->prev->child == node) { \
+            node->prev->child = node->sibling; \
+        } else { \
+            node->prev->sibling = node->sibling; \
+        } \
+        \
+        if (node->sibling != NULL) { \
+            node->sibling->prev = node->prev; \
+        } \
+        \
+        node->sibling = NULL; \
+        node->prev = NULL; \
+    } \
+
+PHEAP_HELPERS(int)
+PHEAP_HELPERS(float)
+PHEAP_HELPERS(char)
+PHEAP_HELPERS(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE / INSERT TO PAIRING HEAP :   O(1)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief insertPHEAP() melds a new single-node tree with the root and returns the node as the
+ *        element's handle, or NULL if it could not be allocated.
+ *
+ * @param p Pointer to the pairing heap.
+ * @param data The data to insert.
+ */
+#define PHEAP_INSERT(type) \
+    void initPHEAP__##type(PHEAP__##type* p) { \
+        p->root = NULL; \
+        p->size = 0; \
+    } \
+    \
+    struct PHEAPNode__##type* insertPHEAP__##type(PHEAP__##type* p, type data) { \
+        struct PHEAPNode__##type* node = (struct PHEAPNode__##type*) malloc(sizeof(struct PHEAPNode__##type)); \
+        \
+        if (node == NULL) { \
+            return NULL; \
+        } \
+        \
+        node->data = data; \
+        node->child = NULL; \
+        node->sibling = NULL; \
+        node->prev = NULL; \
+        \
+        p->root = p->root == NULL ? node : meldPHEAPNodes__##type(p->root, node); \
+        p->size++; \
+        return node; \
+    } \
+
+PHEAP_INSERT(int)
+PHEAP_INSERT(float)
+PHEAP_INSERT(char)
+PHEAP_INSERT(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO POP / PEEK / REMOVE FROM PAIRING HEAP :   O(log n) AMORTIZED
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief popPHEAP() frees the root, storing its data in `out` (which may be NULL), and combines
+ *        its children into the new root; it returns 0 if the heap is empty. removePHEAP() does
+ *        the same for any node: its subtree is cut out, its children are combined and melded
+ *        back with the root. peekPHEAP() returns the smallest element, or `data404Response`.
+ *
+ * @param p Pointer to the pairing heap.
+ */
+#define PHEAP_POP(type) \
+    int popPHEAP__##type(PHEAP__##type* p, type* out) { \
+        struct PHEAPNode__##type* root = p->root; \
+        \
+        if (root == NULL) { \
+            return 0; \
+        } \
+        \
+        if (out != NULL) { \
+            *out = root->data; \
+        } \
+        \
+        p->root = root->child != NULL ? combinePHEAP__##type(root->child) : NULL; \
+        p->size--; \
+        free(root); \
+        return 1; \
+    } \
+    \
+    type peekPHEAP__##type(PHEAP__##type* p, type data404Response) { \
+        return p->root != NULL ? p->root->data : data404Response; \
+    } \
+    \
+    void removePHEAP__##type(PHEAP__##type* p, struct PHEAPNode__##type* node) { \
+        struct PHEAPNode__##type* sub; \
+        \
+        if (node == p->root) { \
+            popPHEAP__##type(p, NULL); \
+            return; \
+        } \
+        \
+        cutPHEAP__##type(node); \
+        \
+        if (node->child != NULL) { \
+            sub = combinePHEAP__##type(node->child); \
+            p->root = meldPHEAPNodes__##type(p->root, sub); \
+        } \
+        \
+        p->size--; \
+        free(node); \
+    } \
+
+PHEAP_POP(int)
+PHEAP_POP(float)
+PHEAP_POP(char)
+PHEAP_POP(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DECREASE KEY / MELD PAIRING HEAP :   O(1)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief decreaseKeyPHEAP() lowers the data of `node` to `newData`, cutting its subtree out and
+ *        melding it with the root; it returns 0, changing nothing, if `newData` is greater
+ *        than the current data. meldPHEAP() moves every element of `other` into `p`, leaving
+ *        `other` empty; handles into `other` stay valid and now belong to `p`.
+ *
+ * @param p Pointer to the pairing heap.
+ */
+#define PHEAP_DECREASE_MELD(type) \
+    int decreaseKeyPHEAP__##type(PHEAP__##type* p, struct PHEAPNode__##type* node, type newData) { \
+        if (node->data < newData) { \
+            return 0; \
+        } \
+        \
+        node->data = newData; \
+        \
+        if (node != p->root) { \
+            cutPHEAP__##type(node); \
+            p->root = meldPHEAPNodes__##type(p->root, node); \
+        } \
+        \
+        return 1; \
+    } \
+    \
+    void meldPHEAP__##type(PHEAP__##type* p, PHEAP__##type* other) { \
+        if (other->root != NULL) { \
+            p->root = p->root == NULL ? other->root : meldPHEAPNodes__##type(p->root, other->root); \
+        } \
+        \
+        p->size += other->size; \
+        other->root = NULL; \
+        other->size = 0; \
+    } \
+    \
+    int sizePHEAP__##type(PHEAP__##type* p) { \
+        return p->size; \
+    } \
+
+PHEAP_DECREASE_MELD(int)
+PHEAP_DECREASE_MELD(float)
+PHEAP_DECREASE_MELD(char)
+PHEAP_DECREASE_MELD(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FREE PAIRING HEAP :               O(n)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Frees every node without recursion: a node's first child is detached and given the
+ *        node as its sibling, so the walk returns to the node once the child's subtree is gone.
+ *
+ * @param p Pointer to the pairing heap.
+ */
+#define PHEAP_FREE(type) \
+    void freePHEAP__##type(PHEAP__##type* p) { \
+        struct PHEAPNode__##type* node = p->root; \
+        struct PHEAPNode__##type* next; \
+        \
+        while (node != NULL) { \
+            if (node->child != NULL) { \
+                next = node->child; \
+                node->child = next->sibling; \
+                next->sibling = node; \
+            } else { \
+                next = node->sibling; \
+                free(node); \
+            } \
+            \
+            node = next; \
+        } \
+        \
+        p->root = NULL; \
+        p->size = 0; \
+    } \
+
+PHEAP_FREE(int)
+PHEAP_FREE(float)
+PHEAP_FREE(char)
+PHEAP_FREE(double)
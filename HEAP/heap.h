@@ -0,0 +1,138 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : heap.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the d-ary heap and pairing heap priority queues.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef HEAP_H
+#define HEAP_H
+
+#include <stdlib.h>
+
+/**
+ * @brief Number of children per node of the d-ary heap. 4 keeps the tree half as deep as a
+ *        binary heap while the children of a node still share one or two cache lines.
+ */
+#ifndef HEAP_ARITY
+#define HEAP_ARITY 4
+#endif
+
+/**
+ * @brief Macro to declare the priority queue types for a specific data type.
+ *
+ * Both queues are min-queues: the smallest element (by `<`) comes out first. Store negated
+ * priorities to get a max-queue.
+ *
+ * HEAP__type is a d-ary heap in one growable array: the children of `data[i]` are
+ * `data[HEAP_ARITY * i + 1]` to `data[HEAP_ARITY * i + HEAP_ARITY]`. It has the best
+ * throughput when elements never change priority.
+ *
+ * PHEAP__type is a pairing heap of separately allocated nodes. Each node points at its
+ * leftmost child and next sibling, and `prev` points at its previous sibling, or at its parent
+ * if it is the leftmost child. The node returned by insertPHEAP() stays valid until the
+ * element is popped or removed, and serves as a handle for decreaseKeyPHEAP() and
+ * removePHEAP().
+ *
+ * @param type The data type for the queue.
+ */
+#define DECLARE_HEAP(type) \
+    typedef struct { \
+        type* data; \
+        int size; \
+        int capacity; \
+    } HEAP__##type; \
+    struct PHEAPNode__##type { \
+        type data; \
+        struct PHEAPNode__##type* child; \
+        struct PHEAPNode__##type* sibling; \
+        struct PHEAPNode__##type* prev; \
+    }; \
+    typedef struct { \
+        struct PHEAPNode__##type* root; \
+        int size; \
+    } PHEAP__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for the d-ary heap.
+ *
+ * push and pop are O(log n); heapifyHEAP() and rebuildHEAP() restore the heap order over the
+ * whole array bottom-up in O(n).
+ *
+ * @param type The data type for the heap.
+ */
+#define HEAP_PROTO(type) \
+    void initHEAP__##type(HEAP__##type* h); \
+    int reserveHEAP__##type(HEAP__##type* h, int capacity); \
+    int pushHEAP__##type(HEAP__##type* h, type data); \
+    int popHEAP__##type(HEAP__##type* h, type* out); \
+    type peekHEAP__##type(HEAP__##type* h, type data404Response); \
+    int sizeHEAP__##type(HEAP__##type* h); \
+    int heapifyHEAP__##type(HEAP__##type* h, const type* values, int count); \
+    void rebuildHEAP__##type(HEAP__##type* h); \
+    void clearHEAP__##type(HEAP__##type* h); \
+    void freeHEAP__##type(HEAP__##type* h); \
+
+/**
+ * @brief Macro to declare function prototypes for the pairing heap.
+ *
+ * insert, meld and peek are O(1); pop and remove are O(log n) amortized, and decreaseKey is
+ * O(1) in practice (o(log n) amortized).
+ *
+ * @param type The data type for the heap.
+ */
+#define PHEAP_PROTO(type) \
+    void initPHEAP__##type(PHEAP__##type* p); \
+    struct PHEAPNode__##type* insertPHEAP__##type(PHEAP__##type* p, type data); \
+    int popPHEAP__##type(PHEAP__##type* p, type* out); \
+    type peekPHEAP__##type(PHEAP__##type* p, type data404Response); \
+    int decreaseKeyPHEAP__##type(PHEAP__##type* p, struct PHEAPNode__##type* node, type newData); \
+    void removePHEAP__##type(PHEAP__##type* p, struct PHEAPNode__##type* node); \
+    void meldPHEAP__##type(PHEAP__##type* p, PHEAP__##type* other); \
+    int sizePHEAP__##type(PHEAP__##type* p); \
+    void freePHEAP__##type(PHEAP__##type* p); \
+
+// Declaration for int data type
+DECLARE_HEAP(int);
+// Declaration for float data type
+DECLARE_HEAP(float);
+// Declaration for char data type
+DECLARE_HEAP(char);
+// Declaration for double data type
+DECLARE_HEAP(double);
+
+HEAP_PROTO(int)
+HEAP_PROTO(float)
+HEAP_PROTO(char)
+HEAP_PROTO(double)
+
+PHEAP_PROTO(int)
+PHEAP_PROTO(float)
+PHEAP_PROTO(char)
+PHEAP_PROTO(double)
+
+// Macro aliases for function calls
+#define initHEAP(h, type) initHEAP__##type(h)
+#define reserveHEAP(h, capacity, type) reserveHEAP__##type(h, capacity)
+#define pushHEAP(h, data, type) pushHEAP__##type(h, data)
+#define popHEAP(h, out, type) popHEAP__##type(h, out)
+#define peekHEAP(h, data404Response, type) peekHEAP__##type(h, data404Response)
+#define sizeHEAP(h, type) sizeHEAP__##type(h)
+#define heapifyHEAP(h, values, count, type) heapifyHEAP__##type(h, values, count)
+#define rebuildHEAP(h, type) rebuildHEAP__##type(h)
+#define clearHEAP(h, type) clearHEAP__##type(h)
+#define freeHEAP(h, type) freeHEAP__##type(h)
+
+#define initPHEAP(p, type) initPHEAP__##type(p)
+#define insertPHEAP(p, data, type) insertPHEAP__##type(p, data)
+#define popPHEAP(p, out, type) popPHEAP__##type(p, out)
+#define peekPHEAP(p, data404Response, type) peekPHEAP__##type(p, data404Response)
+#define decreaseKeyPHEAP(p, node, newData, type) decreaseKeyPHEAP__##type(p, node, newData)
+#define removePHEAP(p, node, type) removePHEAP__##type(p, node)
+#define meldPHEAP(p, other, type) meldPHEAP__##type(p, other)
+#define sizePHEAP(p, type) sizePHEAP__##type(p)
+#define freePHEAP(p, type) freePHEAP__##type(p)
+
+
+#endif /* HEAP_H */
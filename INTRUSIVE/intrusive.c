@@ -0,0 +1,306 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : intrusive.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the intrusive.h header file containing the intrusive list
+ *          implementations.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "intrusive.h"
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE INTRUSIVE SLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Initializes an empty list.
+ *
+ * @param list Pointer to the list.
+ */
+void initIntrusiveSLL(IntrusiveSLL* list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INSERT LINK TO INTRUSIVE SLL :   HEAD / TAIL / AFTER A LINK
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Links `link` in at the head, at the tail, or right after `pos`, which must be on the
+ *        list. All three are O(1) and never allocate.
+ *
+ * @param list Pointer to the list.
+ * @param link The link to insert; must not be on any list.
+ */
+void insertAtHeadIntrusiveSLL(IntrusiveSLL* list, SLink* link) {
+    link->next = list->head;
+    list->head = link;
+
+    if (list->tail == NULL) {
+        list->tail = link;
+    }
+
+    list->size++;
+}
+
+void insertAtTailIntrusiveSLL(IntrusiveSLL* list, SLink* link) {
+    link->next = NULL;
+
+    if (list->tail == NULL) {
+        list->head = link;
+    } else {
+        list->tail->next = link;
+    }
+
+    list->tail = link;
+    list->size++;
+}
+
+void insertAfterIntrusiveSLL(IntrusiveSLL* list, SLink* pos, SLink* link) {
+    link->next = pos->next;
+    pos->next = link;
+
+    if (list->tail == pos) {
+        list->tail = link;
+    }
+
+    list->size++;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO REMOVE LINK FROM INTRUSIVE SLL : HEAD / A GIVEN LINK
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief popHeadIntrusiveSLL() unlinks and returns the head, or NULL if the list is empty.
+ *        removeIntrusiveSLL() unlinks `link` and returns 1, or returns 0 if it is not on the
+ *        list; without a back link it has to search for the predecessor, O(n).
+ *
+ * @param list Pointer to the list.
+ */
+SLink* popHeadIntrusiveSLL(IntrusiveSLL* list) {
+    SLink* link = list->head;
+
+    if (link == NULL) {
+        return NULL;
+    }
+
+    list->head = link->next;
+
+    if (list->head == NULL) {
+        list->tail = NULL;
+    }
+
+    link->next = NULL;
+    list->size--;
+
+    return link;
+}
+
+int removeIntrusiveSLL(IntrusiveSLL* list, SLink* link) {
+    SLink* prev = NULL;
+    SLink* cur = list->head;
+
+    while (cur != NULL && cur != link) {
+        prev = cur;
+        cur = cur->next;
+    }
+
+    if (cur == NULL) {
+        return 0;
+    }
+
+    if (prev == NULL) {
+        list->head = link->next;
+    } else {
+        prev->next = link->next;
+    }
+
+    if (list->tail == link) {
+        list->tail = prev;
+    }
+
+    link->next = NULL;
+    list->size--;
+
+    return 1;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO SIZE / VISIT / CLEAR INTRUSIVE SLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief forEachIntrusiveSLL() calls `visit(link, ctx)` for every link from head to tail. The
+ *        next link is read before `visit` runs, so `visit` may pop or remove the link it is
+ *        given. clearIntrusiveSLL() forgets every link without touching the objects.
+ *
+ * @param list Pointer to the list.
+ */
+int sizeIntrusiveSLL(IntrusiveSLL* list) {
+    return list->size;
+}
+
+void forEachIntrusiveSLL(IntrusiveSLL* list, void (*visit)(SLink* link, void* ctx), void* ctx) {
+    SLink* link = list->head;
+    SLink* next;
+
+    while (link != NULL) {
+        next = link->next;
+        visit(link, ctx);
+        link = next;
+    }
+}
+
+void clearIntrusiveSLL(IntrusiveSLL* list) {
+    initIntrusiveSLL(list);
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE INTRUSIVE DLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Initializes an empty list.
+ *
+ * @param list Pointer to the list.
+ */
+void initIntrusiveDLL(IntrusiveDLL* list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INSERT LINK TO INTRUSIVE DLL :   HEAD / TAIL / AFTER / BEFORE A LINK
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Links `link` in at the head, at the tail, or right after / before `pos`, which must
+ *        be on the list. All four are O(1) and never allocate.
+ *
+ * @param list Pointer to the list.
+ * @param link The link to insert; must not be on any list.
+ */
+void insertAtHeadIntrusiveDLL(IntrusiveDLL* list, DLink* link) {
+    link->prev = NULL;
+    link->next = list->head;
+
+    if (list->head == NULL) {
+        list->tail = link;
+    } else {
+        list->head->prev = link;
+    }
+
+    list->head = link;
+    list->size++;
+}
+
+void insertAtTailIntrusiveDLL(IntrusiveDLL* list, DLink* link) {
+    link->prev = list->tail;
+    link->next = NULL;
+
+    if (list->tail == NULL) {
+        list->head = link;
+    } else {
+        list->tail->next = link;
+    }
+
+    list->tail = link;
+    list->size++;
+}
+
+void insertAfterIntrusiveDLL(IntrusiveDLL* list, DLink* pos, DLink* link) {
+    link->prev = pos;
+    link->next = pos->next;
+
+    if (pos->next == NULL) {
+        list->tail = link;
+    } else {
+        pos->next->prev = link;
+    }
+
+    pos->next = link;
+    list->size++;
+}
+
+void insertBeforeIntrusiveDLL(IntrusiveDLL* list, DLink* pos, DLink* link) {
+    link->prev = pos->prev;
+    link->next = pos;
+
+    if (pos->prev == NULL) {
+        list->head = link;
+    } else {
+        pos->prev->next = link;
+    }
+
+    pos->prev = link;
+    list->size++;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO REMOVE LINK FROM INTRUSIVE DLL : HEAD / TAIL / A GIVEN LINK
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief removeIntrusiveDLL() unlinks `link`, which must be on the list, in O(1).
+ *        popHeadIntrusiveDLL() / popTailIntrusiveDLL() unlink and return the head / tail, or
+ *        NULL if the list is empty. Removed links have `prev` and `next` reset to NULL.
+ *
+ * @param list Pointer to the list.
+ */
+void removeIntrusiveDLL(IntrusiveDLL* list, DLink* link) {
+    if (link->prev == NULL) {
+        list->head = link->next;
+    } else {
+        link->prev->next = link->next;
+    }
+
+    if (link->next == NULL) {
+        list->tail = link->prev;
+    } else {
+        link->next->prev = link->prev;
+    }
+
+    link->prev = NULL;
+    link->next = NULL;
+    list->size--;
+}
+
+DLink* popHeadIntrusiveDLL(IntrusiveDLL* list) {
+    DLink* link = list->head;
+
+    if (link != NULL) {
+        removeIntrusiveDLL(list, link);
+    }
+
+    return link;
+}
+
+DLink* popTailIntrusiveDLL(IntrusiveDLL* list) {
+    DLink* link = list->tail;
+
+    if (link != NULL) {
+        removeIntrusiveDLL(list, link);
+    }
+
+    return link;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO SIZE / VISIT / CLEAR INTRUSIVE DLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief forEachIntrusiveDLL() calls `visit(link, ctx)` for every link from head to tail. The
+ *        next link is read before `visit` runs, so `visit` may remove the link it is given.
+ *        clearIntrusiveDLL() forgets every link without touching the objects.
+ *
+ * @param list Pointer to the list.
+ */
+int sizeIntrusiveDLL(IntrusiveDLL* list) {
+    return list->size;
+}
+
+void forEachIntrusiveDLL(IntrusiveDLL* list, void (*visit)(DLink* link, void* ctx), void* ctx) {
+    DLink* link = list->head;
+    DLink* next;
+
+    while (link != NULL) {
+        next = link->next;
+        visit(link, ctx);
+        link = next;
+    }
+}
+
+void clearIntrusiveDLL(IntrusiveDLL* list) {
+    initIntrusiveDLL(list);
+}
@@ -0,0 +1,87 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : intrusive.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the intrusive singly and doubly linked lists with caller-owned nodes.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef INTRUSIVE_H
+#define INTRUSIVE_H
+
+#include <stddef.h>
+
+/**
+ * @brief Returns a pointer to the `structType` object whose `member` field is at `ptr`.
+ *
+ * Turns a link handed back by the list into the object it is embedded in:
+ * `Task* t = containerOf(link, Task, runLink);`
+ */
+#define containerOf(ptr, structType, member) \
+    ((structType*) ((char*) (ptr) - offsetof(structType, member)))
+
+/**
+ * @brief Link for an intrusive singly linked list, embedded in the caller's object.
+ */
+typedef struct SLink {
+    struct SLink* next;
+} SLink;
+
+/**
+ * @brief Link for an intrusive doubly linked list, embedded in the caller's object.
+ */
+typedef struct DLink {
+    struct DLink* prev;
+    struct DLink* next;
+} DLink;
+
+/**
+ * @brief Singly linked list of caller-owned links.
+ *
+ * The list never allocates or frees: it only sets the `next` field of the links handed to it,
+ * and the caller keeps ownership of the objects around them. An object can be on as many lists
+ * at once as it has link fields. A link must be on at most one list at a time.
+ */
+typedef struct {
+    SLink* head;
+    SLink* tail;
+    int size;
+} IntrusiveSLL;
+
+/**
+ * @brief Doubly linked list of caller-owned links.
+ *
+ * Same ownership rules as IntrusiveSLL. Because each link knows its neighbours, an object
+ * whose link is known can be removed in O(1) without searching. Removed links have `prev` and
+ * `next` reset to NULL.
+ */
+typedef struct {
+    DLink* head;
+    DLink* tail;
+    int size;
+} IntrusiveDLL;
+
+void initIntrusiveSLL(IntrusiveSLL* list);
+void insertAtHeadIntrusiveSLL(IntrusiveSLL* list, SLink* link);
+void insertAtTailIntrusiveSLL(IntrusiveSLL* list, SLink* link);
+void insertAfterIntrusiveSLL(IntrusiveSLL* list, SLink* pos, SLink* link);
+SLink* popHeadIntrusiveSLL(IntrusiveSLL* list);
+int removeIntrusiveSLL(IntrusiveSLL* list, SLink* link);
+int sizeIntrusiveSLL(IntrusiveSLL* list);
+void forEachIntrusiveSLL(IntrusiveSLL* list, void (*visit)(SLink* link, void* ctx), void* ctx);
+void clearIntrusiveSLL(IntrusiveSLL* list);
+
+void initIntrusiveDLL(IntrusiveDLL* list);
+void insertAtHeadIntrusiveDLL(IntrusiveDLL* list, DLink* link);
+void insertAtTailIntrusiveDLL(IntrusiveDLL* list, DLink* link);
+void insertAfterIntrusiveDLL(IntrusiveDLL* list, DLink* pos, DLink* link);
+void insertBeforeIntrusiveDLL(IntrusiveDLL* list, DLink* pos, DLink* link);
+DLink* popHeadIntrusiveDLL(IntrusiveDLL* list);
+DLink* popTailIntrusiveDLL(IntrusiveDLL* list);
+void removeIntrusiveDLL(IntrusiveDLL* list, DLink* link);
+int sizeIntrusiveDLL(IntrusiveDLL* list);
+void forEachIntrusiveDLL(IntrusiveDLL* list, void (*visit)(DLink* link, void* ctx), void* ctx);
+void clearIntrusiveDLL(IntrusiveDLL* list);
+
+
+#endif /* INTRUSIVE_H */
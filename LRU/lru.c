@@ -0,0 +1,377 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : lru.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the lru.h header file containing the LRU cache implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "lru.h"
+
+// -------------------------------------------------------------------------------------------->
+// HASH INDEX HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Fibonacci hashing: multiplies the key by 2^32 / phi and keeps the top bits, which
+ *        spreads sequential keys across the table.
+ */
+static uint32_t hashKeyLRU(int key, int shift) {
+    return ((uint32_t) key * 2654435769u) >> shift;
+}
+
+/**
+ * @brief Probes for `key`.
+ *
+ * @return The slot holding `key`, or the empty slot where it would be inserted.
+ */
+static uint32_t findSlotLRU(const LRUSlot* slots, uint32_t mask, int shift, int key) {
+    uint32_t i = hashKeyLRU(key, shift);
+
+    while (slots[i].entry >= 0 && slots[i].key != key) {
+        i = (i + 1) & mask;
+    }
+
+    return i;
+}
+
+/**
+ * @brief Empties slot `i` by backward-shift deletion.
+ *
+ * Later slots of the same probe run are moved back into the hole whenever their home slot does
+ * not lie between the hole and their position, so lookups never need tombstones and the table
+ * never degrades with churn.
+ */
+static void eraseSlotLRU(LRUSlot* slots, uint32_t mask, int shift, uint32_t i) {
+    uint32_t j = i, home;
+
+    for (;;) {
+        j = (j + 1) & mask;
+
+        if (slots[j].entry < 0) {
+            break;
+        }
+
+        home = hashKeyLRU(slots[j].key, shift);
+
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            slots[i] = slots[j];
+            i = j;
+        }
+    }
+
+    slots[i].entry = -1;
+}
+// -------------------------------------------------------------------------------------------->
+// LIST HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Recency list helpers: unlink an entry, or link it in as the most recently used.
+ */
+#define LRU_HELPERS(type) \
+    static void unlinkLRU__##type(LRU__##type* c, struct LRUEntry__##type* e) { \
+        if (e->prev != NULL) { \
+            e->prev->next = e->next; \
+        } else { \
+            c->head = e->next; \
+        } \
+        \
+        if (e->next != NULL) { \
+            e->next->prev = e->prev; \
+        } else { \
+            c->tail = e->prev; \
+        } \
+    } \
+    \
+    static void pushFrontLRU__##type(LRU__##type* c, struct LRUEntry__##type* e) { \
+        e->prev = NULL; \
+        e->next = c->head; \
+        \
+        if (c->head != NULL) { \
+            c->head->prev = e; \
+        } else { \
+            c->tail = e; \
+        } \
+        \
+        c->head = e; \
+    } \
+
+LRU_HELPERS(int)
+LRU_HELPERS(float)
+LRU_HELPERS(char)
+LRU_HELPERS(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE LRU :                 PREALLOCATE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Allocates a cache for up to `capacity` entries.
+ *
+ * The entries and a hash index of the next power of two at or above twice the capacity are
+ * allocated here, once; nothing is allocated or freed afterwards.
+ *
+ * @param c Pointer to the cache.
+ * @param capacity Maximum number of entries (at least 1).
+ * @param onEvict Called with each entry pushed out by putLRU(), or NULL. It must not call back
+ *                into the cache.
+ * @param ctx User pointer passed through to `onEvict`.
+ *
+ * @return 1 on success, 0 if `capacity` is invalid or memory ran out.
+ */
+#define LRU_INIT(type) \
+    int initLRU__##type(LRU__##type* c, int capacity, void (*onEvict)(int key, type value, void* ctx), void* ctx) { \
+        uint32_t tableSize = 2; \
+        int bits = 1; \
+        \
+        c->entries = NULL; \
+        c->slots = NULL; \
+        \
+        if (capacity < 1 || capacity > (1 << 29)) { \
+            return 0; \
+        } \
+        \
+        while (tableSize < 2 * (uint32_t) capacity) { \
+            tableSize <<= 1; \
+            bits++; \
+        } \
+        \
+        c->entries = (struct LRUEntry__##type*) malloc((size_t) capacity * sizeof(struct LRUEntry__##type)); \
+        c->slots = (LRUSlot*) malloc(tableSize * sizeof(LRUSlot)); \
+        \
+        if (c->entries == NULL || c->slots == NULL) { \
+            free(c->entries); \
+            free(c->slots); \
+            c->entries = NULL; \
+            c->slots = NULL; \
+            return 0; \
+        } \
+        \
+        c->mask = tableSize - 1; \
+        c->shift = 32 - bits; \
+        c->capacity = capacity; \
+        c->onEvict = onEvict; \
+        c->ctx = ctx; \
+        clearLRU__##type(c); \
+        \
+        return 1; \
+    } \
+
+LRU_INIT(int)
+LRU_INIT(float)
+LRU_INIT(char)
+LRU_INIT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO LOOK UP LRU :                    GET / PEEK
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Looks up `key` and copies its value to `out`.
+ *
+ * getLRU() also makes the entry the most recently used: an unlink and a push to the front, with
+ * no search through the list. peekLRU() leaves the recency order alone.
+ *
+ * @param c Pointer to the cache.
+ * @param key The key to look up.
+ * @param out Receives the value on a hit.
+ *
+ * @return 1 on a hit, 0 on a miss.
+ */
+#define LRU_GET(type) \
+    int getLRU__##type(LRU__##type* c, int key, type* out) { \
+        uint32_t i = findSlotLRU(c->slots, c->mask, c->shift, key); \
+        struct LRUEntry__##type* e; \
+        \
+        if (c->slots[i].entry < 0) { \
+            return 0; \
+        } \
+        \
+        e = c->entries + c->slots[i].entry; \
+        \
+        if (e != c->head) { \
+            unlinkLRU__##type(c, e); \
+            pushFrontLRU__##type(c, e); \
+        } \
+        \
+        *out = e->value; \
+        \
+        return 1; \
+    } \
+    \
+    int peekLRU__##type(LRU__##type* c, int key, type* out) { \
+        uint32_t i = findSlotLRU(c->slots, c->mask, c->shift, key); \
+        \
+        if (c->slots[i].entry < 0) { \
+            return 0; \
+        } \
+        \
+        *out = c->entries[c->slots[i].entry].value; \
+        \
+        return 1; \
+    } \
+
+LRU_GET(int)
+LRU_GET(float)
+LRU_GET(char)
+LRU_GET(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO PUT TO LRU :                     INSERT / UPDATE / EVICT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Stores `value` under `key` and makes it the most recently used entry.
+ *
+ * An existing key is updated in place. A new key on a full cache first evicts the least
+ * recently used entry (the list tail), reports it to `onEvict`, and reuses its node.
+ *
+ * @param c Pointer to the cache.
+ * @param key The key.
+ * @param value The value.
+ */
+#define LRU_PUT(type) \
+    void putLRU__##type(LRU__##type* c, int key, type value) { \
+        uint32_t i = findSlotLRU(c->slots, c->mask, c->shift, key); \
+        struct LRUEntry__##type* e; \
+        int evictedKey; \
+        type evictedValue; \
+        \
+        if (c->slots[i].entry >= 0) { \
+            e = c->entries + c->slots[i].entry; \
+            e->value = value; \
+            \
+            if (e != c->head) { \
+                unlinkLRU__##type(c, e); \
+                pushFrontLRU__##type(c, e); \
+            } \
+            return; \
+        } \
+        \
+        if (c->size == c->capacity) { \
+            e = c->tail; \
+            evictedKey = e->key; \
+            evictedValue = e->value; \
+            eraseSlotLRU(c->slots, c->mask, c->shift, findSlotLRU(c->slots, c->mask, c->shift, evictedKey)); \
+            unlinkLRU__##type(c, e); \
+            c->size--; \
+            \
+            if (c->onEvict != NULL) { \
+                c->onEvict(evictedKey, evictedValue, c->ctx); \
+            } \
+            \
+            i = findSlotLRU(c->slots, c->mask, c->shift, key); \
+        } else { \
+            e = c->freeList; \
+            c->freeList = e->next; \
+        } \
+        \
+        e->key = key; \
+        e->value = value; \
+        pushFrontLRU__##type(c, e); \
+        c->slots[i].key = key; \
+        c->slots[i].entry = (int) (e - c->entries); \
+        c->size++; \
+    } \
+
+LRU_PUT(int)
+LRU_PUT(float)
+LRU_PUT(char)
+LRU_PUT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO REMOVE FROM LRU :                BY KEY
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes `key` without calling `onEvict`.
+ *
+ * @param c Pointer to the cache.
+ * @param key The key to remove.
+ *
+ * @return 1 if the key was present, 0 otherwise.
+ */
+#define LRU_REMOVE(type) \
+    int removeLRU__##type(LRU__##type* c, int key) { \
+        uint32_t i = findSlotLRU(c->slots, c->mask, c->shift, key); \
+        struct LRUEntry__##type* e; \
+        \
+        if (c->slots[i].entry < 0) { \
+            return 0; \
+        } \
+        \
+        e = c->entries + c->slots[i].entry; \
+        eraseSlotLRU(c->slots, c->mask, c->shift, i); \
+        unlinkLRU__##type(c, e); \
+        e->next = c->freeList; \
+        c->freeList = e; \
+        c->size--; \
+        \
+        return 1; \
+    } \
+
+LRU_REMOVE(int)
+LRU_REMOVE(float)
+LRU_REMOVE(char)
+LRU_REMOVE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO GET SIZE / VISIT LRU
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief sizeLRU() returns the number of entries; forEachLRU() calls `visit` on each entry from
+ *        most to least recently used, without changing the order.
+ *
+ * @param c Pointer to the cache.
+ */
+#define LRU_READ(type) \
+    int sizeLRU__##type(LRU__##type* c) { \
+        return c->size; \
+    } \
+    \
+    void forEachLRU__##type(LRU__##type* c, void (*visit)(int key, type value, void* ctx), void* ctx) { \
+        struct LRUEntry__##type* e; \
+        \
+        for (e = c->head; e != NULL; e = e->next) { \
+            visit(e->key, e->value, ctx); \
+        } \
+    } \
+
+LRU_READ(int)
+LRU_READ(float)
+LRU_READ(char)
+LRU_READ(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO CLEAR / FREE LRU
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief clearLRU() drops every entry without calling `onEvict`; freeLRU() releases the cache's
+ *        memory.
+ *
+ * @param c Pointer to the cache.
+ */
+#define LRU_CLEAR_FREE(type) \
+    void clearLRU__##type(LRU__##type* c) { \
+        uint32_t i; \
+        int k; \
+        \
+        for (i = 0; i <= c->mask; i++) { \
+            c->slots[i].entry = -1; \
+        } \
+        \
+        for (k = 0; k < c->capacity; k++) { \
+            c->entries[k].next = k + 1 < c->capacity ? c->entries + k + 1 : NULL; \
+        } \
+        \
+        c->freeList = c->entries; \
+        c->head = NULL; \
+        c->tail = NULL; \
+        c->size = 0; \
+    } \
+    \
+    void freeLRU__##type(LRU__##type* c) { \
+        free(c->entries); \
+        free(c->slots); \
+        c->entries = NULL; \
+        c->slots = NULL; \
+        c->head = NULL; \
+        c->tail = NULL; \
+        c->freeList = NULL; \
+        c->size = 0; \
+        c->capacity = 0; \
+    } \
+
+LRU_CLEAR_FREE(int)
+LRU_CLEAR_FREE(float)
+LRU_CLEAR_FREE(char)
+LRU_CLEAR_FREE(double)
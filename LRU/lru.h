@@ -0,0 +1,102 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : lru.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the LRU cache built on a doubly linked list and an open-addressing
+ *          hash index.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef LRU_H
+#define LRU_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * @brief One slot of the hash index: the key and the index of its entry, or -1 if empty.
+ *
+ * The key is kept in the slot so that a probe only touches the index, not the entries.
+ */
+typedef struct {
+    int key;
+    int entry;
+} LRUSlot;
+
+/**
+ * @brief Macro to declare an LRU cache with `int` keys for a specific value type.
+ *
+ * Entries are allocated once, as an array of `capacity` nodes, and chained into a doubly linked
+ * list in recency order (`head` = most recently used). Unused entries sit on a free list. The
+ * hash index is a linear-probing table of at least twice the capacity, so it never needs to grow
+ * and no operation allocates after initLRU().
+ *
+ * @param type The value type of the cache.
+ */
+#define DECLARE_LRU(type) \
+    struct LRUEntry__##type { \
+        int key; \
+        type value; \
+        struct LRUEntry__##type* prev; \
+        struct LRUEntry__##type* next; \
+    }; \
+    typedef struct { \
+        struct LRUEntry__##type* entries; \
+        struct LRUEntry__##type* head; \
+        struct LRUEntry__##type* tail; \
+        struct LRUEntry__##type* freeList; \
+        LRUSlot* slots; \
+        uint32_t mask; \
+        int shift; \
+        int size; \
+        int capacity; \
+        void (*onEvict)(int key, type value, void* ctx); \
+        void* ctx; \
+    } LRU__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for LRU cache operations.
+ *
+ * get, put, remove and eviction are all O(1): one hash probe sequence plus a constant number of
+ * pointer updates in the list.
+ *
+ * @param type The value type of the cache.
+ */
+#define LRU_PROTO(type) \
+    int initLRU__##type(LRU__##type* c, int capacity, void (*onEvict)(int key, type value, void* ctx), void* ctx); \
+    int getLRU__##type(LRU__##type* c, int key, type* out); \
+    int peekLRU__##type(LRU__##type* c, int key, type* out); \
+    void putLRU__##type(LRU__##type* c, int key, type value); \
+    int removeLRU__##type(LRU__##type* c, int key); \
+    int sizeLRU__##type(LRU__##type* c); \
+    void forEachLRU__##type(LRU__##type* c, void (*visit)(int key, type value, void* ctx), void* ctx); \
+    void clearLRU__##type(LRU__##type* c); \
+    void freeLRU__##type(LRU__##type* c); \
+
+// Declaration for int data type
+DECLARE_LRU(int);
+// Declaration for float data type
+DECLARE_LRU(float);
+// Declaration for char data type
+DECLARE_LRU(char);
+// Declaration for double data type
+DECLARE_LRU(double);
+
+LRU_PROTO(int)
+LRU_PROTO(float)
+LRU_PROTO(char)
+LRU_PROTO(double)
+
+// Macro aliases for function calls
+#define initLRU(c, capacity, onEvict, ctx, type) initLRU__##type(c, capacity, onEvict, ctx)
+#define getLRU(c, key, out, type) getLRU__##type(c, key, out)
+#define peekLRU(c, key, out, type) peekLRU__##type(c, key, out)
+#define putLRU(c, key, value, type) putLRU__##type(c, key, value)
+#define removeLRU(c, key, type) removeLRU__##type(c, key)
+#define sizeLRU(c, type) sizeLRU__##type(c)
+#define forEachLRU(c, visit, ctx, type) forEachLRU__##type(c, visit, ctx)
+#define clearLRU(c, type) clearLRU__##type(c)
+#define freeLRU(c, type) freeLRU__##type(c)
+
+
+#endif /* LRU_H */
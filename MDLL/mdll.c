@@ -0,0 +1,475 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : mdll.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the mdll.h header file containing the memory-mapped persistent doubly
+ *          linked list implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "mdll.h"
+
+#define MDLL_HEADER(m) ((MDLLHeader*) (m)->base)
+#define MDLL_NODE(m, type, off) ((struct MDLLNode__##type*) ((m)->base + (off)))
+
+#define MDLL_FMT_int "%d "
+#define MDLL_FMT_float "%f "
+#define MDLL_FMT_char "%c "
+#define MDLL_FMT_double "%lf "
+
+// -------------------------------------------------------------------------------------------->
+// FILE MAPPING HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Maps the first `length` bytes of `fd` shared and read-write.
+ *
+ * @return The mapping, or NULL on failure.
+ */
+static unsigned char* mapFileMDLL(int fd, size_t length) {
+    void* base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    return base == MAP_FAILED ? NULL : (unsigned char*) base;
+}
+
+/**
+ * @brief Doubles the file (at least up to `need` bytes) and remaps it.
+ *
+ * The mapping may move, so callers must re-derive every node pointer afterwards; offsets stay
+ * valid.
+ *
+ * @return 1 on success, 0 if the file could not be extended or remapped (the old mapping is
+ *         kept in that case).
+ */
+static int growFileMDLL(int fd, unsigned char** base, size_t* mapped, uint64_t need) {
+    uint64_t capacity = ((MDLLHeader*) *base)->capacity;
+    unsigned char* grown;
+
+    while (capacity < need) {
+        capacity *= 2;
+    }
+
+    if (ftruncate(fd, (off_t) capacity) != 0) {
+        return 0;
+    }
+
+    grown = mapFileMDLL(fd, (size_t) capacity);
+
+    if (grown == NULL) {
+        return 0;
+    }
+
+    munmap(*base, *mapped);
+    *base = grown;
+    *mapped = (size_t) capacity;
+    ((MDLLHeader*) grown)->capacity = capacity;
+
+    return 1;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO OPEN MDLL :                      CREATE OR ATTACH
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Opens the list stored in `path`, creating an empty one if the file is new or empty.
+ *
+ * Opening an existing file is a single mmap() call; no node is read until it is accessed, and
+ * the OS page cache keeps only the working set in memory.
+ *
+ * @param m Pointer to the list handle.
+ * @param path Path of the backing file.
+ *
+ * @return 1 on success, 0 if the file cannot be opened or mapped, or was created for a different
+ *         element type or format version.
+ */
+#define MDLL_OPEN(type) \
+    int openMDLL__##type(MDLL__##type* m, const char* path) { \
+        struct stat st; \
+        MDLLHeader header; \
+        \
+        m->fd = open(path, O_RDWR | O_CREAT, 0644); \
+        m->base = NULL; \
+        m->mapped = 0; \
+        \
+        if (m->fd < 0 || fstat(m->fd, &st) != 0) { \
+            closeMDLL__##type(m); \
+            return 0; \
+        } \
+        \
+        if (st.st_size == 0) { \
+            memset(&header, 0, sizeof(header)); \
+            memcpy(header.magic, "MDLL", 4); \
+            header.version = MDLL_VERSION; \
+            header.typeTag = MDLL_TAG_##type; \
+            header.nodeSize = sizeof(struct MDLLNode__##type); \
+            header.capacity = MDLL_INITIAL_CAPACITY; \
+            header.used = sizeof(MDLLHeader); \
+            \
+            if (ftruncate(m->fd, MDLL_INITIAL_CAPACITY) != 0 || \
+                pwrite(m->fd, &header, sizeof(header), 0) != (ssize_t) sizeof(header)) { \
+                closeMDLL__##type(m); \
+                return 0; \
+            } \
+        } else if (pread(m->fd, &header, sizeof(header), 0) != (ssize_t) sizeof(header) || \
+                   memcmp(header.magic, "MDLL", 4) != 0 || header.version != MDLL_VERSION || \
+                   header.typeTag != MDLL_TAG_##type || \
+                   header.nodeSize != sizeof(struct MDLLNode__##type) || \
+                   (uint64_t) st.st_size < header.capacity) { \
+            closeMDLL__##type(m); \
+            return 0; \
+        } \
+        \
+        m->base = mapFileMDLL(m->fd, (size_t) header.capacity); \
+        m->mapped = (size_t) header.capacity; \
+        \
+        if (m->base == NULL) { \
+            closeMDLL__##type(m); \
+            return 0; \
+        } \
+        \
+        return 1; \
+    } \
+
+MDLL_OPEN(int)
+MDLL_OPEN(float)
+MDLL_OPEN(char)
+MDLL_OPEN(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO SYNC / CLOSE MDLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief syncMDLL() flushes every change made so far to disk; closeMDLL() unmaps and closes.
+ *
+ * A crash between two sync points may lose or tear the changes made in between; everything up
+ * to the last successful syncMDLL() survives. closeMDLL() does not sync by itself.
+ *
+ * @param m Pointer to the list handle.
+ *
+ * @return syncMDLL: 1 on success, 0 if msync() failed.
+ */
+#define MDLL_SYNC_CLOSE(type) \
+    int syncMDLL__##type(MDLL__##type* m) { \
+        return msync(m->base, (size_t) MDLL_HEADER(m)->used, MS_SYNC) == 0; \
+    } \
+    \
+    void closeMDLL__##type(MDLL__##type* m) { \
+        if (m->base != NULL) { \
+            munmap(m->base, m->mapped); \
+        } \
+        \
+        if (m->fd >= 0) { \
+            close(m->fd); \
+        } \
+        \
+        m->base = NULL; \
+        m->mapped = 0; \
+        m->fd = -1; \
+    } \
+
+MDLL_SYNC_CLOSE(int)
+MDLL_SYNC_CLOSE(float)
+MDLL_SYNC_CLOSE(char)
+MDLL_SYNC_CLOSE(double)
+// -------------------------------------------------------------------------------------------->
+// NODE HELPERS OF MDLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Offset-based building blocks shared by every list operation.
+ *
+ * - allocNode reuses a node from the free list, or bump-allocates one, growing the file when it
+ *   is full. It returns 0 on failure.
+ * - linkBefore allocates a node and links it in front of `nextOff` (0 = append at the tail).
+ *   Every insert is expressed through it.
+ * - unlink removes a node and pushes it on the free list.
+ * - nodeAt walks from whichever end is closer; find returns the first node holding a value.
+ */
+#define MDLL_HELPERS(type) \
+    static uint64_t allocNodeMDLL__##type(MDLL__##type* m) { \
+        MDLLHeader* header = MDLL_HEADER(m); \
+        uint64_t off = header->freeList; \
+        \
+        if (off != 0) { \
+            header->freeList = MDLL_NODE(m, type, off)->next; \
+            return off; \
+        } \
+        \
+        if (header->used + sizeof(struct MDLLNode__##type) > header->capacity && \
+            !growFileMDLL(m->fd, &m->base, &m->mapped, header->used + sizeof(struct MDLLNode__##type))) { \
+            return 0; \
+        } \
+        \
+        header = MDLL_HEADER(m); \
+        off = header->used; \
+        header->used += sizeof(struct MDLLNode__##type); \
+        \
+        return off; \
+    } \
+    \
+    static int linkBeforeMDLL__##type(MDLL__##type* m, type data, uint64_t nextOff) { \
+        uint64_t off = allocNodeMDLL__##type(m); \
+        MDLLHeader* header = MDLL_HEADER(m); \
+        struct MDLLNode__##type* node; \
+        \
+        if (off == 0) { \
+            return 0; \
+        } \
+        \
+        node = MDLL_NODE(m, type, off); \
+        node->data = data; \
+        node->next = nextOff; \
+        node->prev = nextOff != 0 ? MDLL_NODE(m, type, nextOff)->prev : header->tail; \
+        \
+        if (node->prev != 0) { \
+            MDLL_NODE(m, type, node->prev)->next = off; \
+        } else { \
+            header->head = off; \
+        } \
+        \
+        if (nextOff != 0) { \
+            MDLL_NODE(m, type, nextOff)->prev = off; \
+        } else { \
+            header->tail = off; \
+        } \
+        \
+        header->size++; \
+        \
+        return 1; \
+    } \
+    \
+    static void unlinkMDLL__##type(MDLL__##type* m, uint64_t off) { \
+        MDLLHeader* header = MDLL_HEADER(m); \
+        struct MDLLNode__##type* node = MDLL_NODE(m, type, off); \
+        \
+        if (node->prev != 0) { \
+            MDLL_NODE(m, type, node->prev)->next = node->next; \
+        } else { \
+            header->head = node->next; \
+        } \
+        \
+        if (node->next != 0) { \
+            MDLL_NODE(m, type, node->next)->prev = node->prev; \
+        } else { \
+            header->tail = node->prev; \
+        } \
+        \
+        node->next = header->freeList; \
+        header->freeList = off; \
+        header->size--; \
+    } \
+    \
+    static uint64_t nodeAtMDLL__##type(MDLL__##type* m, int targetIdx) { \
+        MDLLHeader* header = MDLL_HEADER(m); \
+        uint64_t off; \
+        int i; \
+        \
+        if (targetIdx < (int) header->size / 2) { \
+            for (off = header->head, i = 0; i < targetIdx; i++) { \
+                off = MDLL_NODE(m, type, off)->next; \
+            } \
+        } else { \
+            for (off = header->tail, i = (int) header->size - 1; i > targetIdx; i--) { \
+                off = MDLL_NODE(m, type, off)->prev; \
+            } \
+        } \
+        \
+        return off; \
+    } \
+    \
+    static uint64_t findMDLL__##type(MDLL__##type* m, type targetData) { \
+        uint64_t off = MDLL_HEADER(m)->head; \
+        \
+        while (off != 0 && MDLL_NODE(m, type, off)->data != targetData) { \
+            off = MDLL_NODE(m, type, off)->next; \
+        } \
+        \
+        return off; \
+    } \
+
+MDLL_HELPERS(int)
+MDLL_HELPERS(float)
+MDLL_HELPERS(char)
+MDLL_HELPERS(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INSERT DATA TO MDLL :            HEAD / TAIL / K'th Index / After / Before
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Inserts `data` with the same placement rules as the dll.h inserts.
+ *
+ * insertAt clamps out-of-range indices to the head or tail. insertAfter / insertBefore fall back
+ * to the tail when `targetData` is not found.
+ *
+ * @param m Pointer to the list handle.
+ * @param data Data to be inserted.
+ *
+ * @return 1 on success, 0 if the file could not grow.
+ */
+#define MDLL_INSERT(type) \
+    int insertAtHeadMDLL__##type(MDLL__##type* m, type data) { \
+        return linkBeforeMDLL__##type(m, data, MDLL_HEADER(m)->head); \
+    } \
+    \
+    int insertAtTailMDLL__##type(MDLL__##type* m, type data) { \
+        return linkBeforeMDLL__##type(m, data, 0); \
+    } \
+    \
+    int insertAtMDLL__##type(MDLL__##type* m, type data, int targetIdx) { \
+        if (targetIdx <= 0) { \
+            return insertAtHeadMDLL__##type(m, data); \
+        } \
+        \
+        if (targetIdx >= (int) MDLL_HEADER(m)->size) { \
+            return insertAtTailMDLL__##type(m, data); \
+        } \
+        \
+        return linkBeforeMDLL__##type(m, data, nodeAtMDLL__##type(m, targetIdx)); \
+    } \
+    \
+    int insertAfterMDLL__##type(MDLL__##type* m, type data, type targetData) { \
+        uint64_t off = findMDLL__##type(m, targetData); \
+        \
+        return linkBeforeMDLL__##type(m, data, off != 0 ? MDLL_NODE(m, type, off)->next : 0); \
+    } \
+    \
+    int insertBeforeMDLL__##type(MDLL__##type* m, type data, type targetData) { \
+        return linkBeforeMDLL__##type(m, data, findMDLL__##type(m, targetData)); \
+    } \
+
+MDLL_INSERT(int)
+MDLL_INSERT(float)
+MDLL_INSERT(char)
+MDLL_INSERT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DELETE DATA OF MDLL :            HEAD / TAIL / BY DATA / ALL / BY INDEX
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes nodes with the same rules as the dll.h deletes; freed nodes are recycled.
+ *
+ * @param m Pointer to the list handle.
+ */
+#define MDLL_DELETE(type) \
+    void deleteHeadMDLL__##type(MDLL__##type* m) { \
+        if (MDLL_HEADER(m)->head != 0) { \
+            unlinkMDLL__##type(m, MDLL_HEADER(m)->head); \
+        } \
+    } \
+    \
+    void deleteTailMDLL__##type(MDLL__##type* m) { \
+        if (MDLL_HEADER(m)->tail != 0) { \
+            unlinkMDLL__##type(m, MDLL_HEADER(m)->tail); \
+        } \
+    } \
+    \
+    void deleteMDLL__##type(MDLL__##type* m, type targetData) { \
+        uint64_t off = findMDLL__##type(m, targetData); \
+        \
+        if (off != 0) { \
+            unlinkMDLL__##type(m, off); \
+        } \
+    } \
+    \
+    void deleteAllMDLL__##type(MDLL__##type* m, type targetData) { \
+        uint64_t off = MDLL_HEADER(m)->head; \
+        uint64_t next; \
+        \
+        while (off != 0) { \
+            next = MDLL_NODE(m, type, off)->next; \
+            \
+            if (MDLL_NODE(m, type, off)->data == targetData) { \
+                unlinkMDLL__##type(m, off); \
+            } \
+            \
+            off = next; \
+        } \
+    } \
+    \
+    void deleteAtMDLL__##type(MDLL__##type* m, int targetIdx) { \
+        if (targetIdx >= 0 && targetIdx < (int) MDLL_HEADER(m)->size) { \
+            unlinkMDLL__##type(m, nodeAtMDLL__##type(m, targetIdx)); \
+        } \
+    } \
+
+MDLL_DELETE(int)
+MDLL_DELETE(float)
+MDLL_DELETE(char)
+MDLL_DELETE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO GET / UPDATE DATA OF MDLL :      BY INDEX
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Reads or overwrites the element at `targetIdx`, walking from the closer end.
+ *
+ * @param m Pointer to the list handle.
+ * @param targetIdx Index of the element.
+ * @param data404Response Value returned by getDataAtMDLL() when the index is out of range.
+ */
+#define MDLL_ACCESS(type) \
+    type getDataAtMDLL__##type(MDLL__##type* m, int targetIdx, type data404Response) { \
+        if (targetIdx < 0 || targetIdx >= (int) MDLL_HEADER(m)->size) { \
+            return data404Response; \
+        } \
+        \
+        return MDLL_NODE(m, type, nodeAtMDLL__##type(m, targetIdx))->data; \
+    } \
+    \
+    void updateAtMDLL__##type(MDLL__##type* m, int targetIdx, type newData) { \
+        if (targetIdx >= 0 && targetIdx < (int) MDLL_HEADER(m)->size) { \
+            MDLL_NODE(m, type, nodeAtMDLL__##type(m, targetIdx))->data = newData; \
+        } \
+    } \
+    \
+    int sizeMDLL__##type(MDLL__##type* m) { \
+        return (int) MDLL_HEADER(m)->size; \
+    } \
+
+MDLL_ACCESS(int)
+MDLL_ACCESS(float)
+MDLL_ACCESS(char)
+MDLL_ACCESS(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO CLEAR / PRINT MDLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief freeMDLL() empties the list and releases every node; printMDLL() mirrors printDLL().
+ *
+ * freeMDLL() resets the allocator watermark, so all node space is reused, but it keeps the file
+ * at its current size.
+ *
+ * @param m Pointer to the list handle.
+ */
+#define MDLL_CLEAR_PRINT(type) \
+    void freeMDLL__##type(MDLL__##type* m) { \
+        MDLLHeader* header = MDLL_HEADER(m); \
+        \
+        header->head = 0; \
+        header->tail = 0; \
+        header->size = 0; \
+        header->freeList = 0; \
+        header->used = sizeof(MDLLHeader); \
+    } \
+    \
+    void printMDLL__##type(MDLL__##type* m) { \
+        uint64_t off = MDLL_HEADER(m)->head; \
+        \
+        if (off == 0) { \
+            printf("MDLL is empty\n"); \
+            return; \
+        } \
+        \
+        printf("MDLL Contents: "); \
+        while (off != 0) { \
+            printf(MDLL_FMT_##type, MDLL_NODE(m, type, off)->data); \
+            off = MDLL_NODE(m, type, off)->next; \
+        } \
+        printf("\n"); \
+    } \
+
+MDLL_CLEAR_PRINT(int)
+MDLL_CLEAR_PRINT(float)
+MDLL_CLEAR_PRINT(char)
+MDLL_CLEAR_PRINT(double)
@@ -0,0 +1,145 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : mdll.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the memory-mapped persistent doubly linked list implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef MDLL_H
+#define MDLL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * @brief Size of a newly created list file, in bytes. The file doubles whenever it fills up.
+ */
+#ifndef MDLL_INITIAL_CAPACITY
+#define MDLL_INITIAL_CAPACITY (1 << 16)
+#endif
+
+/**
+ * @brief File format version stored in the header.
+ */
+#define MDLL_VERSION 1
+
+/**
+ * @brief Type tags stored in the header so a file is never opened with the wrong element type.
+ */
+#define MDLL_TAG_int 1
+#define MDLL_TAG_float 2
+#define MDLL_TAG_char 3
+#define MDLL_TAG_double 4
+
+/**
+ * @brief Header stored at offset 0 of every list file.
+ *
+ * All links are byte offsets from the start of the mapping, with 0 meaning NULL (offset 0 is
+ * the header itself, so no node can live there). Offsets stay valid when the file is remapped
+ * at a different address, which is what makes the file reusable across restarts.
+ *
+ * - `capacity`: current file size in bytes.
+ * - `used`: bump-allocation watermark; bytes past it have never held a node.
+ * - `freeList`: first node released by a delete, chained through `next`.
+ * - `head` / `tail` / `size`: the list itself, as in DLL__type.
+ */
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t typeTag;
+    uint32_t nodeSize;
+    uint64_t capacity;
+    uint64_t used;
+    uint64_t freeList;
+    uint64_t head;
+    uint64_t tail;
+    uint64_t size;
+} MDLLHeader;
+
+/**
+ * @brief Macro to declare a memory-mapped doubly linked list for a specific data type.
+ *
+ * The handle only holds the file descriptor and the current mapping; everything else lives in
+ * the file.
+ *
+ * @param type The data type for the list.
+ */
+#define DECLARE_MDLL(type) \
+    struct MDLLNode__##type { \
+        type data; \
+        uint64_t prev; \
+        uint64_t next; \
+    }; \
+    typedef struct { \
+        int fd; \
+        unsigned char* base; \
+        size_t mapped; \
+    } MDLL__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for memory-mapped doubly linked list operations.
+ *
+ * The list operations mirror dll.h. Inserts return 1 on success and 0 if the file could not
+ * grow. Changes reach the page cache immediately; syncMDLL() is the durability point that
+ * forces them to disk.
+ *
+ * @param type The data type for the list.
+ */
+#define MDLL_PROTO(type) \
+    int openMDLL__##type(MDLL__##type* m, const char* path); \
+    int syncMDLL__##type(MDLL__##type* m); \
+    void closeMDLL__##type(MDLL__##type* m); \
+    int insertAtHeadMDLL__##type(MDLL__##type* m, type data); \
+    int insertAtTailMDLL__##type(MDLL__##type* m, type data); \
+    int insertAtMDLL__##type(MDLL__##type* m, type data, int targetIdx); \
+    int insertAfterMDLL__##type(MDLL__##type* m, type data, type targetData); \
+    int insertBeforeMDLL__##type(MDLL__##type* m, type data, type targetData); \
+    void deleteHeadMDLL__##type(MDLL__##type* m); \
+    void deleteTailMDLL__##type(MDLL__##type* m); \
+    void deleteMDLL__##type(MDLL__##type* m, type targetData); \
+    void deleteAllMDLL__##type(MDLL__##type* m, type targetData); \
+    void deleteAtMDLL__##type(MDLL__##type* m, int targetIdx); \
+    type getDataAtMDLL__##type(MDLL__##type* m, int targetIdx, type data404Response); \
+    void updateAtMDLL__##type(MDLL__##type* m, int targetIdx, type newData); \
+    int sizeMDLL__##type(MDLL__##type* m); \
+    void freeMDLL__##type(MDLL__##type* m); \
+    void printMDLL__##type(MDLL__##type* m); \
+
+// Declaration for int data type
+DECLARE_MDLL(int);
+// Declaration for float data type
+DECLARE_MDLL(float);
+// Declaration for char data type
+DECLARE_MDLL(char);
+// Declaration for double data type
+DECLARE_MDLL(double);
+
+MDLL_PROTO(int)
+MDLL_PROTO(float)
+MDLL_PROTO(char)
+MDLL_PROTO(double)
+
+// Macro aliases for function calls
+#define openMDLL(m, path, type) openMDLL__##type(m, path)
+#define syncMDLL(m, type) syncMDLL__##type(m)
+#define closeMDLL(m, type) closeMDLL__##type(m)
+#define insertAtHeadMDLL(m, data, type) insertAtHeadMDLL__##type(m, data)
+#define insertAtTailMDLL(m, data, type) insertAtTailMDLL__##type(m, data)
+#define insertAtMDLL(m, data, targetIdx, type) insertAtMDLL__##type(m, data, targetIdx)
+#define insertAfterMDLL(m, data, targetData, type) insertAfterMDLL__##type(m, data, targetData)
+#define insertBeforeMDLL(m, data, targetData, type) insertBeforeMDLL__##type(m, data, targetData)
+#define deleteHeadMDLL(m, type) deleteHeadMDLL__##type(m)
+#define deleteTailMDLL(m, type) deleteTailMDLL__##type(m)
+#define deleteMDLL(m, targetData, type) deleteMDLL__##type(m, targetData)
+#define deleteAllMDLL(m, targetData, type) deleteAllMDLL__##type(m, targetData)
+#define deleteAtMDLL(m, targetIdx, type) deleteAtMDLL__##type(m, targetIdx)
+#define getDataAtMDLL(m, targetIdx, data404Response, type) getDataAtMDLL__##type(m, targetIdx, data404Response)
+#define updateAtMDLL(m, targetIdx, newData, type) updateAtMDLL__##type(m, targetIdx, newData)
+#define sizeMDLL(m, type) sizeMDLL__##type(m)
+#define freeMDLL(m, type) freeMDLL__##type(m)
+#define printMDLL(m, type) printMDLL__##type(m)
+
+
+#endif /* MDLL_H */
@@ -0,0 +1,252 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : psll.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the psll.h header file containing the persistent singly linked list
+ *          implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "psll.h"
+
+// -------------------------------------------------------------------------------------------->
+// REFERENCE COUNTING AND PATH COPY HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Generates the static helpers for one element type.
+ *
+ * - retain: adds a reference to `node` (NULL is allowed). Relaxed ordering is enough because
+ *   the caller already holds a reference, so the node cannot be freed concurrently.
+ * - releaseChain: drops a reference to `node`; each node whose count reaches zero is freed and
+ *   the walk continues with its successor, so releasing a long list needs no recursion. The
+ *   acquire-release decrement makes every earlier use of the node by other threads happen
+ *   before it is freed.
+ * - rebuild: builds the version made of copies of the first `keep` nodes of `version`, then
+ *   `middle` if `hasMiddle`, then the nodes from position `keep + skip` on, which are shared.
+ *   The shared suffix is retained only once every copy has been allocated, so a failure frees
+ *   the copies and changes nothing.
+ */
+#define PSLL_HELPERS(type) \
+    static void retainNodePSLL__##type(struct PSLLNode__##type* node) { \
+        if (node != NULL) { \
+            atomic_fetch_add_explicit(&node->refs, 1, memory_order_relaxed); \
+        } \
+    } \
+    \
+    static void releaseChainPSLL__##type(struct PSLLNode__##type* node) { \
+        struct PSLLNode__##type* next; \
+        \
+        while (node != NULL && atomic_fetch_sub_explicit(&node->refs, 1, memory_order_acq_rel) == 1) { \
+            next = node->next; \
+            free(node); \
+            node = next; \
+        } \
+    } \
+    \
+    static int rebuildPSLL__##type(PSLL__##type* version, int keep, int hasMiddle, type middle, int skip, PSLL__##type* out) { \
+        struct PSLLNode__##type* head = NULL; \
+        struct PSLLNode__##type** link = &head; \
+        struct PSLLNode__##type* node = version->head; \
+        struct PSLLNode__##type* copy; \
+        int size = version->size + hasMiddle - skip; \
+        int i; \
+        \
+        for (i = 0; i < keep + hasMiddle; i++) { \
+            copy = (struct PSLLNode__##type*) malloc(sizeof(struct PSLLNode__##type)); \
+            \
+            if (copy == NULL) { \
+                *link = NULL; \
+                releaseChainPSLL__##type(head); \
+                return 0; \
+            } \
+            \
+            if (i < keep) { \
+                copy->data = node->data; \
+                node = node->next; \
+            } else { \
+                copy->data = middle; \
+            } \
+            \
+            atomic_init(&copy->refs, 1); \
+            *link = copy; \
+            link = &copy->next; \
+        } \
+        \
+        for (i = 0; i < skip; i++) { \
+            node = node->next; \
+        } \
+        \
+        retainNodePSLL__##type(node); \
+        *link = node; \
+        \
+        if (out == version) { \
+            releaseChainPSLL__##type(version->head); \
+        } \
+        \
+        out->head = head; \
+        out->size = size; \
+        return 1; \
+    } \
+
+PSLL_HELPERS(int)
+PSLL_HELPERS(float)
+PSLL_HELPERS(char)
+PSLL_HELPERS(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO CREATE / SHARE / RELEASE VERSIONS :   EMPTY / FROM SLL / RETAIN / RELEASE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief initPSLL() makes the empty version, which owns nothing. fromSLLPSLL() copies the
+ *        elements of `sll` into a new version in O(n), leaving `sll` unchanged; it returns 0,
+ *        leaving `out` untouched, if memory runs out. retainPSLL() makes `out` another owner
+ *        of the same version in O(1), without copying. releasePSLL() gives up the version and
+ *        frees every node no other version shares; the version is left empty.
+ *
+ * @param version Pointer to the version.
+ */
+#define PSLL_VERSIONS(type) \
+    void initPSLL__##type(PSLL__##type* version) { \
+        version->head = NULL; \
+        version->size = 0; \
+    } \
+    \
+    int fromSLLPSLL__##type(SLL__##type* sll, PSLL__##type* out) { \
+        struct PSLLNode__##type* head = NULL; \
+        struct PSLLNode__##type** link = &head; \
+        struct PSLLNode__##type* copy; \
+        struct SLLNode__##type* node; \
+        \
+        for (node = sll->head; node != NULL; node = node->next) { \
+            copy = (struct PSLLNode__##type*) malloc(sizeof(struct PSLLNode__##type)); \
+            \
+            if (copy == NULL) { \
+                *link = NULL; \
+                releaseChainPSLL__##type(head); \
+                return 0; \
+            } \
+            \
+            copy->data = node->data; \
+            atomic_init(&copy->refs, 1); \
+            *link = copy; \
+            link = &copy->next; \
+        } \
+        \
+        *link = NULL; \
+        out->head = head; \
+        out->size = sll->size; \
+        return 1; \
+    } \
+    \
+    void retainPSLL__##type(PSLL__##type* version, PSLL__##type* out) { \
+        retainNodePSLL__##type(version->head); \
+        *out = *version; \
+    } \
+    \
+    void releasePSLL__##type(PSLL__##type* version) { \
+        releaseChainPSLL__##type(version->head); \
+        version->head = NULL; \
+        version->size = 0; \
+    } \
+
+PSLL_VERSIONS(int)
+PSLL_VERSIONS(float)
+PSLL_VERSIONS(char)
+PSLL_VERSIONS(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DERIVE A NEW VERSION :           HEAD / K'th INDEX / UPDATE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Each function writes to `out` the version that differs from `version` by one change,
+ *        sharing every node after the changed position.
+ *
+ * @param version Pointer to the version to derive from; it is not modified.
+ * @param out Where the new version is stored; may be `version` itself.
+ * @return 1 on success, 0 if memory runs out or there is no element to delete / update.
+ */
+#define PSLL_DERIVE(type) \
+    int insertAtHeadPSLL__##type(PSLL__##type* version, type data, PSLL__##type* out) { \
+        return rebuildPSLL__##type(version, 0, 1, data, 0, out); \
+    } \
+    \
+    int deleteHeadPSLL__##type(PSLL__##type* version, PSLL__##type* out) { \
+        if (version->size == 0) { \
+            return 0; \
+        } \
+        \
+        return rebuildPSLL__##type(version, 0, 0, version->head->data, 1, out); \
+    } \
+    \
+    int insertAtPSLL__##type(PSLL__##type* version, type data, int targetIdx, PSLL__##type* out) { \
+        if (targetIdx < 0) { \
+            targetIdx = 0; \
+        } else if (targetIdx > version->size) { \
+            targetIdx = version->size; \
+        } \
+        \
+        return rebuildPSLL__##type(version, targetIdx, 1, data, 0, out); \
+    } \
+    \
+    int deleteAtPSLL__##type(PSLL__##type* version, int targetIdx, PSLL__##type* out) { \
+        if (targetIdx < 0 || targetIdx >= version->size) { \
+            return 0; \
+        } \
+        \
+        return rebuildPSLL__##type(version, targetIdx, 0, version->head->data, 1, out); \
+    } \
+    \
+    int updateAtPSLL__##type(PSLL__##type* version, int targetIdx, type newData, PSLL__##type* out) { \
+        if (targetIdx < 0 || targetIdx >= version->size) { \
+            return 0; \
+        } \
+        \
+        return rebuildPSLL__##type(version, targetIdx, 1, newData, 1, out); \
+    } \
+
+PSLL_DERIVE(int)
+PSLL_DERIVE(float)
+PSLL_DERIVE(char)
+PSLL_DERIVE(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO READ A VERSION
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Reads never take a lock or a reference: a version's nodes cannot change or be freed
+ *        while the caller still owns it. getDataAtPSLL() returns `data404Response` for an
+ *        index outside [0, size); forEachPSLL() calls `visit(data, ctx)` from head to tail.
+ *
+ * @param version Pointer to the version.
+ */
+#define PSLL_READ(type) \
+    type getDataAtPSLL__##type(PSLL__##type* version, int targetIdx, type data404Response) { \
+        struct PSLLNode__##type* node = version->head; \
+        \
+        if (targetIdx < 0 || targetIdx >= version->size) { \
+            return data404Response; \
+        } \
+        \
+        while (targetIdx-- > 0) { \
+            node = node->next; \
+        } \
+        \
+        return node->data; \
+    } \
+    \
+    int sizePSLL__##type(PSLL__##type* version) { \
+        return version->size; \
+    } \
+    \
+    void forEachPSLL__##type(PSLL__##type* version, void (*visit)(type data, void* ctx), void* ctx) { \
+        struct PSLLNode__##type* node; \
+        \
+        for (node = version->head; node != NULL; node = node->next) { \
+            visit(node->data, ctx); \
+        } \
+    } \
+
+PSLL_READ(int)
+PSLL_READ(float)
+PSLL_READ(char)
+PSLL_READ(double)
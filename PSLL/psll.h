@@ -0,0 +1,99 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : psll.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the persistent (immutable, structurally shared) singly linked list.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef PSLL_H
+#define PSLL_H
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include "../SLL/sll.h"
+
+/**
+ * @brief Macro to declare a persistent singly linked list for a specific data type.
+ *
+ * A PSLL__type is one version of a list: a pointer to its first node and its length. Nodes are
+ * never changed after they are created, so any number of versions can share them. A version
+ * that prepends to another is one new node pointing at the old head; a version that changes
+ * position k copies the first k nodes and shares the rest.
+ *
+ * `refs` counts the versions and nodes pointing at a node. Every PSLL__type value obtained from
+ * these functions owns one reference to its head and must be given back with releasePSLL();
+ * when a count drops to zero the node is freed and its reference to the next node is released
+ * in turn. The counts are atomic, so versions can be handed to and released by other threads.
+ *
+ * @param type The data type for the list.
+ */
+#define DECLARE_PSLL(type) \
+    struct PSLLNode__##type { \
+        type data; \
+        atomic_int refs; \
+        struct PSLLNode__##type* next; \
+    }; \
+    typedef struct { \
+        struct PSLLNode__##type* head; \
+        int size; \
+    } PSLL__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for persistent singly linked list operations.
+ *
+ * No operation changes an existing version. Operations that make a new version write it to
+ * `out` and return 1, or return 0 and leave `out` untouched if memory runs out or, for
+ * deleteHead / deleteAt / updateAt, there is no such element. insertAt clamps its index to the
+ * head or tail like insertAt() of sll.h. Prepending and deleting the head are O(1); the other
+ * changes copy the nodes before `targetIdx` and share everything after it.
+ *
+ * `out` may be the same as `version`: the old version is then released once the new one is
+ * built, which is the usual way for a writer to advance its current version.
+ *
+ * @param type The data type for the list.
+ */
+#define PSLL_PROTO(type) \
+    void initPSLL__##type(PSLL__##type* version); \
+    int fromSLLPSLL__##type(SLL__##type* sll, PSLL__##type* out); \
+    void retainPSLL__##type(PSLL__##type* version, PSLL__##type* out); \
+    void releasePSLL__##type(PSLL__##type* version); \
+    int insertAtHeadPSLL__##type(PSLL__##type* version, type data, PSLL__##type* out); \
+    int deleteHeadPSLL__##type(PSLL__##type* version, PSLL__##type* out); \
+    int insertAtPSLL__##type(PSLL__##type* version, type data, int targetIdx, PSLL__##type* out); \
+    int deleteAtPSLL__##type(PSLL__##type* version, int targetIdx, PSLL__##type* out); \
+    int updateAtPSLL__##type(PSLL__##type* version, int targetIdx, type newData, PSLL__##type* out); \
+    type getDataAtPSLL__##type(PSLL__##type* version, int targetIdx, type data404Response); \
+    int sizePSLL__##type(PSLL__##type* version); \
+    void forEachPSLL__##type(PSLL__##type* version, void (*visit)(type data, void* ctx), void* ctx); \
+
+// Declaration for int data type
+DECLARE_PSLL(int);
+// Declaration for float data type
+DECLARE_PSLL(float);
+// Declaration for char data type
+DECLARE_PSLL(char);
+// Declaration for double data type
+DECLARE_PSLL(double);
+
+PSLL_PROTO(int)
+PSLL_PROTO(float)
+PSLL_PROTO(char)
+PSLL_PROTO(double)
+
+// Macro aliases for function calls
+#define initPSLL(version, type) initPSLL__##type(version)
+#define fromSLLPSLL(sll, out, type) fromSLLPSLL__##type(sll, out)
+#define retainPSLL(version, out, type) retainPSLL__##type(version, out)
+#define releasePSLL(version, type) releasePSLL__##type(version)
+#define insertAtHeadPSLL(version, data, out, type) insertAtHeadPSLL__##type(version, data, out)
+#define deleteHeadPSLL(version, out, type) deleteHeadPSLL__##type(version, out)
+#define insertAtPSLL(version, data, targetIdx, out, type) insertAtPSLL__##type(version, data, targetIdx, out)
+#define deleteAtPSLL(version, targetIdx, out, type) deleteAtPSLL__##type(version, targetIdx, out)
+#define updateAtPSLL(version, targetIdx, newData, out, type) updateAtPSLL__##type(version, targetIdx, newData, out)
+#define getDataAtPSLL(version, targetIdx, data404Response, type) getDataAtPSLL__##type(version, targetIdx, data404Response)
+#define sizePSLL(version, type) sizePSLL__##type(version)
+#define forEachPSLL(version, visit, ctx, type) forEachPSLL__##type(version, visit, ctx)
+
+
+#endif /* PSLL_H */
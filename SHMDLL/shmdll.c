@@ -0,0 +1,705 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : shmdll.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the shmdll.h header file containing the doubly linked list shared
+ *          between processes through POSIX shared memory.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "shmdll.h"
+
+#define SHMDLL_HEADER(s) ((SHMDLLHeader*) (s)->base)
+#define SHMDLL_NODE(s, type, off) ((struct SHMDLLNode__##type*) ((s)->base + (off)))
+#define SHMDLL_FIRST_NODE ((sizeof(SHMDLLHeader) + 15) & ~(size_t) 15)
+
+#define SHMDLL_FMT_int "%d "
+#define SHMDLL_FMT_float "%f "
+#define SHMDLL_FMT_char "%c "
+#define SHMDLL_FMT_double "%lf "
+
+// -------------------------------------------------------------------------------------------->
+// SEGMENT HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Maps `length` bytes of the segment shared and read-write.
+ *
+ * @return The mapping, or NULL on failure.
+ */
+static unsigned char* mapSegmentSHMDLL(int fd, size_t length) {
+    void* base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    return base == MAP_FAILED ? NULL : (unsigned char*) base;
+}
+
+/**
+ * @brief Initializes the header's mutex as process-shared and robust.
+ *
+ * @return 1 on success, 0 on failure.
+ */
+static int initLockSHMDLL(pthread_mutex_t* lock) {
+    pthread_mutexattr_t attr;
+    int ok;
+
+    if (pthread_mutexattr_init(&attr) != 0) {
+        return 0;
+    }
+
+    ok = pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED) == 0 &&
+         pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST) == 0 &&
+         pthread_mutex_init(lock, &attr) == 0;
+    pthread_mutexattr_destroy(&attr);
+
+    return ok;
+}
+
+/**
+ * @brief Releases the segment's mutex; the per-type lockSHMDLL__type() helpers take it.
+ */
+static void unlockSHMDLL(SHMDLLHeader* header) {
+    pthread_mutex_unlock(&header->lock);
+}
+
+int removeSHMDLL(const char* name) {
+    return shm_unlink(name) == 0;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO CREATE / ATTACH SHMDLL :         SHARED SEGMENT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief createSHMDLL() creates a new segment holding an empty list; attachSHMDLL() maps an
+ *        existing one.
+ *
+ * The segment size is fixed at creation because every attached process maps it once; inserts
+ * fail once it is full. The creator publishes the header by setting `ready` last, so a process
+ * attaching too early gets 0 and can retry.
+ *
+ * @param s Pointer to the list handle.
+ * @param name Segment name, e.g. "/jobs" (see shm_open()).
+ * @param capacity Segment size in bytes, header included.
+ *
+ * @return 1 on success. createSHMDLL() returns 0 if the name already exists or the segment
+ *         cannot be set up; attachSHMDLL() returns 0 if it does not exist, is not ready yet, or
+ *         was created for a different element type or format version.
+ */
+#define SHMDLL_OPEN(type) \
+    int createSHMDLL__##type(SHMDLL__##type* s, const char* name, size_t capacity) { \
+        SHMDLLHeader* header; \
+        \
+        s->base = NULL; \
+        s->mapped = 0; \
+        \
+        if (capacity < SHMDLL_FIRST_NODE + sizeof(struct SHMDLLNode__##type)) { \
+            s->fd = -1; \
+            return 0; \
+        } \
+        \
+        s->fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600); \
+        \
+        if (s->fd < 0) { \
+            return 0; \
+        } \
+        \
+        if (ftruncate(s->fd, (off_t) capacity) != 0 || \
+            (s->base = mapSegmentSHMDLL(s->fd, capacity)) == NULL) { \
+            detachSHMDLL__##type(s); \
+            shm_unlink(name); \
+            return 0; \
+        } \
+        \
+        s->mapped = capacity; \
+        header = SHMDLL_HEADER(s); \
+        memcpy(header->magic, "SDLL", 4); \
+        header->version = SHMDLL_VERSION; \
+        header->typeTag = SHMDLL_TAG_##type; \
+        header->nodeSize = sizeof(struct SHMDLLNode__##type); \
+        header->capacity = capacity; \
+        header->used = SHMDLL_FIRST_NODE; \
+        \
+        if (!initLockSHMDLL(&header->lock)) { \
+            detachSHMDLL__##type(s); \
+            shm_unlink(name); \
+            return 0; \
+        } \
+        \
+        atomic_store_explicit(&header->ready, 1, memory_order_release); \
+        \
+        return 1; \
+    } \
+    \
+    int attachSHMDLL__##type(SHMDLL__##type* s, const char* name) { \
+        SHMDLLHeader* header; \
+        struct stat st; \
+        \
+        s->fd = shm_open(name, O_RDWR, 0); \
+        s->base = NULL; \
+        s->mapped = 0; \
+        \
+        if (s->fd < 0 || fstat(s->fd, &st) != 0 || (size_t) st.st_size < SHMDLL_FIRST_NODE || \
+            (s->base = mapSegmentSHMDLL(s->fd, (size_t) st.st_size)) == NULL) { \
+            detachSHMDLL__##type(s); \
+            return 0; \
+        } \
+        \
+        s->mapped = (size_t) st.st_size; \
+        header = SHMDLL_HEADER(s); \
+        \
+        if (atomic_load_explicit(&header->ready, memory_order_acquire) != 1 || \
+            memcmp(header->magic, "SDLL", 4) != 0 || header->version != SHMDLL_VERSION || \
+            header->typeTag != SHMDLL_TAG_##type || \
+            header->nodeSize != sizeof(struct SHMDLLNode__##type) || \
+            header->capacity != (uint64_t) st.st_size) { \
+            detachSHMDLL__##type(s); \
+            return 0; \
+        } \
+        \
+        return 1; \
+    } \
+
+SHMDLL_OPEN(int)
+SHMDLL_OPEN(float)
+SHMDLL_OPEN(char)
+SHMDLL_OPEN(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DETACH SHMDLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Unmaps the segment from this process. The list stays in the segment for the other
+ *        processes; removeSHMDLL() deletes it.
+ *
+ * @param s Pointer to the list handle.
+ */
+#define SHMDLL_DETACH(type) \
+    void detachSHMDLL__##type(SHMDLL__##type* s) { \
+        if (s->base != NULL) { \
+            munmap(s->base, s->mapped); \
+        } \
+        \
+        if (s->fd >= 0) { \
+            close(s->fd); \
+        } \
+        \
+        s->base = NULL; \
+        s->mapped = 0; \
+        s->fd = -1; \
+    } \
+
+SHMDLL_DETACH(int)
+SHMDLL_DETACH(float)
+SHMDLL_DETACH(char)
+SHMDLL_DETACH(double)
+// -------------------------------------------------------------------------------------------->
+// NODE HELPERS OF SHMDLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Offset-based building blocks shared by every list operation. All of them expect the
+ *        caller to hold the segment's mutex.
+ *
+ * - allocNode reuses a node from the free list, or bump-allocates one; it returns 0 when the
+ *   segment is full.
+ * - linkBefore allocates a node and links it in front of `nextOff` (0 = append at the tail).
+ * - unlink removes a node and pushes it on the free list.
+ * - nodeAt walks from whichever end is closer.
+ * - lock takes the mutex and returns 0 if it cannot (e.g. ENOTRECOVERABLE); every operation
+ *   then fails without touching the list. If the previous owner died holding the mutex, repair
+ *   rebuilds every `prev`, `tail` and `size` from the forward chain, walking at most as many
+ *   nodes as fit in the segment, before the mutex is marked consistent. A node the dead process
+ *   was linking or unlinking at most leaks.
+ *
+ * The forward chain from `head` is the source of truth: linkBefore and unlink update it first,
+ * with a compiler fence before the `prev` / `tail` / `size` stores, so a process dying inside
+ * them leaves a chain that repair can rebuild the rest from.
+ */
+#define SHMDLL_HELPERS(type) \
+    static uint64_t allocNodeSHMDLL__##type(SHMDLL__##type* s) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        uint64_t off = header->freeList; \
+        \
+        if (off != 0) { \
+            header->freeList = SHMDLL_NODE(s, type, off)->next; \
+            return off; \
+        } \
+        \
+        if (header->used + sizeof(struct SHMDLLNode__##type) > header->capacity) { \
+            return 0; \
+        } \
+        \
+        off = header->used; \
+        header->used += sizeof(struct SHMDLLNode__##type); \
+        \
+        return off; \
+    } \
+    \
+    static int linkBeforeSHMDLL__##type(SHMDLL__##type* s, type data, uint64_t nextOff) { \
+        uint64_t off = allocNodeSHMDLL__##type(s); \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        struct SHMDLLNode__##type* node; \
+        \
+        if (off == 0) { \
+            return 0; \
+        } \
+        \
+        node = SHMDLL_NODE(s, type, off); \
+        node->data = data; \
+        node->next = nextOff; \
+        node->prev = nextOff != 0 ? SHMDLL_NODE(s, type, nextOff)->prev : header->tail; \
+        atomic_signal_fence(memory_order_seq_cst); \
+        \
+        if (node->prev != 0) { \
+            SHMDLL_NODE(s, type, node->prev)->next = off; \
+        } else { \
+            header->head = off; \
+        } \
+        \
+        atomic_signal_fence(memory_order_seq_cst); \
+        \
+        if (nextOff != 0) { \
+            SHMDLL_NODE(s, type, nextOff)->prev = off; \
+        } else { \
+            header->tail = off; \
+        } \
+        \
+        header->size++; \
+        \
+        return 1; \
+    } \
+    \
+    static void unlinkSHMDLL__##type(SHMDLL__##type* s, uint64_t off) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        struct SHMDLLNode__##type* node = SHMDLL_NODE(s, type, off); \
+        \
+        if (node->prev != 0) { \
+            SHMDLL_NODE(s, type, node->prev)->next = node->next; \
+        } else { \
+            header->head = node->next; \
+        } \
+        \
+        atomic_signal_fence(memory_order_seq_cst); \
+        \
+        if (node->next != 0) { \
+            SHMDLL_NODE(s, type, node->next)->prev = node->prev; \
+        } else { \
+            header->tail = node->prev; \
+        } \
+        \
+        atomic_signal_fence(memory_order_seq_cst); \
+        node->next = header->freeList; \
+        header->freeList = off; \
+        header->size--; \
+    } \
+    \
+    static uint64_t nodeAtSHMDLL__##type(SHMDLL__##type* s, int targetIdx) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        uint64_t off; \
+        int i; \
+        \
+        if (targetIdx < (int) header->size / 2) { \
+            for (off = header->head, i = 0; i < targetIdx; i++) { \
+                off = SHMDLL_NODE(s, type, off)->next; \
+            } \
+        } else { \
+            for (off = header->tail, i = (int) header->size - 1; i > targetIdx; i--) { \
+                off = SHMDLL_NODE(s, type, off)->prev; \
+            } \
+        } \
+        \
+        return off; \
+    } \
+    \
+    static int isNodeSHMDLL__##type(SHMDLL__##type* s, uint64_t off) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        \
+        return off >= SHMDLL_FIRST_NODE && off < header->used && \
+               (off - SHMDLL_FIRST_NODE) % sizeof(struct SHMDLLNode__##type) == 0; \
+    } \
+    \
+    static void repairSHMDLL__##type(SHMDLL__##type* s) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        uint64_t nodeSize = sizeof(struct SHMDLLNode__##type); \
+        uint64_t limit = (header->capacity - SHMDLL_FIRST_NODE) / nodeSize; \
+        uint64_t prevOff = 0; \
+        uint64_t off = header->head; \
+        uint64_t size = 0; \
+        \
+        while (off != 0 && size < limit && isNodeSHMDLL__##type(s, off)) { \
+            SHMDLL_NODE(s, type, off)->prev = prevOff; \
+            prevOff = off; \
+            off = SHMDLL_NODE(s, type, off)->next; \
+            size++; \
+        } \
+        \
+        if (off != 0) { \
+            if (prevOff != 0) { \
+                SHMDLL_NODE(s, type, prevOff)->next = 0; \
+            } else { \
+                header->head = 0; \
+            } \
+        } \
+        \
+        header->tail = prevOff; \
+        header->size = size; \
+    } \
+    \
+    static int lockSHMDLL__##type(SHMDLL__##type* s) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        int rc = pthread_mutex_lock(&header->lock); \
+        \
+        if (rc == EOWNERDEAD) { \
+            repairSHMDLL__##type(s); \
+            \
+            if (pthread_mutex_consistent(&header->lock) != 0) { \
+                pthread_mutex_unlock(&header->lock); \
+                return 0; \
+            } \
+            \
+            rc = 0; \
+        } \
+        \
+        return rc == 0; \
+    } \
+
+SHMDLL_HELPERS(int)
+SHMDLL_HELPERS(float)
+SHMDLL_HELPERS(char)
+SHMDLL_HELPERS(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INSERT DATA TO SHMDLL :          HEAD / TAIL / K'th Index
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Inserts `data` under the segment's mutex. insertAt clamps out-of-range indices to the
+ *        head or tail, as in dll.h.
+ *
+ * @param s Pointer to the list handle.
+ * @param data Data to be inserted.
+ *
+ * @return 1 on success, 0 if the segment is full or the mutex cannot be taken.
+ */
+#define SHMDLL_INSERT(type) \
+    int insertAtHeadSHMDLL__##type(SHMDLL__##type* s, type data) { \
+        int ok; \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return 0; \
+        } \
+        ok = linkBeforeSHMDLL__##type(s, data, SHMDLL_HEADER(s)->head); \
+        unlockSHMDLL(SHMDLL_HEADER(s)); \
+        \
+        return ok; \
+    } \
+    \
+    int insertAtTailSHMDLL__##type(SHMDLL__##type* s, type data) { \
+        int ok; \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return 0; \
+        } \
+        ok = linkBeforeSHMDLL__##type(s, data, 0); \
+        unlockSHMDLL(SHMDLL_HEADER(s)); \
+        \
+        return ok; \
+    } \
+    \
+    int insertAtSHMDLL__##type(SHMDLL__##type* s, type data, int targetIdx) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        uint64_t nextOff; \
+        int ok; \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return 0; \
+        } \
+        \
+        if (targetIdx <= 0) { \
+            nextOff = header->head; \
+        } else if (targetIdx >= (int) header->size) { \
+            nextOff = 0; \
+        } else { \
+            nextOff = nodeAtSHMDLL__##type(s, targetIdx); \
+        } \
+        \
+        ok = linkBeforeSHMDLL__##type(s, data, nextOff); \
+        unlockSHMDLL(header); \
+        \
+        return ok; \
+    } \
+
+SHMDLL_INSERT(int)
+SHMDLL_INSERT(float)
+SHMDLL_INSERT(char)
+SHMDLL_INSERT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DELETE DATA OF SHMDLL :          HEAD / TAIL / BY DATA / BY INDEX
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes nodes under the segment's mutex with the same rules as the dll.h deletes;
+ *        freed nodes are recycled by later inserts from any process.
+ *
+ * @param s Pointer to the list handle.
+ */
+#define SHMDLL_DELETE(type) \
+    void deleteHeadSHMDLL__##type(SHMDLL__##type* s) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return; \
+        } \
+        \
+        if (header->head != 0) { \
+            unlinkSHMDLL__##type(s, header->head); \
+        } \
+        \
+        unlockSHMDLL(header); \
+    } \
+    \
+    void deleteTailSHMDLL__##type(SHMDLL__##type* s) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return; \
+        } \
+        \
+        if (header->tail != 0) { \
+            unlinkSHMDLL__##type(s, header->tail); \
+        } \
+        \
+        unlockSHMDLL(header); \
+    } \
+    \
+    void deleteSHMDLL__##type(SHMDLL__##type* s, type targetData) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        uint64_t off; \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return; \
+        } \
+        \
+        for (off = header->head; off != 0; off = SHMDLL_NODE(s, type, off)->next) { \
+            if (SHMDLL_NODE(s, type, off)->data == targetData) { \
+                unlinkSHMDLL__##type(s, off); \
+                break; \
+            } \
+        } \
+        \
+        unlockSHMDLL(header); \
+    } \
+    \
+    void deleteAtSHMDLL__##type(SHMDLL__##type* s, int targetIdx) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return; \
+        } \
+        \
+        if (targetIdx >= 0 && targetIdx < (int) header->size) { \
+            unlinkSHMDLL__##type(s, nodeAtSHMDLL__##type(s, targetIdx)); \
+        } \
+        \
+        unlockSHMDLL(header); \
+    } \
+
+SHMDLL_DELETE(int)
+SHMDLL_DELETE(float)
+SHMDLL_DELETE(char)
+SHMDLL_DELETE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO POP DATA OF SHMDLL :             HEAD / TAIL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes the first / last element and stores it in `out`, atomically with respect to
+ *        every other process, so two workers never take the same item.
+ *
+ * @param s Pointer to the list handle.
+ * @param out Receives the removed element.
+ *
+ * @return 1 if an element was removed, 0 if the list was empty or the mutex cannot be taken.
+ */
+#define SHMDLL_POP(type) \
+    int popHeadSHMDLL__##type(SHMDLL__##type* s, type* out) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        int ok; \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return 0; \
+        } \
+        ok = header->head != 0; \
+        \
+        if (ok) { \
+            *out = SHMDLL_NODE(s, type, header->head)->data; \
+            unlinkSHMDLL__##type(s, header->head); \
+        } \
+        \
+        unlockSHMDLL(header); \
+        \
+        return ok; \
+    } \
+    \
+    int popTailSHMDLL__##type(SHMDLL__##type* s, type* out) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        int ok; \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return 0; \
+        } \
+        ok = header->tail != 0; \
+        \
+        if (ok) { \
+            *out = SHMDLL_NODE(s, type, header->tail)->data; \
+            unlinkSHMDLL__##type(s, header->tail); \
+        } \
+        \
+        unlockSHMDLL(header); \
+        \
+        return ok; \
+    } \
+
+SHMDLL_POP(int)
+SHMDLL_POP(float)
+SHMDLL_POP(char)
+SHMDLL_POP(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO GET / UPDATE DATA OF SHMDLL :    BY INDEX
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Reads or overwrites the element at `targetIdx` under the segment's mutex.
+ *
+ * @param s Pointer to the list handle.
+ * @param targetIdx Index of the element.
+ * @param data404Response Value returned by getDataAtSHMDLL() when the index is out of range.
+ */
+#define SHMDLL_ACCESS(type) \
+    type getDataAtSHMDLL__##type(SHMDLL__##type* s, int targetIdx, type data404Response) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        type data = data404Response; \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return data404Response; \
+        } \
+        \
+        if (targetIdx >= 0 && targetIdx < (int) header->size) { \
+            data = SHMDLL_NODE(s, type, nodeAtSHMDLL__##type(s, targetIdx))->data; \
+        } \
+        \
+        unlockSHMDLL(header); \
+        \
+        return data; \
+    } \
+    \
+    void updateAtSHMDLL__##type(SHMDLL__##type* s, int targetIdx, type newData) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return; \
+        } \
+        \
+        if (targetIdx >= 0 && targetIdx < (int) header->size) { \
+            SHMDLL_NODE(s, type, nodeAtSHMDLL__##type(s, targetIdx))->data = newData; \
+        } \
+        \
+        unlockSHMDLL(header); \
+    } \
+    \
+    int sizeSHMDLL__##type(SHMDLL__##type* s) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        int size; \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return 0; \
+        } \
+        size = (int) header->size; \
+        unlockSHMDLL(header); \
+        \
+        return size; \
+    } \
+
+SHMDLL_ACCESS(int)
+SHMDLL_ACCESS(float)
+SHMDLL_ACCESS(char)
+SHMDLL_ACCESS(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO VISIT ELEMENTS OF SHMDLL :       IN ORDER
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Calls `visit` on every element from head to tail while holding the segment's mutex,
+ *        so the walk sees one consistent list. `visit` must not call back into this list.
+ *
+ * @param s Pointer to the list handle.
+ * @param visit Callback receiving each element and `ctx`.
+ * @param ctx User pointer passed through to `visit`.
+ */
+#define SHMDLL_FOR_EACH(type) \
+    void forEachSHMDLL__##type(SHMDLL__##type* s, void (*visit)(type data, void* ctx), void* ctx) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        uint64_t off; \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return; \
+        } \
+        \
+        for (off = header->head; off != 0; off = SHMDLL_NODE(s, type, off)->next) { \
+            visit(SHMDLL_NODE(s, type, off)->data, ctx); \
+        } \
+        \
+        unlockSHMDLL(header); \
+    } \
+
+SHMDLL_FOR_EACH(int)
+SHMDLL_FOR_EACH(float)
+SHMDLL_FOR_EACH(char)
+SHMDLL_FOR_EACH(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO CLEAR / PRINT SHMDLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief freeSHMDLL() empties the list for every process and recycles all node space;
+ *        printSHMDLL() mirrors printDLL().
+ *
+ * @param s Pointer to the list handle.
+ */
+#define SHMDLL_CLEAR_PRINT(type) \
+    void freeSHMDLL__##type(SHMDLL__##type* s) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return; \
+        } \
+        header->head = 0; \
+        header->tail = 0; \
+        header->size = 0; \
+        header->freeList = 0; \
+        header->used = SHMDLL_FIRST_NODE; \
+        unlockSHMDLL(header); \
+    } \
+    \
+    void printSHMDLL__##type(SHMDLL__##type* s) { \
+        SHMDLLHeader* header = SHMDLL_HEADER(s); \
+        uint64_t off; \
+        \
+        if (!lockSHMDLL__##type(s)) { \
+            return; \
+        } \
+        \
+        if (header->head == 0) { \
+            printf("SHMDLL is empty\n"); \
+        } else { \
+            printf("SHMDLL Contents: "); \
+            for (off = header->head; off != 0; off = SHMDLL_NODE(s, type, off)->next) { \
+                printf(SHMDLL_FMT_##type, SHMDLL_NODE(s, type, off)->data); \
+            } \
+            printf("\n"); \
+        } \
+        \
+        unlockSHMDLL(header); \
+    } \
+
+SHMDLL_CLEAR_PRINT(int)
+SHMDLL_CLEAR_PRINT(float)
+SHMDLL_CLEAR_PRINT(char)
+SHMDLL_CLEAR_PRINT(double)
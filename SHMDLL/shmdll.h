@@ -0,0 +1,154 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : shmdll.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the doubly linked list shared between processes through POSIX
+ *          shared memory.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef SHMDLL_H
+#define SHMDLL_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * @brief Segment format version stored in the header.
+ */
+#define SHMDLL_VERSION 1
+
+/**
+ * @brief Type tags stored in the header so a segment is never attached with the wrong element
+ *        type.
+ */
+#define SHMDLL_TAG_int 1
+#define SHMDLL_TAG_float 2
+#define SHMDLL_TAG_char 3
+#define SHMDLL_TAG_double 4
+
+/**
+ * @brief Header stored at offset 0 of every segment.
+ *
+ * Links are byte offsets from the start of the segment, with 0 meaning NULL, because every
+ * process maps the segment at a different address.
+ *
+ * - `ready`: set last by the creator; attaching fails until it is 1.
+ * - `capacity`: segment size in bytes, fixed at creation.
+ * - `used`: bump-allocation watermark; bytes past it have never held a node.
+ * - `freeList`: first node released by a delete, chained through `next`.
+ * - `head` / `tail` / `size`: the list itself, as in DLL__type.
+ * - `lock`: robust, process-shared mutex guarding everything above except `ready`.
+ */
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t typeTag;
+    uint32_t nodeSize;
+    _Atomic uint32_t ready;
+    uint64_t capacity;
+    uint64_t used;
+    uint64_t freeList;
+    uint64_t head;
+    uint64_t tail;
+    uint64_t size;
+    pthread_mutex_t lock;
+} SHMDLLHeader;
+
+/**
+ * @brief Macro to declare a shared-memory doubly linked list for a specific data type.
+ *
+ * The handle is private to one process and only holds its descriptor and mapping; the list
+ * itself lives in the segment.
+ *
+ * @param type The data type for the list.
+ */
+#define DECLARE_SHMDLL(type) \
+    struct SHMDLLNode__##type { \
+        type data; \
+        uint64_t prev; \
+        uint64_t next; \
+    }; \
+    typedef struct { \
+        int fd; \
+        unsigned char* base; \
+        size_t mapped; \
+    } SHMDLL__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for shared-memory doubly linked list operations.
+ *
+ * Every operation takes the segment's mutex, so any number of processes (and threads) can use
+ * the list at once. Inserts return 1 on success and 0 if the segment is full. The list
+ * operations mirror dll.h; popHead / popTail remove and return an end in one step, which is
+ * what a shared work list needs.
+ *
+ * @param type The data type for the list.
+ */
+#define SHMDLL_PROTO(type) \
+    int createSHMDLL__##type(SHMDLL__##type* s, const char* name, size_t capacity); \
+    int attachSHMDLL__##type(SHMDLL__##type* s, const char* name); \
+    void detachSHMDLL__##type(SHMDLL__##type* s); \
+    int insertAtHeadSHMDLL__##type(SHMDLL__##type* s, type data); \
+    int insertAtTailSHMDLL__##type(SHMDLL__##type* s, type data); \
+    int insertAtSHMDLL__##type(SHMDLL__##type* s, type data, int targetIdx); \
+    void deleteHeadSHMDLL__##type(SHMDLL__##type* s); \
+    void deleteTailSHMDLL__##type(SHMDLL__##type* s); \
+    void deleteSHMDLL__##type(SHMDLL__##type* s, type targetData); \
+    void deleteAtSHMDLL__##type(SHMDLL__##type* s, int targetIdx); \
+    int popHeadSHMDLL__##type(SHMDLL__##type* s, type* out); \
+    int popTailSHMDLL__##type(SHMDLL__##type* s, type* out); \
+    type getDataAtSHMDLL__##type(SHMDLL__##type* s, int targetIdx, type data404Response); \
+    void updateAtSHMDLL__##type(SHMDLL__##type* s, int targetIdx, type newData); \
+    int sizeSHMDLL__##type(SHMDLL__##type* s); \
+    void forEachSHMDLL__##type(SHMDLL__##type* s, void (*visit)(type data, void* ctx), void* ctx); \
+    void freeSHMDLL__##type(SHMDLL__##type* s); \
+    void printSHMDLL__##type(SHMDLL__##type* s); \
+
+/**
+ * @brief Removes the segment name. Processes already attached keep working; the memory is
+ *        released when the last one detaches.
+ *
+ * @return 1 on success, 0 if the name does not exist.
+ */
+int removeSHMDLL(const char* name);
+
+// Declaration for int data type
+DECLARE_SHMDLL(int);
+// Declaration for float data type
+DECLARE_SHMDLL(float);
+// Declaration for char data type
+DECLARE_SHMDLL(char);
+// Declaration for double data type
+DECLARE_SHMDLL(double);
+
+SHMDLL_PROTO(int)
+SHMDLL_PROTO(float)
+SHMDLL_PROTO(char)
+SHMDLL_PROTO(double)
+
+// Macro aliases for function calls
+#define createSHMDLL(s, name, capacity, type) createSHMDLL__##type(s, name, capacity)
+#define attachSHMDLL(s, name, type) attachSHMDLL__##type(s, name)
+#define detachSHMDLL(s, type) detachSHMDLL__##type(s)
+#define insertAtHeadSHMDLL(s, data, type) insertAtHeadSHMDLL__##type(s, data)
+#define insertAtTailSHMDLL(s, data, type) insertAtTailSHMDLL__##type(s, data)
+#define insertAtSHMDLL(s, data, targetIdx, type) insertAtSHMDLL__##type(s, data, targetIdx)
+#define deleteHeadSHMDLL(s, type) deleteHeadSHMDLL__##type(s)
+#define deleteTailSHMDLL(s, type) deleteTailSHMDLL__##type(s)
+#define deleteSHMDLL(s, targetData, type) deleteSHMDLL__##type(s, targetData)
+#define deleteAtSHMDLL(s, targetIdx, type) deleteAtSHMDLL__##type(s, targetIdx)
+#define popHeadSHMDLL(s, out, type) popHeadSHMDLL__##type(s, out)
+#define popTailSHMDLL(s, out, type) popTailSHMDLL__##type(s, out)
+#define getDataAtSHMDLL(s, targetIdx, data404Response, type) getDataAtSHMDLL__##type(s, targetIdx, data404Response)
+#define updateAtSHMDLL(s, targetIdx, newData, type) updateAtSHMDLL__##type(s, targetIdx, newData)
+#define sizeSHMDLL(s, type) sizeSHMDLL__##type(s)
+#define forEachSHMDLL(s, visit, ctx, type) forEachSHMDLL__##type(s, visit, ctx)
+#define freeSHMDLL(s, type) freeSHMDLL__##type(s)
+#define printSHMDLL(s, type) printSHMDLL__##type(s)
+
+
+#endif /* SHMDLL_H */
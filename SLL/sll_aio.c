@@ -0,0 +1,577 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_aio.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the sll_aio.h header file containing asynchronous singly linked list
+ *          save and load.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "sll_aio.h"
+
+#ifdef SLL_AIO_URING
+#include <liburing.h>
+#endif
+
+/**
+ * @brief One in-flight transfer at a time, so a worker can fill (or parse) one staging buffer
+ *        while the other is being written (or read).
+ *
+ * With SLL_AIO_URING the transfer is an io_uring request; otherwise `thread` performs it.
+ * `busy` is only touched by the worker and tells it whether a transfer is still outstanding;
+ * `failed` records that an io_uring request could not be queued, so the wait reports an error
+ * instead of waiting for a completion that will never arrive.
+ */
+typedef struct {
+    int fd;
+    unsigned char* buf;
+    size_t len;
+    off_t offset;
+    int isRead;
+    int busy;
+#ifdef SLL_AIO_URING
+    struct io_uring ring;
+    size_t moved;
+    int failed;
+#else
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int state;
+    int stop;
+    ssize_t result;
+#endif
+} AsyncLaneSLL;
+
+// -------------------------------------------------------------------------------------------->
+// TRANSFER LANE HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Blocking pread() / pwrite() of the whole range, retrying short and interrupted calls.
+ *
+ * @return Bytes transferred (less than `len` only when a read hits end of file), or -1.
+ */
+static ssize_t transferAllSLL(int fd, unsigned char* buf, size_t len, off_t offset, int isRead) {
+    size_t moved = 0;
+    ssize_t got;
+
+    while (moved < len) {
+        got = isRead ? pread(fd, buf + moved, len - moved, offset + (off_t) moved)
+                     : pwrite(fd, buf + moved, len - moved, offset + (off_t) moved);
+
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (got < 0 || (got == 0 && !isRead)) {
+            return -1;
+        }
+
+        if (got == 0) {
+            break;
+        }
+
+        moved += (size_t) got;
+    }
+
+    return (ssize_t) moved;
+}
+
+#ifdef SLL_AIO_URING
+
+/**
+ * @brief Queues and submits a request for the rest of the range.
+ *
+ * @return 1 on success, 0 if no submission entry is free or the submit failed.
+ */
+static int queueLaneSLL(AsyncLaneSLL* lane) {
+    struct io_uring_sqe* sqe = io_uring_get_sqe(&lane->ring);
+
+    if (sqe == NULL) {
+        return 0;
+    }
+
+    if (lane->isRead) {
+        io_uring_prep_read(sqe, lane->fd, lane->buf + lane->moved, (unsigned) (lane->len - lane->moved),
+                           (unsigned long long) (lane->offset + (off_t) lane->moved));
+    } else {
+        io_uring_prep_write(sqe, lane->fd, lane->buf + lane->moved, (unsigned) (lane->len - lane->moved),
+                            (unsigned long long) (lane->offset + (off_t) lane->moved));
+    }
+
+    return io_uring_submit(&lane->ring) == 1;
+}
+
+static int startLaneSLL(AsyncLaneSLL* lane, int fd) {
+    lane->fd = fd;
+    lane->busy = 0;
+
+    return io_uring_queue_init(2, &lane->ring, 0) == 0;
+}
+
+static void submitLaneSLL(AsyncLaneSLL* lane, void* buf, size_t len, off_t offset, int isRead) {
+    lane->buf = (unsigned char*) buf;
+    lane->len = len;
+    lane->offset = offset;
+    lane->isRead = isRead;
+    lane->moved = 0;
+    lane->busy = 1;
+    lane->failed = !queueLaneSLL(lane);
+}
+
+/**
+ * @brief Waits for the outstanding request, resubmitting the remainder after a short transfer.
+ *
+ * @return Bytes transferred, or -1 on an I/O error or if a request could not be queued.
+ */
+static ssize_t waitLaneSLL(AsyncLaneSLL* lane) {
+    struct io_uring_cqe* cqe;
+    int res;
+
+    lane->busy = 0;
+
+    if (lane->failed) {
+        return -1;
+    }
+
+    for (;;) {
+        if (io_uring_wait_cqe(&lane->ring, &cqe) != 0) {
+            return -1;
+        }
+
+        res = cqe->res;
+        io_uring_cqe_seen(&lane->ring, cqe);
+
+        if (res == -EINTR || res == -EAGAIN) {
+            if (!queueLaneSLL(lane)) {
+                return -1;
+            }
+            continue;
+        }
+
+        if (res < 0 || (res == 0 && !lane->isRead)) {
+            return -1;
+        }
+
+        lane->moved += (size_t) res;
+
+        if (res == 0 || lane->moved == lane->len) {
+            return (ssize_t) lane->moved;
+        }
+
+        if (!queueLaneSLL(lane)) {
+            return -1;
+        }
+    }
+}
+
+static void stopLaneSLL(AsyncLaneSLL* lane) {
+    io_uring_queue_exit(&lane->ring);
+}
+
+#else
+
+static void* runLaneSLL(void* arg) {
+    AsyncLaneSLL* lane = (AsyncLaneSLL*) arg;
+    ssize_t result;
+
+    pthread_mutex_lock(&lane->lock);
+
+    for (;;) {
+        while (lane->state != 1 && !lane->stop) {
+            pthread_cond_wait(&lane->cond, &lane->lock);
+        }
+
+        if (lane->state != 1) {
+            break;
+        }
+
+        pthread_mutex_unlock(&lane->lock);
+        result = transferAllSLL(lane->fd, lane->buf, lane->len, lane->offset, lane->isRead);
+        pthread_mutex_lock(&lane->lock);
+
+        lane->result = result;
+        lane->state = 2;
+        pthread_cond_broadcast(&lane->cond);
+    }
+
+    pthread_mutex_unlock(&lane->lock);
+
+    return NULL;
+}
+
+static int startLaneSLL(AsyncLaneSLL* lane, int fd) {
+    lane->fd = fd;
+    lane->busy = 0;
+    lane->state = 0;
+    lane->stop = 0;
+
+    if (pthread_mutex_init(&lane->lock, NULL) != 0) {
+        return 0;
+    }
+
+    if (pthread_cond_init(&lane->cond, NULL) != 0) {
+        pthread_mutex_destroy(&lane->lock);
+        return 0;
+    }
+
+    if (pthread_create(&lane->thread, NULL, runLaneSLL, lane) != 0) {
+        pthread_cond_destroy(&lane->cond);
+        pthread_mutex_destroy(&lane->lock);
+        return 0;
+    }
+
+    return 1;
+}
+
+static void submitLaneSLL(AsyncLaneSLL* lane, void* buf, size_t len, off_t offset, int isRead) {
+    pthread_mutex_lock(&lane->lock);
+    lane->buf = (unsigned char*) buf;
+    lane->len = len;
+    lane->offset = offset;
+    lane->isRead = isRead;
+    lane->busy = 1;
+    lane->state = 1;
+    pthread_cond_broadcast(&lane->cond);
+    pthread_mutex_unlock(&lane->lock);
+}
+
+/**
+ * @brief Waits for the outstanding transfer.
+ *
+ * @return Bytes transferred, or -1 on an I/O error.
+ */
+static ssize_t waitLaneSLL(AsyncLaneSLL* lane) {
+    ssize_t result;
+
+    pthread_mutex_lock(&lane->lock);
+    while (lane->state != 2) {
+        pthread_cond_wait(&lane->cond, &lane->lock);
+    }
+    lane->state = 0;
+    lane->busy = 0;
+    result = lane->result;
+    pthread_mutex_unlock(&lane->lock);
+
+    return result;
+}
+
+static void stopLaneSLL(AsyncLaneSLL* lane) {
+    pthread_mutex_lock(&lane->lock);
+    lane->stop = 1;
+    pthread_cond_broadcast(&lane->cond);
+    pthread_mutex_unlock(&lane->lock);
+
+    pthread_join(lane->thread, NULL);
+    pthread_cond_destroy(&lane->cond);
+    pthread_mutex_destroy(&lane->lock);
+}
+
+#endif
+// -------------------------------------------------------------------------------------------->
+// ASYNC OPERATION HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Fills `op`, records the current offset of `fd` and launches `worker`.
+ *
+ * @return 1 if the operation started, 0 if `fd` is not seekable or a pipe / thread could not be
+ *         created.
+ */
+static int startAsyncSLL(SLLAsyncIO* op, void* list, int fd, void (*done)(int ok, void* ctx), void* ctx,
+                         void* (*worker)(void*)) {
+    op->fd = fd;
+    op->offset = lseek(fd, 0, SEEK_CUR);
+    op->list = list;
+    op->done = done;
+    op->ctx = ctx;
+    op->result = 0;
+    atomic_store(&op->finished, 0);
+
+    if (op->offset < 0 || pipe(op->notify) != 0) {
+        return 0;
+    }
+
+    if (pthread_create(&op->thread, NULL, worker, op) != 0) {
+        close(op->notify[0]);
+        close(op->notify[1]);
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Publishes the result, wakes pollers and runs the completion callback.
+ */
+static void finishAsyncSLL(SLLAsyncIO* op, int ok) {
+    char byte = 1;
+
+    op->result = ok;
+    atomic_store_explicit(&op->finished, 1, memory_order_release);
+
+    while (write(op->notify[1], &byte, 1) < 0 && errno == EINTR) {
+    }
+
+    if (op->done != NULL) {
+        op->done(ok, op->ctx);
+    }
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO TRACK ASYNC SLL I/O :            POLL FD / DONE / WAIT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief pollFdAsyncSLL() returns a descriptor that becomes readable once the operation has
+ *        finished. isDoneAsyncSLL() checks for completion without blocking. waitAsyncSLL()
+ *        blocks until completion, releases the worker and the descriptors, and returns the
+ *        result.
+ *
+ * @param op Pointer to a started operation.
+ *
+ * @return waitAsyncSLL: 1 if the save / load succeeded, 0 otherwise.
+ */
+int pollFdAsyncSLL(const SLLAsyncIO* op) {
+    return op->notify[0];
+}
+
+int isDoneAsyncSLL(SLLAsyncIO* op) {
+    return atomic_load_explicit(&op->finished, memory_order_acquire);
+}
+
+int waitAsyncSLL(SLLAsyncIO* op) {
+    pthread_join(op->thread, NULL);
+    close(op->notify[0]);
+    close(op->notify[1]);
+    op->notify[0] = -1;
+    op->notify[1] = -1;
+
+    return op->result;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO SAVE SLL :                       ASYNC BINARY
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Starts writing the list in the sll_io.h binary format on a worker thread.
+ *
+ * The worker alternates between two SLL_IO_BUFFER staging buffers: while one is being written,
+ * the chain is walked into the other. The header goes last, once the checksum is known, so the
+ * payload is written strictly sequentially.
+ *
+ * @param op Operation state, owned by the caller until waitAsyncSLL() returns.
+ * @param sll Pointer to the list; it must not change until the operation completes.
+ * @param fd Seekable descriptor open for writing.
+ * @param done Optional completion callback, called on the worker thread.
+ * @param ctx Passed through to `done`.
+ *
+ * @return 1 if the operation started, 0 otherwise (nothing needs to be waited for).
+ */
+#define SLL_SAVE_ASYNC(type) \
+    static void* saveWorkerSLL__##type(void* arg) { \
+        SLLAsyncIO* op = (SLLAsyncIO*) arg; \
+        SLL__##type* sll = (SLL__##type*) op->list; \
+        struct SLLNode__##type* itr = sll->head; \
+        size_t perBuffer = SLL_IO_BUFFER / sizeof(type); \
+        type* bufs[2]; \
+        unsigned char header[SLL_IO_HEADER]; \
+        uint64_t checksum = SLL_IO_SEED; \
+        off_t offset = op->offset + SLL_IO_HEADER; \
+        AsyncLaneSLL lane; \
+        size_t n, bytes; \
+        int cur = 0; \
+        int ok; \
+        \
+        bufs[0] = (type*) malloc(SLL_IO_BUFFER); \
+        bufs[1] = (type*) malloc(SLL_IO_BUFFER); \
+        ok = bufs[0] != NULL && bufs[1] != NULL && startLaneSLL(&lane, op->fd); \
+        \
+        if (ok) { \
+            while (ok && itr != NULL) { \
+                for (n = 0; n < perBuffer && itr != NULL; n++, itr = itr->next) { \
+                    bufs[cur][n] = itr->data; \
+                } \
+                \
+                bytes = n * sizeof(type); \
+                checksum = checksumPayloadSLL(checksum, (unsigned char*) bufs[cur], bytes); \
+                \
+                if (lane.busy) { \
+                    ok = waitLaneSLL(&lane) == (ssize_t) lane.len; \
+                } \
+                \
+                if (ok) { \
+                    submitLaneSLL(&lane, bufs[cur], bytes, offset, 0); \
+                    offset += (off_t) bytes; \
+                    cur ^= 1; \
+                } \
+            } \
+            \
+            if (lane.busy) { \
+                ok = waitLaneSLL(&lane) == (ssize_t) lane.len && ok; \
+            } \
+            \
+            stopLaneSLL(&lane); \
+        } \
+        \
+        encodeHeaderSLL(header, SLL_IO_TAG_##type, sizeof(type), (uint64_t) sll->size, checksum); \
+        ok = ok && transferAllSLL(op->fd, header, SLL_IO_HEADER, op->offset, 0) == SLL_IO_HEADER; \
+        ok = ok && lseek(op->fd, offset, SEEK_SET) >= 0; \
+        \
+        free(bufs[0]); \
+        free(bufs[1]); \
+        finishAsyncSLL(op, ok); \
+        \
+        return NULL; \
+    } \
+    \
+    int saveAsyncSLL__##type(SLLAsyncIO* op, SLL__##type* sll, int fd, void (*done)(int ok, void* ctx), void* ctx) { \
+        return startAsyncSLL(op, sll, fd, done, ctx, saveWorkerSLL__##type); \
+    } \
+
+SLL_SAVE_ASYNC(int)
+SLL_SAVE_ASYNC(float)
+SLL_SAVE_ASYNC(char)
+SLL_SAVE_ASYNC(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO LOAD SLL :                       ASYNC BINARY
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Starts reading a list in the sll_io.h binary format on a worker thread and appends it
+ *        to `sll`.
+ *
+ * The next chunk is already being read into one staging buffer while the worker checksums and
+ * links the previous one. As with loadSLL(), the chain is spliced onto `sll` only after the
+ * checksum matched.
+ *
+ * @param op Operation state, owned by the caller until waitAsyncSLL() returns.
+ * @param sll Pointer to the destination list; it must not be touched until completion.
+ * @param fd Seekable descriptor open for reading, positioned at a header.
+ * @param done Optional completion callback, called on the worker thread.
+ * @param ctx Passed through to `done`.
+ *
+ * @return 1 if the operation started, 0 otherwise (nothing needs to be waited for).
+ */
+#define SLL_LOAD_ASYNC(type) \
+    static void* loadWorkerSLL__##type(void* arg) { \
+        SLLAsyncIO* op = (SLLAsyncIO*) arg; \
+        SLL__##type* sll = (SLL__##type*) op->list; \
+        struct SLLNode__##type* head = NULL; \
+        struct SLLNode__##type* tail = NULL; \
+        struct SLLNode__##type* node; \
+        size_t perBuffer = SLL_IO_BUFFER / sizeof(type); \
+        type* bufs[2]; \
+        unsigned char header[SLL_IO_HEADER]; \
+        uint64_t count = 0, expected = 0, remaining; \
+        uint64_t checksum = SLL_IO_SEED; \
+        off_t offset = op->offset + SLL_IO_HEADER; \
+        AsyncLaneSLL lane; \
+        size_t n, next, i; \
+        int cur = 0; \
+        int swap = 0; \
+        int ok; \
+        \
+        bufs[0] = (type*) malloc(SLL_IO_BUFFER); \
+        bufs[1] = (type*) malloc(SLL_IO_BUFFER); \
+        ok = bufs[0] != NULL && bufs[1] != NULL && \
+             transferAllSLL(op->fd, header, SLL_IO_HEADER, op->offset, 1) == SLL_IO_HEADER && \
+             decodeHeaderSLL(header, SLL_IO_TAG_##type, sizeof(type), &count, &expected, &swap) && \
+             count <= (uint64_t) (INT_MAX - sll->size) && startLaneSLL(&lane, op->fd); \
+        \
+        if (ok) { \
+            remaining = count; \
+            \
+            if (remaining > 0) { \
+                n = remaining < perBuffer ? (size_t) remaining : perBuffer; \
+                submitLaneSLL(&lane, bufs[cur], n * sizeof(type), offset, 1); \
+            } \
+            \
+            while (ok && remaining > 0) { \
+                n = remaining < perBuffer ? (size_t) remaining : perBuffer; \
+                ok = waitLaneSLL(&lane) == (ssize_t) (n * sizeof(type)); \
+                \
+                if (!ok) { \
+                    break; \
+                } \
+                \
+                offset += (off_t) (n * sizeof(type)); \
+                remaining -= n; \
+                \
+                if (remaining > 0) { \
+                    next = remaining < perBuffer ? (size_t) remaining : perBuffer; \
+                    submitLaneSLL(&lane, bufs[cur ^ 1], next * sizeof(type), offset, 1); \
+                } \
+                \
+                checksum = checksumPayloadSLL(checksum, (unsigned char*) bufs[cur], n * sizeof(type)); \
+                \
+                if (swap) { \
+                    swapElementsSLL((unsigned char*) bufs[cur], n, sizeof(type)); \
+                } \
+                \
+                for (i = 0; i < n; i++) { \
+                    node = (struct SLLNode__##type*) malloc(sizeof(struct SLLNode__##type)); \
+                    \
+                    if (node == NULL) { \
+                        ok = 0; \
+                        break; \
+                    } \
+                    \
+                    node->data = bufs[cur][i]; \
+                    node->next = NULL; \
+                    \
+                    if (tail == NULL) { \
+                        head = node; \
+                    } else { \
+                        tail->next = node; \
+                    } \
+                    tail = node; \
+                } \
+                \
+                cur ^= 1; \
+            } \
+            \
+            if (lane.busy) { \
+                waitLaneSLL(&lane); \
+            } \
+            \
+            stopLaneSLL(&lane); \
+        } \
+        \
+        free(bufs[0]); \
+        free(bufs[1]); \
+        \
+        if (!ok || checksum != expected || lseek(op->fd, offset, SEEK_SET) < 0) { \
+            while (head != NULL) { \
+                node = head->next; \
+                free(head); \
+                head = node; \
+            } \
+            finishAsyncSLL(op, 0); \
+            return NULL; \
+        } \
+        \
+        if (head != NULL) { \
+            if (sll->tail == NULL) { \
+                sll->head = head; \
+            } else { \
+                sll->tail->next = head; \
+            } \
+            sll->tail = tail; \
+            sll->size += (int) count; \
+        } \
+        \
+        finishAsyncSLL(op, 1); \
+        \
+        return NULL; \
+    } \
+    \
+    int loadAsyncSLL__##type(SLLAsyncIO* op, SLL__##type* sll, int fd, void (*done)(int ok, void* ctx), void* ctx) { \
+        return startAsyncSLL(op, sll, fd, done, ctx, loadWorkerSLL__##type); \
+    } \
+
+SLL_LOAD_ASYNC(int)
+SLL_LOAD_ASYNC(float)
+SLL_LOAD_ASYNC(char)
+SLL_LOAD_ASYNC(double)
@@ -0,0 +1,71 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_aio.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for asynchronous (io_uring or thread backed) singly linked list save and
+ *          load.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef SLL_AIO_H
+#define SLL_AIO_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/types.h>
+#include "sll_io.h"
+
+/**
+ * @brief State of one asynchronous save or load.
+ *
+ * The operation runs on its own worker thread. Completion is reported three ways: the optional
+ * `done(ok, ctx)` callback (called on the worker thread), the read end of `notify` becoming
+ * readable (for poll / epoll loops), and waitAsyncSLL(), which must be called exactly once to
+ * release the operation.
+ */
+typedef struct {
+    pthread_t thread;
+    int notify[2];
+    int fd;
+    off_t offset;
+    void* list;
+    void (*done)(int ok, void* ctx);
+    void* ctx;
+    _Atomic int finished;
+    int result;
+} SLLAsyncIO;
+
+int pollFdAsyncSLL(const SLLAsyncIO* op);
+int isDoneAsyncSLL(SLLAsyncIO* op);
+int waitAsyncSLL(SLLAsyncIO* op);
+
+/**
+ * @brief Macro to declare function prototypes for asynchronous singly linked list save / load.
+ *
+ * Files use the binary format of sll_io.h, so saveAsyncSLL() output can be read by loadSLL()
+ * and vice versa. I/O starts at the current offset of `fd`, which must be seekable; on success
+ * the offset is left just past the payload.
+ *
+ * The list belongs to the operation until it completes: it must not be modified (save) or
+ * touched at all (load) before waitAsyncSLL() returns.
+ *
+ * Built with `-DSLL_AIO_URING` (and `-luring`), the staging buffers are written and read through
+ * io_uring. Otherwise a helper thread performs the pread() / pwrite() calls.
+ *
+ * @param type The data type for the singly linked list.
+ */
+#define SLL_AIO_PROTO(type) \
+    int saveAsyncSLL__##type(SLLAsyncIO* op, SLL__##type* sll, int fd, void (*done)(int ok, void* ctx), void* ctx); \
+    int loadAsyncSLL__##type(SLLAsyncIO* op, SLL__##type* sll, int fd, void (*done)(int ok, void* ctx), void* ctx); \
+
+SLL_AIO_PROTO(int)
+SLL_AIO_PROTO(float)
+SLL_AIO_PROTO(char)
+SLL_AIO_PROTO(double)
+
+// Macro aliases for function calls
+#define saveAsyncSLL(op, sll, fd, done, ctx, type) saveAsyncSLL__##type(op, sll, fd, done, ctx)
+#define loadAsyncSLL(op, sll, fd, done, ctx, type) loadAsyncSLL__##type(op, sll, fd, done, ctx)
+
+
+#endif /* SLL_AIO_H */
@@ -0,0 +1,327 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_circular.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the sll_circular.h header file containing the circular singly
+ *          linked list.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "sll_circular.h"
+
+// -------------------------------------------------------------------------------------------->
+// CIRCULAR SLL HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Generates the static helpers for one element type.
+ *
+ * - link: links `node` in between `tail` and `head`; the caller decides which end moves.
+ * - nodeAt: returns the node at position `idx` from the head, which must be in range.
+ */
+#define CIRCULAR_SLL_HELPERS(type) \
+    static void linkCircularSLL__##type(CircularSLL__##type* csll, struct SLLNode__##type* node) { \
+        if (csll->size == 0) { \
+            node->next = node; \
+            csll->head = node; \
+            csll->tail = node; \
+        } else { \
+            node->next = csll->head; \
+            csll->tail->next = node; \
+        } \
+        \
+        csll->size++; \
+    } \
+    \
+    static struct SLLNode__##type* nodeAtCircularSLL__##type(CircularSLL__##type* csll, int idx) { \
+        struct SLLNode__##type* node = csll->head; \
+        \
+        while (idx-- > 0) { \
+            node = node->next; \
+        } \
+        \
+        return node; \
+    } \
+
+CIRCULAR_SLL_HELPERS(int)
+CIRCULAR_SLL_HELPERS(float)
+CIRCULAR_SLL_HELPERS(char)
+CIRCULAR_SLL_HELPERS(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE CIRCULAR SLL :        EMPTY / ADOPT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief initCircularSLL() makes an empty list. adoptCircularSLL() takes over the nodes of
+ *        `sll` in O(1) by closing its tail onto its head, and leaves `sll` empty.
+ *
+ * @param csll Pointer to the circular list.
+ * @param sll Pointer to the list whose nodes are taken over.
+ */
+#define CIRCULAR_SLL_INIT(type) \
+    void initCircularSLL__##type(CircularSLL__##type* csll) { \
+        csll->head = NULL; \
+        csll->tail = NULL; \
+        csll->size = 0; \
+    } \
+    \
+    void adoptCircularSLL__##type(CircularSLL__##type* csll, SLL__##type* sll) { \
+        csll->head = sll->head; \
+        csll->tail = sll->tail; \
+        csll->size = sll->size; \
+        \
+        if (csll->tail != NULL) { \
+            csll->tail->next = csll->head; \
+        } \
+        \
+        sll->head = NULL; \
+        sll->tail = NULL; \
+        sll->size = 0; \
+    } \
+
+CIRCULAR_SLL_INIT(int)
+CIRCULAR_SLL_INIT(float)
+CIRCULAR_SLL_INIT(char)
+CIRCULAR_SLL_INIT(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INSERT DATA TO CIRCULAR SLL :    HEAD / TAIL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Inserts a new element before the head or after the tail. Both link the node between
+ *        `tail` and `head`; they differ only in which of the two then points at it.
+ *
+ * @param csll Pointer to the circular list.
+ * @param data The data to insert.
+ * @return 1 on success, 0 if the node could not be allocated.
+ */
+#define CIRCULAR_SLL_INSERT(type) \
+    int insertAtHeadCircularSLL__##type(CircularSLL__##type* csll, type data) { \
+        struct SLLNode__##type* node = (struct SLLNode__##type*) malloc(sizeof(struct SLLNode__##type)); \
+        \
+        if (node == NULL) { \
+            return 0; \
+        } \
+        \
+        node->data = data; \
+        linkCircularSLL__##type(csll, node); \
+        csll->head = node; \
+        return 1; \
+    } \
+    \
+    int insertAtTailCircularSLL__##type(CircularSLL__##type* csll, type data) { \
+        struct SLLNode__##type* node = (struct SLLNode__##type*) malloc(sizeof(struct SLLNode__##type)); \
+        \
+        if (node == NULL) { \
+            return 0; \
+        } \
+        \
+        node->data = data; \
+        linkCircularSLL__##type(csll, node); \
+        csll->tail = node; \
+        return 1; \
+    } \
+
+CIRCULAR_SLL_INSERT(int)
+CIRCULAR_SLL_INSERT(float)
+CIRCULAR_SLL_INSERT(char)
+CIRCULAR_SLL_INSERT(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DELETE DATA OF CIRCULAR SLL :    HEAD / VALUE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief popHeadCircularSLL() removes the head and stores its data in `out` (which may be
+ *        NULL), returning 0 if the list is empty; deleteHeadCircularSLL() does the same without
+ *        reporting. deleteCircularSLL() removes the first element equal to `targetData`,
+ *        searching one lap from the head, and returns 1 if it found one.
+ *
+ * @param csll Pointer to the circular list.
+ */
+#define CIRCULAR_SLL_DELETE(type) \
+    int popHeadCircularSLL__##type(CircularSLL__##type* csll, type* out) { \
+        struct SLLNode__##type* node = csll->head; \
+        \
+        if (node == NULL) { \
+            return 0; \
+        } \
+        \
+        if (out != NULL) { \
+            *out = node->data; \
+        } \
+        \
+        if (--csll->size == 0) { \
+            csll->head = NULL; \
+            csll->tail = NULL; \
+        } else { \
+            csll->head = node->next; \
+            csll->tail->next = csll->head; \
+        } \
+        \
+        free(node); \
+        return 1; \
+    } \
+    \
+    void deleteHeadCircularSLL__##type(CircularSLL__##type* csll) { \
+        popHeadCircularSLL__##type(csll, NULL); \
+    } \
+    \
+    int deleteCircularSLL__##type(CircularSLL__##type* csll, type targetData) { \
+        struct SLLNode__##type* prev = csll->tail; \
+        struct SLLNode__##type* node; \
+        int i; \
+        \
+        for (i = 0; i < csll->size; i++) { \
+            node = prev->next; \
+            \
+            if (node->data == targetData) { \
+                if (i == 0) { \
+                    return popHeadCircularSLL__##type(csll, NULL); \
+                } \
+                \
+                prev->next = node->next; \
+                \
+                if (node == csll->tail) { \
+                    csll->tail = prev; \
+                } \
+                \
+                csll->size--; \
+                free(node); \
+                return 1; \
+            } \
+            \
+            prev = node; \
+        } \
+        \
+        return 0; \
+    } \
+
+CIRCULAR_SLL_DELETE(int)
+CIRCULAR_SLL_DELETE(float)
+CIRCULAR_SLL_DELETE(char)
+CIRCULAR_SLL_DELETE(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO ROTATE CIRCULAR SLL :            BY K / ONE ROUND-ROBIN TICK
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief rotateCircularSLL() makes the element at position k mod n the new head, by moving
+ *        `tail` forward k mod n nodes; a negative k rotates backwards. No node is allocated,
+ *        freed or relinked. nextCircularSLL() returns the head's data (or `data404Response`
+ *        if the list is empty) and then rotates by one.
+ *
+ * @param csll Pointer to the circular list.
+ * @param k Number of positions to rotate forward.
+ */
+#define CIRCULAR_SLL_ROTATE(type) \
+    void rotateCircularSLL__##type(CircularSLL__##type* csll, int k) { \
+        if (csll->size == 0) { \
+            return; \
+        } \
+        \
+        k %= csll->size; \
+        \
+        if (k < 0) { \
+            k += csll->size; \
+        } \
+        \
+        while (k-- > 0) { \
+            csll->tail = csll->tail->next; \
+        } \
+        \
+        csll->head = csll->tail->next; \
+    } \
+    \
+    type nextCircularSLL__##type(CircularSLL__##type* csll, type data404Response) { \
+        type data; \
+        \
+        if (csll->size == 0) { \
+            return data404Response; \
+        } \
+        \
+        data = csll->head->data; \
+        csll->tail = csll->head; \
+        csll->head = csll->head->next; \
+        return data; \
+    } \
+
+CIRCULAR_SLL_ROTATE(int)
+CIRCULAR_SLL_ROTATE(float)
+CIRCULAR_SLL_ROTATE(char)
+CIRCULAR_SLL_ROTATE(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO GET / UPDATE / VISIT DATA OF CIRCULAR SLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Positional access counts from the current head. getDataAtCircularSLL() returns
+ *        `data404Response` and updateAtCircularSLL() does nothing for an index outside
+ *        [0, size). forEachCircularSLL() calls `visit(data, ctx)` once per element, starting
+ *        at the head and stopping after one lap.
+ *
+ * @param csll Pointer to the circular list.
+ */
+#define CIRCULAR_SLL_ACCESS(type) \
+    type getDataAtCircularSLL__##type(CircularSLL__##type* csll, int targetIdx, type data404Response) { \
+        if (targetIdx < 0 || targetIdx >= csll->size) { \
+            return data404Response; \
+        } \
+        \
+        return nodeAtCircularSLL__##type(csll, targetIdx)->data; \
+    } \
+    \
+    void updateAtCircularSLL__##type(CircularSLL__##type* csll, int targetIdx, type newData) { \
+        if (targetIdx < 0 || targetIdx >= csll->size) { \
+            return; \
+        } \
+        \
+        nodeAtCircularSLL__##type(csll, targetIdx)->data = newData; \
+    } \
+    \
+    int sizeCircularSLL__##type(CircularSLL__##type* csll) { \
+        return csll->size; \
+    } \
+    \
+    void forEachCircularSLL__##type(CircularSLL__##type* csll, \
+                                    void (*visit)(type data, void* ctx), void* ctx) { \
+        struct SLLNode__##type* node = csll->head; \
+        int i; \
+        \
+        for (i = 0; i < csll->size; i++) { \
+            visit(node->data, ctx); \
+            node = node->next; \
+        } \
+    } \
+
+CIRCULAR_SLL_ACCESS(int)
+CIRCULAR_SLL_ACCESS(float)
+CIRCULAR_SLL_ACCESS(char)
+CIRCULAR_SLL_ACCESS(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FREE CIRCULAR SLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Frees every node and leaves the list empty.
+ *
+ * @param csll Pointer to the circular list.
+ */
+#define CIRCULAR_SLL_FREE(type) \
+    void freeCircularSLL__##type(CircularSLL__##type* csll) { \
+        struct SLLNode__##type* node = csll->head; \
+        struct SLLNode__##type* next; \
+        \
+        while (csll->size-- > 0) { \
+            next = node->next; \
+            free(node); \
+            node = next; \
+        } \
+        \
+        csll->head = NULL; \
+        csll->tail = NULL; \
+        csll->size = 0; \
+    } \
+
+CIRCULAR_SLL_FREE(int)
+CIRCULAR_SLL_FREE(float)
+CIRCULAR_SLL_FREE(char)
+CIRCULAR_SLL_FREE(double)
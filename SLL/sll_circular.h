@@ -0,0 +1,87 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_circular.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the circular singly linked list with allocation-free rotation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef SLL_CIRCULAR_H
+#define SLL_CIRCULAR_H
+
+#include "sll.h"
+
+/**
+ * @brief Macro to declare a circular singly linked list for a specific data type.
+ *
+ * Uses the SLLNode__type nodes of sll.h, but the last node links back to the first:
+ * `tail->next == head` whenever the list is not empty. It has its own struct rather than an
+ * SLL__type so that it cannot be passed to sll.h functions, which would never reach a NULL.
+ *
+ * @param type The data type for the list.
+ */
+#define DECLARE_CIRCULAR_SLL(type) \
+    typedef struct { \
+        struct SLLNode__##type* head; \
+        struct SLLNode__##type* tail; \
+        int size; \
+    } CircularSLL__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for circular singly linked list operations.
+ *
+ * Rotation only moves `head` and `tail` and never allocates: rotating by k costs k mod n
+ * steps, and a negative k rotates backwards (n - k steps, as the links only go forward).
+ * nextCircularSLL() returns the head and rotates by one, which is a complete round-robin tick.
+ * Iteration stops after one lap.
+ *
+ * @param type The data type for the list.
+ */
+#define CIRCULAR_SLL_PROTO(type) \
+    void initCircularSLL__##type(CircularSLL__##type* csll); \
+    void adoptCircularSLL__##type(CircularSLL__##type* csll, SLL__##type* sll); \
+    int insertAtHeadCircularSLL__##type(CircularSLL__##type* csll, type data); \
+    int insertAtTailCircularSLL__##type(CircularSLL__##type* csll, type data); \
+    int popHeadCircularSLL__##type(CircularSLL__##type* csll, type* out); \
+    void deleteHeadCircularSLL__##type(CircularSLL__##type* csll); \
+    int deleteCircularSLL__##type(CircularSLL__##type* csll, type targetData); \
+    void rotateCircularSLL__##type(CircularSLL__##type* csll, int k); \
+    type nextCircularSLL__##type(CircularSLL__##type* csll, type data404Response); \
+    type getDataAtCircularSLL__##type(CircularSLL__##type* csll, int targetIdx, type data404Response); \
+    void updateAtCircularSLL__##type(CircularSLL__##type* csll, int targetIdx, type newData); \
+    int sizeCircularSLL__##type(CircularSLL__##type* csll); \
+    void forEachCircularSLL__##type(CircularSLL__##type* csll, void (*visit)(type data, void* ctx), void* ctx); \
+    void freeCircularSLL__##type(CircularSLL__##type* csll); \
+
+// Declaration for int data type
+DECLARE_CIRCULAR_SLL(int);
+// Declaration for float data type
+DECLARE_CIRCULAR_SLL(float);
+// Declaration for char data type
+DECLARE_CIRCULAR_SLL(char);
+// Declaration for double data type
+DECLARE_CIRCULAR_SLL(double);
+
+CIRCULAR_SLL_PROTO(int)
+CIRCULAR_SLL_PROTO(float)
+CIRCULAR_SLL_PROTO(char)
+CIRCULAR_SLL_PROTO(double)
+
+// Macro aliases for function calls
+#define initCircularSLL(csll, type) initCircularSLL__##type(csll)
+#define adoptCircularSLL(csll, sll, type) adoptCircularSLL__##type(csll, sll)
+#define insertAtHeadCircularSLL(csll, data, type) insertAtHeadCircularSLL__##type(csll, data)
+#define insertAtTailCircularSLL(csll, data, type) insertAtTailCircularSLL__##type(csll, data)
+#define popHeadCircularSLL(csll, out, type) popHeadCircularSLL__##type(csll, out)
+#define deleteHeadCircularSLL(csll, type) deleteHeadCircularSLL__##type(csll)
+#define deleteCircularSLL(csll, targetData, type) deleteCircularSLL__##type(csll, targetData)
+#define rotateCircularSLL(csll, k, type) rotateCircularSLL__##type(csll, k)
+#define nextCircularSLL(csll, data404Response, type) nextCircularSLL__##type(csll, data404Response)
+#define getDataAtCircularSLL(csll, targetIdx, data404Response, type) getDataAtCircularSLL__##type(csll, targetIdx, data404Response)
+#define updateAtCircularSLL(csll, targetIdx, newData, type) updateAtCircularSLL__##type(csll, targetIdx, newData)
+#define sizeCircularSLL(csll, type) sizeCircularSLL__##type(csll)
+#define forEachCircularSLL(csll, visit, ctx, type) forEachCircularSLL__##type(csll, visit, ctx)
+#define freeCircularSLL(csll, type) freeCircularSLL__##type(csll)
+
+
+#endif /* SLL_CIRCULAR_H */
@@ -0,0 +1,90 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_column.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the sll_column.h header file containing the columnar export / import
+ *          of singly linked lists.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include <limits.h>
+#include "sll_column.h"
+#include "sll_view.h"
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO EXPORT SLL :                     COLUMNAR FILE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Writes the list to `path` as a single column.
+ *
+ * The nodes are walked once straight into the writer's chunk buffer, so no array of the whole
+ * list is built and no text is formatted on the way.
+ *
+ * @param sll Pointer to the singly linked list structure.
+ * @param path Output file.
+ * @param chunkElems Elements per chunk; 0 or less selects COLUMN_CHUNK_ELEMS.
+ * @param withStats Non-zero to store the min and max of every chunk.
+ *
+ * @return 1 on success, 0 on an I/O or allocation error.
+ */
+#define SLL_EXPORT_COLUMN(type) \
+    int exportColumnSLL__##type(SLL__##type* sll, const char* path, int chunkElems, int withStats) { \
+        ColumnWriter__##type w; \
+        struct SLLNode__##type* node; \
+        \
+        if (!openColumnWriter__##type(&w, path, chunkElems, withStats)) { \
+            return 0; \
+        } \
+        \
+        for (node = sll->head; node != NULL && !w.error; node = node->next) { \
+            appendColumn__##type(&w, node->data); \
+        } \
+        \
+        return closeColumnWriter__##type(&w); \
+    } \
+
+SLL_EXPORT_COLUMN(int)
+SLL_EXPORT_COLUMN(float)
+SLL_EXPORT_COLUMN(char)
+SLL_EXPORT_COLUMN(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO IMPORT SLL :                     COLUMNAR FILE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Appends every value of the column in `path` to `sll`.
+ *
+ * The file is mapped and materialised through a read-only view, so it is read exactly once and
+ * a failure leaves `sll` unchanged.
+ *
+ * @param sll Pointer to the singly linked list structure (may already hold data).
+ * @param path Column file written by exportColumnSLL() or a ColumnWriter.
+ *
+ * @return 1 on success, 0 if the file is not a valid column of this type, is too long for a
+ *         list, or memory ran out.
+ */
+#define SLL_IMPORT_COLUMN(type) \
+    int importColumnSLL__##type(SLL__##type* sll, const char* path) { \
+        ColumnReader__##type r; \
+        SLLView__##type view; \
+        int ok; \
+        \
+        if (!openColumnReader__##type(&r, path)) { \
+            return 0; \
+        } \
+        \
+        ok = r.count <= (uint64_t) (INT_MAX - sll->size); \
+        \
+        if (ok) { \
+            initSLLView__##type(&view, r.data, (int) r.count); \
+            ok = materializeSLLView__##type(&view, sll); \
+        } \
+        \
+        closeColumnReader__##type(&r); \
+        \
+        return ok; \
+    } \
+
+SLL_IMPORT_COLUMN(int)
+SLL_IMPORT_COLUMN(float)
+SLL_IMPORT_COLUMN(char)
+SLL_IMPORT_COLUMN(double)
@@ -0,0 +1,38 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_column.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for exporting singly linked lists to columnar files and importing them
+ *          back.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef SLL_COLUMN_H
+#define SLL_COLUMN_H
+
+#include "sll.h"
+#include "../COLUMN/column.h"
+
+/**
+ * @brief Macro to declare function prototypes for columnar export / import of a list.
+ *
+ * The file format is the one described in column.h, so the exported file can be mapped with
+ * openColumnReader() and scanned chunk by chunk.
+ *
+ * @param type The data type for the list.
+ */
+#define SLL_COLUMN_PROTO(type) \
+    int exportColumnSLL__##type(SLL__##type* sll, const char* path, int chunkElems, int withStats); \
+    int importColumnSLL__##type(SLL__##type* sll, const char* path); \
+
+SLL_COLUMN_PROTO(int)
+SLL_COLUMN_PROTO(float)
+SLL_COLUMN_PROTO(char)
+SLL_COLUMN_PROTO(double)
+
+// Macro aliases for function calls
+#define exportColumnSLL(sll, path, chunkElems, withStats, type) exportColumnSLL__##type(sll, path, chunkElems, withStats)
+#define importColumnSLL(sll, path, type) importColumnSLL__##type(sll, path)
+
+
+#endif /* SLL_COLUMN_H */
@@ -0,0 +1,44 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_heap.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the sll_heap.h header file containing the list to heap bulk build.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "sll_heap.h"
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO BUILD HEAP FROM SLL :            O(n)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Adds every element of `sll` to the heap `h` and restores the heap order bottom-up.
+ *
+ * The heap array is grown once, the nodes are copied straight into it in one walk, and
+ * rebuildHEAP() then orders the whole array in O(n), instead of one O(log n) push per element.
+ * The list is left unchanged.
+ *
+ * @param h Pointer to the heap.
+ * @param sll Pointer to the list.
+ * @return 1 on success, 0 if the heap could not grow (the heap is unchanged).
+ */
+#define SLL_HEAPIFY(type) \
+    int heapifyFromSLL__##type(HEAP__##type* h, SLL__##type* sll) { \
+        struct SLLNode__##type* node; \
+        \
+        if (!reserveHEAP__##type(h, h->size + sll->size)) { \
+            return 0; \
+        } \
+        \
+        for (node = sll->head; node != NULL; node = node->next) { \
+            h->data[h->size++] = node->data; \
+        } \
+        \
+        rebuildHEAP__##type(h); \
+        return 1; \
+    } \
+
+SLL_HEAPIFY(int)
+SLL_HEAPIFY(float)
+SLL_HEAPIFY(char)
+SLL_HEAPIFY(double)
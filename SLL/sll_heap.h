@@ -0,0 +1,34 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_heap.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for building heaps from singly linked lists.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef SLL_HEAP_H
+#define SLL_HEAP_H
+
+#include "sll.h"
+#include "../HEAP/heap.h"
+
+/**
+ * @brief Macro to declare function prototypes for building a heap from a list.
+ *
+ * The heap types and operations are the ones described in heap.h.
+ *
+ * @param type The data type for the list.
+ */
+#define SLL_HEAP_PROTO(type) \
+    int heapifyFromSLL__##type(HEAP__##type* h, SLL__##type* sll); \
+
+SLL_HEAP_PROTO(int)
+SLL_HEAP_PROTO(float)
+SLL_HEAP_PROTO(char)
+SLL_HEAP_PROTO(double)
+
+// Macro aliases for function calls
+#define heapifyFromSLL(h, sll, type) heapifyFromSLL__##type(h, sll)
+
+
+#endif /* SLL_HEAP_H */
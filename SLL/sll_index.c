@@ -0,0 +1,579 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_index.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the sll_index.h header file containing the skip-list index over a
+ *          singly linked list.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "sll_index.h"
+
+// -------------------------------------------------------------------------------------------->
+// INDEX HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Draws the number of lanes for a new node: k lanes with probability (1/4)^k * 3/4.
+ *
+ * Uses two bits of one xorshift32 draw per level, which covers all SLL_INDEX_MAX_LEVEL levels.
+ */
+static int randomHeightIndexedSLL(uint32_t* seed) {
+    uint32_t r = *seed;
+    int height = 0;
+
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    *seed = r;
+
+    while (height < SLL_INDEX_MAX_LEVEL && (r & 3) == 0) {
+        height++;
+        r >>= 2;
+    }
+
+    return height;
+}
+
+/**
+ * @brief Generates the static lane helpers for one element type.
+ *
+ * - search: for every lane, stores in `update` the last lane node at a position up to `target`
+ *   (-1 selects the sentinels) and its position in `rank`. O(log n) expected.
+ * - walk: steps along the list from the node of `lane` (at position `pos`) to position
+ *   `target`; the sentinel stands for position -1, so walking to -1 returns NULL. The lanes
+ *   leave an expected 3 steps.
+ * - bound: the value-ordered counterpart of search + walk for a sorted list. Returns the
+ *   position of the first element not less than `value` (greater than, if `upper`), fills
+ *   `update` / `rank` for the position before it and stores the node there in `pred`.
+ * - link: links `node` in at position `idx`, after `pred`, and gives it a random number of
+ *   lanes; `update` / `rank` must describe position `idx - 1`. A lane node that cannot be
+ *   allocated just leaves the node with fewer lanes.
+ * - unlinkRange: unlinks and frees the `count` elements starting at position `idx`, after
+ *   `pred`, together with their lane nodes, in O(log n + count).
+ */
+#define INDEXED_SLL_HELPERS(type) \
+    static void searchIndexedSLL__##type(IndexedSLL__##type* isll, int target, struct SLLLane__##type** update, int* rank) { \
+        struct SLLLane__##type* lane; \
+        int pos = -1, l; \
+        \
+        if (isll->levels == 0) { \
+            return; \
+        } \
+        \
+        lane = &isll->heads[isll->levels - 1]; \
+        \
+        for (l = isll->levels - 1; l >= 0; l--) { \
+            while (lane->next != NULL && pos + lane->span <= target) { \
+                pos += lane->span; \
+                lane = lane->next; \
+            } \
+            \
+            update[l] = lane; \
+            rank[l] = pos; \
+            lane = lane->down; \
+        } \
+    } \
+    \
+    static struct SLLNode__##type* walkIndexedSLL__##type(IndexedSLL__##type* isll, struct SLLLane__##type* lane, int pos, int target) { \
+        struct SLLNode__##type* node = lane != NULL ? lane->node : NULL; \
+        \
+        if (node == NULL) { \
+            if (target < 0) { \
+                return NULL; \
+            } \
+            node = isll->list.head; \
+            pos = 0; \
+        } \
+        \
+        while (pos < target) { \
+            node = node->next; \
+            pos++; \
+        } \
+        \
+        return node; \
+    } \
+    \
+    static int boundIndexedSLL__##type(IndexedSLL__##type* isll, type value, int upper, struct SLLLane__##type** update, int* rank, struct SLLNode__##type** pred) { \
+        struct SLLLane__##type* lane = isll->levels > 0 ? &isll->heads[isll->levels - 1] : NULL; \
+        struct SLLNode__##type* node; \
+        struct SLLNode__##type* next; \
+        int pos = -1, l; \
+        \
+        for (l = isll->levels - 1; l >= 0; l--) { \
+            while (lane->next != NULL && (upper ? lane->next->key <= value : lane->next->key < value)) { \
+                pos += lane->span; \
+                lane = lane->next; \
+            } \
+            \
+            update[l] = lane; \
+            rank[l] = pos; \
+            lane = lane->down; \
+        } \
+        \
+        node = isll->levels > 0 ? update[0]->node : NULL; \
+        next = node != NULL ? node->next : isll->list.head; \
+        \
+        while (next != NULL && (upper ? next->data <= value : next->data < value)) { \
+            node = next; \
+            next = next->next; \
+            pos++; \
+        } \
+        \
+        *pred = node; \
+        \
+        return pos + 1; \
+    } \
+    \
+    static void linkIndexedSLL__##type(IndexedSLL__##type* isll, struct SLLNode__##type* node, int idx, struct SLLLane__##type** update, int* rank, struct SLLNode__##type* pred) { \
+        struct SLLLane__##type* below = NULL; \
+        struct SLLLane__##type* lane; \
+        int height = randomHeightIndexedSLL(&isll->seed), l; \
+        \
+        for (l = isll->levels; l < height; l++) { \
+            isll->heads[l].next = NULL; \
+            isll->heads[l].span = isll->list.size + 1; \
+            update[l] = &isll->heads[l]; \
+            rank[l] = -1; \
+        } \
+        \
+        isll->levels = height > isll->levels ? height : isll->levels; \
+        \
+        for (l = 0; l < isll->levels; l++) { \
+            lane = l < height ? (struct SLLLane__##type*) malloc(sizeof(struct SLLLane__##type)) : NULL; \
+            \
+            if (lane == NULL) { \
+                height = l; \
+                update[l]->span++; \
+                continue; \
+            } \
+            \
+            lane->node = node; \
+            lane->key = node->data; \
+            lane->down = below; \
+            lane->next = update[l]->next; \
+            lane->span = rank[l] + update[l]->span + 1 - idx; \
+            update[l]->next = lane; \
+            update[l]->span = idx - rank[l]; \
+            below = lane; \
+        } \
+        \
+        node->next = pred != NULL ? pred->next : isll->list.head; \
+        \
+        if (pred != NULL) { \
+            pred->next = node; \
+        } else { \
+            isll->list.head = node; \
+        } \
+        \
+        if (node->next == NULL) { \
+            isll->list.tail = node; \
+        } \
+        \
+        isll->list.size++; \
+        \
+        while (isll->levels > 0 && isll->heads[isll->levels - 1].next == NULL) { \
+            isll->levels--; \
+        } \
+    } \
+    \
+    static void unlinkRangeIndexedSLL__##type(IndexedSLL__##type* isll, int idx, int count, struct SLLLane__##type** update, int* rank, struct SLLNode__##type* pred) { \
+        struct SLLLane__##type* lane; \
+        struct SLLNode__##type* node; \
+        struct SLLNode__##type* next; \
+        int l, i; \
+        \
+        for (l = 0; l < isll->levels; l++) { \
+            while ((lane = update[l]->next) != NULL && rank[l] + update[l]->span < idx + count) { \
+                update[l]->span += lane->span; \
+                update[l]->next = lane->next; \
+                free(lane); \
+            } \
+            \
+            update[l]->span -= count; \
+        } \
+        \
+        node = pred != NULL ? pred->next : isll->list.head; \
+        \
+        for (i = 0; i < count; i++) { \
+            next = node->next; \
+            free(node); \
+            node = next; \
+        } \
+        \
+        if (pred != NULL) { \
+            pred->next = node; \
+        } else { \
+            isll->list.head = node; \
+        } \
+        \
+        if (node == NULL) { \
+            isll->list.tail = pred; \
+        } \
+        \
+        isll->list.size -= count; \
+        \
+        while (isll->levels > 0 && isll->heads[isll->levels - 1].next == NULL) { \
+            isll->levels--; \
+        } \
+    } \
+
+INDEXED_SLL_HELPERS(int)
+INDEXED_SLL_HELPERS(float)
+INDEXED_SLL_HELPERS(char)
+INDEXED_SLL_HELPERS(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE INDEXED SLL :         EMPTY / ADOPT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief initIndexedSLL() makes an empty indexed list; adoptIndexedSLL() takes over the nodes of
+ *        an existing list and builds its lanes.
+ *
+ * Adopting moves the nodes without copying them and builds every lane in one O(n) pass, which
+ * is much faster than inserting the elements one by one. Whatever `isll` held before is freed,
+ * and `sll` is left empty. If a lane node cannot be allocated, that node simply gets fewer
+ * lanes: the index stays correct, only a little slower.
+ *
+ * @param isll Pointer to the indexed list.
+ * @param sll Pointer to the list whose nodes are taken over.
+ */
+#define INDEXED_SLL_INIT(type) \
+    void initIndexedSLL__##type(IndexedSLL__##type* isll) { \
+        int l; \
+        \
+        isll->list.head = NULL; \
+        isll->list.tail = NULL; \
+        isll->list.size = 0; \
+        isll->levels = 0; \
+        isll->seed = 0x9e3779b9u; \
+        \
+        for (l = 0; l < SLL_INDEX_MAX_LEVEL; l++) { \
+            isll->heads[l].next = NULL; \
+            isll->heads[l].down = l > 0 ? &isll->heads[l - 1] : NULL; \
+            isll->heads[l].node = NULL; \
+            isll->heads[l].span = 1; \
+        } \
+    } \
+    \
+    void adoptIndexedSLL__##type(IndexedSLL__##type* isll, SLL__##type* sll) { \
+        struct SLLLane__##type* last[SLL_INDEX_MAX_LEVEL]; \
+        struct SLLLane__##type* lane; \
+        struct SLLNode__##type* node; \
+        int lastPos[SLL_INDEX_MAX_LEVEL]; \
+        int pos = 0, height, l; \
+        \
+        freeIndexedSLL__##type(isll); \
+        isll->list = *sll; \
+        sll->head = NULL; \
+        sll->tail = NULL; \
+        sll->size = 0; \
+        \
+        for (l = 0; l < SLL_INDEX_MAX_LEVEL; l++) { \
+            last[l] = &isll->heads[l]; \
+            lastPos[l] = -1; \
+        } \
+        \
+        for (node = isll->list.head; node != NULL; node = node->next, pos++) { \
+            height = randomHeightIndexedSLL(&isll->seed); \
+            \
+            for (l = 0; l < height; l++) { \
+                lane = (struct SLLLane__##type*) malloc(sizeof(struct SLLLane__##type)); \
+                \
+                if (lane == NULL) { \
+                    break; \
+                } \
+                \
+                lane->node = node; \
+                lane->key = node->data; \
+                lane->down = l > 0 ? last[l - 1] : NULL; \
+                last[l]->next = lane; \
+                last[l]->span = pos - lastPos[l]; \
+                last[l] = lane; \
+                lastPos[l] = pos; \
+            } \
+            \
+            isll->levels = l > isll->levels ? l : isll->levels; \
+        } \
+        \
+        for (l = 0; l < isll->levels; l++) { \
+            last[l]->next = NULL; \
+            last[l]->span = isll->list.size - lastPos[l]; \
+        } \
+    } \
+
+INDEXED_SLL_INIT(int)
+INDEXED_SLL_INIT(float)
+INDEXED_SLL_INIT(char)
+INDEXED_SLL_INIT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INSERT DATA TO INDEXED SLL :     K'th Index / HEAD / TAIL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Inserts `data` at `targetIdx` in O(log n) expected time.
+ *
+ * As in insertAt(), an index at or below 0 inserts at the head and one at or past the size
+ * inserts at the tail. The new node gets a random number of lanes; every lane it does not reach
+ * only has the span over it incremented.
+ *
+ * @param isll Pointer to the indexed list.
+ * @param data Data to be inserted.
+ * @param targetIdx Index at which the new element should end up.
+ *
+ * @return 1 on success, 0 if the node could not be allocated.
+ */
+#define INDEXED_SLL_INSERT(type) \
+    int insertAtIndexedSLL__##type(IndexedSLL__##type* isll, type data, int targetIdx) { \
+        struct SLLLane__##type* update[SLL_INDEX_MAX_LEVEL]; \
+        struct SLLNode__##type* pred; \
+        struct SLLNode__##type* node; \
+        int rank[SLL_INDEX_MAX_LEVEL]; \
+        int idx; \
+        \
+        idx = targetIdx < 0 ? 0 : (targetIdx > isll->list.size ? isll->list.size : targetIdx); \
+        node = (struct SLLNode__##type*) malloc(sizeof(struct SLLNode__##type)); \
+        \
+        if (node == NULL) { \
+            return 0; \
+        } \
+        \
+        node->data = data; \
+        searchIndexedSLL__##type(isll, idx - 1, update, rank); \
+        pred = walkIndexedSLL__##type(isll, isll->levels > 0 ? update[0] : NULL, isll->levels > 0 ? rank[0] : -1, idx - 1); \
+        linkIndexedSLL__##type(isll, node, idx, update, rank, pred); \
+        \
+        return 1; \
+    } \
+    \
+    int insertAtHeadIndexedSLL__##type(IndexedSLL__##type* isll, type data) { \
+        return insertAtIndexedSLL__##type(isll, data, 0); \
+    } \
+    \
+    int insertAtTailIndexedSLL__##type(IndexedSLL__##type* isll, type data) { \
+        return insertAtIndexedSLL__##type(isll, data, isll->list.size); \
+    } \
+
+INDEXED_SLL_INSERT(int)
+INDEXED_SLL_INSERT(float)
+INDEXED_SLL_INSERT(char)
+INDEXED_SLL_INSERT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DELETE DATA OF INDEXED SLL :     K'th Index / HEAD
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes the element at `targetIdx` in O(log n) expected time. Out-of-range and
+ *        negative indices are ignored, as in deleteAt().
+ *
+ * Lanes that had a node on the removed element lose it and absorb its span; the others have the
+ * span over it decremented. Lanes left empty at the top are dropped.
+ *
+ * @param isll Pointer to the indexed list.
+ * @param targetIdx Index of the element to remove.
+ */
+#define INDEXED_SLL_DELETE(type) \
+    void deleteAtIndexedSLL__##type(IndexedSLL__##type* isll, int targetIdx) { \
+        struct SLLLane__##type* update[SLL_INDEX_MAX_LEVEL]; \
+        struct SLLNode__##type* pred; \
+        int rank[SLL_INDEX_MAX_LEVEL]; \
+        \
+        if (targetIdx < 0 || targetIdx >= isll->list.size) { \
+            return; \
+        } \
+        \
+        searchIndexedSLL__##type(isll, targetIdx - 1, update, rank); \
+        pred = walkIndexedSLL__##type(isll, isll->levels > 0 ? update[0] : NULL, isll->levels > 0 ? rank[0] : -1, targetIdx - 1); \
+        unlinkRangeIndexedSLL__##type(isll, targetIdx, 1, update, rank, pred); \
+    } \
+    \
+    void deleteHeadIndexedSLL__##type(IndexedSLL__##type* isll) { \
+        deleteAtIndexedSLL__##type(isll, 0); \
+    } \
+
+INDEXED_SLL_DELETE(int)
+INDEXED_SLL_DELETE(float)
+INDEXED_SLL_DELETE(char)
+INDEXED_SLL_DELETE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO GET / UPDATE DATA OF INDEXED SLL :   BY INDEX
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Reads or overwrites the element at `targetIdx` in O(log n) expected time.
+ *
+ * As in getDataAt(), negative indices count from the tail (-1 is the last element). An update
+ * also refreshes the key copies in the lane nodes standing on that element.
+ *
+ * @param isll Pointer to the indexed list.
+ * @param targetIdx Index of the element; negative indices count from the tail.
+ * @param data404Response Value returned by getDataAtIndexedSLL() when the index is out of
+ *                        range.
+ */
+#define INDEXED_SLL_ACCESS(type) \
+    type getDataAtIndexedSLL__##type(IndexedSLL__##type* isll, int targetIdx, type data404Response) { \
+        struct SLLLane__##type* update[SLL_INDEX_MAX_LEVEL]; \
+        int rank[SLL_INDEX_MAX_LEVEL]; \
+        \
+        if (targetIdx < 0) { \
+            targetIdx += isll->list.size; \
+        } \
+        \
+        if (targetIdx < 0 || targetIdx >= isll->list.size) { \
+            return data404Response; \
+        } \
+        \
+        searchIndexedSLL__##type(isll, targetIdx, update, rank); \
+        \
+        return walkIndexedSLL__##type(isll, isll->levels > 0 ? update[0] : NULL, isll->levels > 0 ? rank[0] : -1, targetIdx)->data; \
+    } \
+    \
+    void updateAtIndexedSLL__##type(IndexedSLL__##type* isll, int targetIdx, type newData) { \
+        struct SLLLane__##type* update[SLL_INDEX_MAX_LEVEL]; \
+        int rank[SLL_INDEX_MAX_LEVEL]; \
+        int l; \
+        \
+        if (targetIdx < 0) { \
+            targetIdx += isll->list.size; \
+        } \
+        \
+        if (targetIdx < 0 || targetIdx >= isll->list.size) { \
+            return; \
+        } \
+        \
+        searchIndexedSLL__##type(isll, targetIdx, update, rank); \
+        walkIndexedSLL__##type(isll, isll->levels > 0 ? update[0] : NULL, isll->levels > 0 ? rank[0] : -1, targetIdx)->data = newData; \
+        \
+        for (l = 0; l < isll->levels && rank[l] == targetIdx; l++) { \
+            update[l]->key = newData; \
+        } \
+    } \
+    \
+    int sizeIndexedSLL__##type(IndexedSLL__##type* isll) { \
+        return isll->list.size; \
+    } \
+
+INDEXED_SLL_ACCESS(int)
+INDEXED_SLL_ACCESS(float)
+INDEXED_SLL_ACCESS(char)
+INDEXED_SLL_ACCESS(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO USE INDEXED SLL AS SORTED LIST : INSERT / BOUNDS / RANGES
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Ordered operations for an indexed list kept in ascending order.
+ *
+ * The lanes are searched by value instead of by position: a lane is followed while the element
+ * under its next node is still smaller than the key, and the spans give the position on the
+ * way. Each call therefore takes O(log n) expected time, plus the number of elements removed
+ * for rangeErase. The list must be sorted, e.g. built only with insertSortedIndexedSLL();
+ * positional inserts and updates that break the order make the results undefined.
+ *
+ * - insertSorted inserts after any elements equal to `data`, so equal elements keep their
+ *   insertion order. Returns 1 on success, 0 if the node could not be allocated.
+ * - lowerBound / upperBound return the index of the first element >= / > `value`, or the size
+ *   if there is none.
+ * - rangeCount returns how many elements lie in [lo, hi]; rangeErase removes them and returns
+ *   how many it removed.
+ *
+ * @param isll Pointer to the sorted indexed list.
+ */
+#define INDEXED_SLL_SORTED(type) \
+    int insertSortedIndexedSLL__##type(IndexedSLL__##type* isll, type data) { \
+        struct SLLLane__##type* update[SLL_INDEX_MAX_LEVEL]; \
+        struct SLLNode__##type* pred; \
+        struct SLLNode__##type* node = (struct SLLNode__##type*) malloc(sizeof(struct SLLNode__##type)); \
+        int rank[SLL_INDEX_MAX_LEVEL]; \
+        int idx; \
+        \
+        if (node == NULL) { \
+            return 0; \
+        } \
+        \
+        node->data = data; \
+        idx = boundIndexedSLL__##type(isll, data, 1, update, rank, &pred); \
+        linkIndexedSLL__##type(isll, node, idx, update, rank, pred); \
+        \
+        return 1; \
+    } \
+    \
+    int lowerBoundIndexedSLL__##type(IndexedSLL__##type* isll, type value) { \
+        struct SLLLane__##type* update[SLL_INDEX_MAX_LEVEL]; \
+        struct SLLNode__##type* pred; \
+        int rank[SLL_INDEX_MAX_LEVEL]; \
+        \
+        return boundIndexedSLL__##type(isll, value, 0, update, rank, &pred); \
+    } \
+    \
+    int upperBoundIndexedSLL__##type(IndexedSLL__##type* isll, type value) { \
+        struct SLLLane__##type* update[SLL_INDEX_MAX_LEVEL]; \
+        struct SLLNode__##type* pred; \
+        int rank[SLL_INDEX_MAX_LEVEL]; \
+        \
+        return boundIndexedSLL__##type(isll, value, 1, update, rank, &pred); \
+    } \
+    \
+    int rangeCountIndexedSLL__##type(IndexedSLL__##type* isll, type lo, type hi) { \
+        int first, last; \
+        \
+        if (hi < lo) { \
+            return 0; \
+        } \
+        \
+        first = lowerBoundIndexedSLL__##type(isll, lo); \
+        last = upperBoundIndexedSLL__##type(isll, hi); \
+        \
+        return last - first; \
+    } \
+    \
+    int rangeEraseIndexedSLL__##type(IndexedSLL__##type* isll, type lo, type hi) { \
+        struct SLLLane__##type* update[SLL_INDEX_MAX_LEVEL]; \
+        struct SLLNode__##type* pred; \
+        int rank[SLL_INDEX_MAX_LEVEL]; \
+        int first, count; \
+        \
+        if (hi < lo) { \
+            return 0; \
+        } \
+        \
+        count = rangeCountIndexedSLL__##type(isll, lo, hi); \
+        \
+        if (count > 0) { \
+            first = boundIndexedSLL__##type(isll, lo, 0, update, rank, &pred); \
+            unlinkRangeIndexedSLL__##type(isll, first, count, update, rank, pred); \
+        } \
+        \
+        return count; \
+    } \
+
+INDEXED_SLL_SORTED(int)
+INDEXED_SLL_SORTED(float)
+INDEXED_SLL_SORTED(char)
+INDEXED_SLL_SORTED(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FREE INDEXED SLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Frees every lane node and every list node, leaving an empty indexed list.
+ *
+ * @param isll Pointer to the indexed list.
+ */
+#define INDEXED_SLL_FREE(type) \
+    void freeIndexedSLL__##type(IndexedSLL__##type* isll) { \
+        struct SLLLane__##type* lane; \
+        struct SLLLane__##type* next; \
+        int l; \
+        \
+        for (l = 0; l < isll->levels; l++) { \
+            for (lane = isll->heads[l].next; lane != NULL; lane = next) { \
+                next = lane->next; \
+                free(lane); \
+            } \
+            \
+            isll->heads[l].next = NULL; \
+            isll->heads[l].span = 1; \
+        } \
+        \
+        isll->levels = 0; \
+        freeSLL__##type(&isll->list); \
+    } \
+
+INDEXED_SLL_FREE(int)
+INDEXED_SLL_FREE(float)
+INDEXED_SLL_FREE(char)
+INDEXED_SLL_FREE(double)
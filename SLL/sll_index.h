@@ -0,0 +1,114 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_index.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the singly linked list with a skip-list index for positional access.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef SLL_INDEX_H
+#define SLL_INDEX_H
+
+#include <stdint.h>
+#include "sll.h"
+
+/**
+ * @brief Maximum number of express lanes above the list. Each lane holds about a quarter of the
+ *        nodes of the one below, so 16 lanes cover lists of billions of elements.
+ */
+#ifndef SLL_INDEX_MAX_LEVEL
+#define SLL_INDEX_MAX_LEVEL 16
+#endif
+
+/**
+ * @brief Macro to declare an indexed singly linked list for a specific data type.
+ *
+ * `list` is an ordinary SLL__type holding every element. Above it sit up to
+ * SLL_INDEX_MAX_LEVEL express lanes. A lane node points at one list node (`node`), at the lane
+ * node below it (`down`, NULL in the lowest lane), and at the next lane node of its lane. Its
+ * `span` is the number of list positions from its node to the next lane node's node, or to
+ * the end of the list for the last node of a lane. `key` is a copy of the node's element, so
+ * searching by value does not have to touch the list node. `heads[l]` is a sentinel for lane
+ * `l` that stands before the first element (position -1) and has no `node`.
+ *
+ * @param type The data type for the list.
+ */
+#define DECLARE_INDEXED_SLL(type) \
+    struct SLLLane__##type { \
+        struct SLLLane__##type* next; \
+        struct SLLLane__##type* down; \
+        struct SLLNode__##type* node; \
+        type key; \
+        int span; \
+    }; \
+    typedef struct { \
+        SLL__##type list; \
+        struct SLLLane__##type heads[SLL_INDEX_MAX_LEVEL]; \
+        int levels; \
+        uint32_t seed; \
+    } IndexedSLL__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for indexed singly linked list operations.
+ *
+ * Positional operations take O(log n) expected time instead of O(n). In-order iteration is
+ * still a plain walk over `list.head` and `next`, and `list` can be passed to any read-only
+ * sll.h function. It must only be modified through these functions, or the lanes go stale.
+ *
+ * The sorted operations (insertSorted, lowerBound, upperBound, rangeCount, rangeErase) search
+ * the lanes by value and assume the list is kept in ascending order.
+ *
+ * @param type The data type for the list.
+ */
+#define INDEXED_SLL_PROTO(type) \
+    void initIndexedSLL__##type(IndexedSLL__##type* isll); \
+    void adoptIndexedSLL__##type(IndexedSLL__##type* isll, SLL__##type* sll); \
+    int insertAtIndexedSLL__##type(IndexedSLL__##type* isll, type data, int targetIdx); \
+    int insertAtHeadIndexedSLL__##type(IndexedSLL__##type* isll, type data); \
+    int insertAtTailIndexedSLL__##type(IndexedSLL__##type* isll, type data); \
+    void deleteAtIndexedSLL__##type(IndexedSLL__##type* isll, int targetIdx); \
+    void deleteHeadIndexedSLL__##type(IndexedSLL__##type* isll); \
+    type getDataAtIndexedSLL__##type(IndexedSLL__##type* isll, int targetIdx, type data404Response); \
+    void updateAtIndexedSLL__##type(IndexedSLL__##type* isll, int targetIdx, type newData); \
+    int sizeIndexedSLL__##type(IndexedSLL__##type* isll); \
+    int insertSortedIndexedSLL__##type(IndexedSLL__##type* isll, type data); \
+    int lowerBoundIndexedSLL__##type(IndexedSLL__##type* isll, type value); \
+    int upperBoundIndexedSLL__##type(IndexedSLL__##type* isll, type value); \
+    int rangeCountIndexedSLL__##type(IndexedSLL__##type* isll, type lo, type hi); \
+    int rangeEraseIndexedSLL__##type(IndexedSLL__##type* isll, type lo, type hi); \
+    void freeIndexedSLL__##type(IndexedSLL__##type* isll); \
+
+// Declaration for int data type
+DECLARE_INDEXED_SLL(int);
+// Declaration for float data type
+DECLARE_INDEXED_SLL(float);
+// Declaration for char data type
+DECLARE_INDEXED_SLL(char);
+// Declaration for double data type
+DECLARE_INDEXED_SLL(double);
+
+INDEXED_SLL_PROTO(int)
+INDEXED_SLL_PROTO(float)
+INDEXED_SLL_PROTO(char)
+INDEXED_SLL_PROTO(double)
+
+// Macro aliases for function calls
+#define initIndexedSLL(isll, type) initIndexedSLL__##type(isll)
+#define adoptIndexedSLL(isll, sll, type) adoptIndexedSLL__##type(isll, sll)
+#define insertAtIndexedSLL(isll, data, targetIdx, type) insertAtIndexedSLL__##type(isll, data, targetIdx)
+#define insertAtHeadIndexedSLL(isll, data, type) insertAtHeadIndexedSLL__##type(isll, data)
+#define insertAtTailIndexedSLL(isll, data, type) insertAtTailIndexedSLL__##type(isll, data)
+#define deleteAtIndexedSLL(isll, targetIdx, type) deleteAtIndexedSLL__##type(isll, targetIdx)
+#define deleteHeadIndexedSLL(isll, type) deleteHeadIndexedSLL__##type(isll)
+#define getDataAtIndexedSLL(isll, targetIdx, data404Response, type) getDataAtIndexedSLL__##type(isll, targetIdx, data404Response)
+#define updateAtIndexedSLL(isll, targetIdx, newData, type) updateAtIndexedSLL__##type(isll, targetIdx, newData)
+#define sizeIndexedSLL(isll, type) sizeIndexedSLL__##type(isll)
+#define insertSortedIndexedSLL(isll, data, type) insertSortedIndexedSLL__##type(isll, data)
+#define lowerBoundIndexedSLL(isll, value, type) lowerBoundIndexedSLL__##type(isll, value)
+#define upperBoundIndexedSLL(isll, value, type) upperBoundIndexedSLL__##type(isll, value)
+#define rangeCountIndexedSLL(isll, lo, hi, type) rangeCountIndexedSLL__##type(isll, lo, hi)
+#define rangeEraseIndexedSLL(isll, lo, hi, type) rangeEraseIndexedSLL__##type(isll, lo, hi)
+#define freeIndexedSLL(isll, type) freeIndexedSLL__##type(isll)
+
+
+#endif /* SLL_INDEX_H */
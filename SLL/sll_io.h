@@ -0,0 +1,137 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_io.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for saving and loading singly linked lists in binary and text form.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef SLL_IO_H
+#define SLL_IO_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "sll.h"
+
+/**
+ * @brief Size of the staging buffer used by every save / load call, in bytes.
+ *
+ * Must be a multiple of 8 so the payload checksum sees the same 64-bit words on both sides.
+ */
+#ifndef SLL_IO_BUFFER
+#define SLL_IO_BUFFER (1 << 20)
+#endif
+
+/**
+ * @brief Binary format version written by saveSLL().
+ */
+#define SLL_IO_VERSION 1
+
+/**
+ * @brief Size of the binary header, and the initial value of the payload checksum.
+ */
+#define SLL_IO_HEADER 32
+#define SLL_IO_SEED 0xcbf29ce484222325ULL
+
+/**
+ * @brief Type tags stored in the binary header.
+ */
+#define SLL_IO_TAG_int 1
+#define SLL_IO_TAG_float 2
+#define SLL_IO_TAG_char 3
+#define SLL_IO_TAG_double 4
+
+/**
+ * @brief State of a chunked text read.
+ *
+ * Holds the source (`fp`, or `fd` when `fp` is NULL) and an SLL_IO_BUFFER input buffer. A value
+ * split across two reads is carried over to the next refill, so successive
+ * readTextChunkSLL() calls see one continuous stream.
+ */
+typedef struct {
+    FILE* fp;
+    int fd;
+    char* buf;
+    size_t pos;
+    size_t len;
+    int eof;
+    int error;
+    char delimiter;
+} SLLTextReader;
+
+int openTextReaderSLL(SLLTextReader* r, FILE* fp, int fd, char delimiter);
+void closeTextReaderSLL(SLLTextReader* r);
+
+/**
+ * @brief Macro to declare function prototypes for singly linked list serialization.
+ *
+ * Binary layout (32-byte header followed by the packed elements):
+ *
+ * | Offset | Size | Field                                             |
+ * |--------|------|---------------------------------------------------|
+ * | 0      | 4    | magic `"CSLL"`                                    |
+ * | 4      | 2    | format version (SLL_IO_VERSION)                   |
+ * | 6      | 1    | type tag (SLL_IO_TAG_type)                        |
+ * | 7      | 1    | element size in bytes                             |
+ * | 8      | 4    | endianness marker 0x01020304 in writer byte order |
+ * | 12     | 4    | reserved, zero                                    |
+ * | 16     | 8    | element count                                     |
+ * | 24     | 8    | checksum of the payload bytes                     |
+ * | 32     | ...  | `count` elements, packed, in writer byte order    |
+ *
+ * @param type The data type for the singly linked list.
+ */
+#define SLL_IO_PROTO(type) \
+    int saveSLL__##type(SLL__##type* sll, FILE* fp); \
+    int loadSLL__##type(SLL__##type* sll, FILE* fp); \
+
+/**
+ * @brief Building blocks of the binary format, shared with the asynchronous save / load in
+ *        sll_aio.h.
+ */
+uint64_t checksumPayloadSLL(uint64_t h, const unsigned char* buf, size_t len);
+void swapElementsSLL(unsigned char* buf, size_t count, size_t size);
+void encodeHeaderSLL(unsigned char* header, int tag, size_t size, uint64_t count, uint64_t checksum);
+int decodeHeaderSLL(const unsigned char* header, int tag, size_t size, uint64_t* count, uint64_t* checksum, int* swap);
+
+SLL_IO_PROTO(int)
+SLL_IO_PROTO(float)
+SLL_IO_PROTO(char)
+SLL_IO_PROTO(double)
+
+/**
+ * @brief Macro to declare function prototypes for singly linked list text import / export.
+ *
+ * Text layout: the elements in list order, separated by `delimiter`, with a newline after the
+ * last one (an empty list writes nothing). Numbers are written in decimal; float and double use
+ * the shortest fixed-point form that reads back to the same value, or `%.9g` / `%.17g` when more
+ * digits are needed. A char element is the raw byte itself.
+ *
+ * When reading numbers, any run of delimiters, spaces, tabs and newlines separates two values.
+ * A char element is exactly one byte followed by one delimiter or newline.
+ *
+ * @param type The data type for the singly linked list.
+ */
+#define SLL_TEXT_PROTO(type) \
+    int writeTextSLL__##type(SLL__##type* sll, FILE* fp, char delimiter); \
+    int writeTextFdSLL__##type(SLL__##type* sll, int fd, char delimiter); \
+    int readTextSLL__##type(SLL__##type* sll, FILE* fp, char delimiter); \
+    int readTextFdSLL__##type(SLL__##type* sll, int fd, char delimiter); \
+    int readTextChunkSLL__##type(SLL__##type* sll, SLLTextReader* r, int maxCount); \
+
+SLL_TEXT_PROTO(int)
+SLL_TEXT_PROTO(float)
+SLL_TEXT_PROTO(char)
+SLL_TEXT_PROTO(double)
+
+// Macro aliases for function calls
+#define saveSLL(sll, fp, type) saveSLL__##type(sll, fp)
+#define loadSLL(sll, fp, type) loadSLL__##type(sll, fp)
+#define writeTextSLL(sll, fp, delimiter, type) writeTextSLL__##type(sll, fp, delimiter)
+#define writeTextFdSLL(sll, fd, delimiter, type) writeTextFdSLL__##type(sll, fd, delimiter)
+#define readTextSLL(sll, fp, delimiter, type) readTextSLL__##type(sll, fp, delimiter)
+#define readTextFdSLL(sll, fd, delimiter, type) readTextFdSLL__##type(sll, fd, delimiter)
+#define readTextChunkSLL(sll, r, maxCount, type) readTextChunkSLL__##type(sll, r, maxCount)
+
+
+#endif /* SLL_IO_H */
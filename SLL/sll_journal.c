@@ -0,0 +1,539 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_journal.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the sll_journal.h header file containing the journaled singly linked
+ *          list.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "sll_io.h"
+#include "sll_journal.h"
+
+#define SLL_JOURNAL_HEADER 16
+#define SLL_JOURNAL_VERSION 1
+#define SLL_JOURNAL_BATCH 4096
+
+#define JOURNAL_INSERT_HEAD 1
+#define JOURNAL_INSERT_TAIL 2
+#define JOURNAL_INSERT_AT 3
+#define JOURNAL_INSERT_AFTER 4
+#define JOURNAL_INSERT_BEFORE 5
+#define JOURNAL_DELETE_HEAD 6
+#define JOURNAL_DELETE 7
+#define JOURNAL_DELETE_ALL 8
+#define JOURNAL_DELETE_AT 9
+#define JOURNAL_UPDATE_AT 10
+#define JOURNAL_CLEAR 11
+
+// -------------------------------------------------------------------------------------------->
+// JOURNAL FILE HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Checksum of the first 24 bytes of a record, used to detect a torn or garbage tail.
+ */
+static uint64_t checksumRecord(const unsigned char* rec) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    uint64_t w;
+    int i;
+
+    for (i = 0; i < 24; i += 8) {
+        memcpy(&w, rec + i, 8);
+        h = (h ^ w) * 0x100000001b3ULL;
+        h ^= h >> 29;
+    }
+
+    return h;
+}
+
+/**
+ * @brief Writes `len` bytes to `fd`, retrying short and interrupted writes.
+ *
+ * @return 1 on success, 0 on a write error.
+ */
+static int writeAllJournal(int fd, const unsigned char* buf, size_t len) {
+    ssize_t put;
+
+    while (len > 0) {
+        put = write(fd, buf, len);
+
+        if (put < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (put <= 0) {
+            return 0;
+        }
+
+        buf += put;
+        len -= (size_t) put;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief fsync()s the directory holding `path`, so a rename() into it is durable.
+ *
+ * @return 1 on success, 0 on failure.
+ */
+static int syncParentDirJournal(const char* path) {
+    const char* slash = strrchr(path, '/');
+    char* dir;
+    int fd, ok;
+
+    if (slash == NULL) {
+        fd = open(".", O_RDONLY);
+    } else {
+        dir = (char*) malloc((size_t) (slash - path) + 2);
+        if (dir == NULL) {
+            return 0;
+        }
+        memcpy(dir, path, (size_t) (slash - path) + 1);
+        dir[slash - path + 1] = '\0';
+        fd = open(dir, O_RDONLY);
+        free(dir);
+    }
+
+    if (fd < 0) {
+        return 0;
+    }
+
+    ok = fsync(fd) == 0;
+    close(fd);
+
+    return ok;
+}
+
+/**
+ * @brief Empties the journal and writes a fresh header for snapshot checksum `base`.
+ *
+ * @return 1 on success, 0 on an I/O error.
+ */
+static int resetJournal(SLLJournal* jr, uint64_t base) {
+    unsigned char header[SLL_JOURNAL_HEADER] = {0};
+    uint32_t version = SLL_JOURNAL_VERSION;
+
+    memcpy(header, "JSLL", 4);
+    memcpy(header + 4, &version, 4);
+    memcpy(header + 8, &base, 8);
+
+    if (ftruncate(jr->fd, 0) != 0 || !writeAllJournal(jr->fd, header, SLL_JOURNAL_HEADER) ||
+        fsync(jr->fd) != 0) {
+        return 0;
+    }
+
+    jr->committed = SLL_JOURNAL_HEADER;
+    jr->base = base;
+
+    return 1;
+}
+
+/**
+ * @brief Opens (or creates) the journal file for a list restored from snapshot checksum `base`.
+ *
+ * A journal written against a different snapshot was already folded into the current one by a
+ * compaction that crashed before emptying it, so it is reset rather than replayed.
+ *
+ * @return 1 on success, 0 on an I/O error or if the file is not a journal.
+ */
+static int openJournal(SLLJournal* jr, const char* path, uint64_t base) {
+    unsigned char header[SLL_JOURNAL_HEADER];
+    uint32_t version;
+    uint64_t stored;
+    struct stat st;
+
+    jr->fd = open(path, O_RDWR | O_CREAT | O_APPEND, 0644);
+
+    if (jr->fd < 0 || fstat(jr->fd, &st) != 0) {
+        return 0;
+    }
+
+    if (st.st_size < SLL_JOURNAL_HEADER) {
+        return resetJournal(jr, base);
+    }
+
+    if (pread(jr->fd, header, SLL_JOURNAL_HEADER, 0) != SLL_JOURNAL_HEADER || memcmp(header, "JSLL", 4) != 0) {
+        return 0;
+    }
+
+    memcpy(&version, header + 4, 4);
+    memcpy(&stored, header + 8, 8);
+
+    if (version != SLL_JOURNAL_VERSION) {
+        return 0;
+    }
+
+    if (stored != base) {
+        return resetJournal(jr, base);
+    }
+
+    jr->committed = (uint64_t) st.st_size;
+    jr->base = base;
+
+    return 1;
+}
+
+/**
+ * @brief Appends one encoded record to the pending group.
+ *
+ * @return 1 on success, 0 if the pending buffer could not grow.
+ */
+static int queueJournal(SLLJournal* jr, int op, int idx, const void* data, const void* target, size_t size) {
+    unsigned char* rec;
+    unsigned char* grown;
+    size_t capacity;
+    int32_t index = idx;
+    uint64_t check;
+
+    if (jr->pendingLen + SLL_JOURNAL_RECORD > jr->pendingCapacity) {
+        capacity = jr->pendingCapacity != 0 ? jr->pendingCapacity * 2 : SLL_JOURNAL_RECORD * 64;
+        grown = (unsigned char*) realloc(jr->pending, capacity);
+
+        if (grown == NULL) {
+            return 0;
+        }
+
+        jr->pending = grown;
+        jr->pendingCapacity = capacity;
+    }
+
+    rec = jr->pending + jr->pendingLen;
+    memset(rec, 0, SLL_JOURNAL_RECORD);
+    rec[0] = (unsigned char) op;
+    memcpy(rec + 4, &index, 4);
+    memcpy(rec + 8, data, size);
+    memcpy(rec + 16, target, size);
+    check = checksumRecord(rec);
+    memcpy(rec + 24, &check, 8);
+
+    jr->pendingLen += SLL_JOURNAL_RECORD;
+    jr->pendingOps++;
+
+    return 1;
+}
+
+/**
+ * @brief Group commit: writes every pending record with one write() and makes it durable with
+ *        one fsync().
+ *
+ * On failure the file is cut back to the last commit and the records stay pending, so a retry
+ * neither loses nor duplicates them.
+ *
+ * @return 1 on success (or nothing pending), 0 on an I/O error.
+ */
+static int commitJournal(SLLJournal* jr) {
+    if (jr->pendingLen == 0) {
+        return 1;
+    }
+
+    if (!writeAllJournal(jr->fd, jr->pending, jr->pendingLen) || fsync(jr->fd) != 0) {
+        while (ftruncate(jr->fd, (off_t) jr->committed) != 0 && errno == EINTR) {
+        }
+        return 0;
+    }
+
+    jr->committed += jr->pendingLen;
+    jr->pendingLen = 0;
+    jr->pendingOps = 0;
+
+    return 1;
+}
+
+static void closeJournal(SLLJournal* jr) {
+    if (jr->fd >= 0) {
+        close(jr->fd);
+    }
+
+    free(jr->pending);
+    free(jr->snapshotPath);
+    memset(jr, 0, sizeof(*jr));
+    jr->fd = -1;
+}
+// -------------------------------------------------------------------------------------------->
+// APPLY / REPLAY OF JOURNALED SLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief applyJournaledSLL() performs one recorded mutation with the sll.h functions, both
+ *        live and during replay. replayJournaledSLL() applies every valid record after the
+ *        header and truncates the journal at the first torn or corrupt one.
+ */
+#define JOURNALED_SLL_APPLY(type) \
+    static void applyJournaledSLL__##type(SLL__##type* sll, int op, int idx, type data, type target) { \
+        switch (op) { \
+            case JOURNAL_INSERT_HEAD: insertAtHead__##type(sll, data); break; \
+            case JOURNAL_INSERT_TAIL: insertAtTail__##type(sll, data); break; \
+            case JOURNAL_INSERT_AT: insertAt__##type(sll, data, idx); break; \
+            case JOURNAL_INSERT_AFTER: insertAfter__##type(sll, data, target); break; \
+            case JOURNAL_INSERT_BEFORE: insertBefore__##type(sll, data, target); break; \
+            case JOURNAL_DELETE_HEAD: deleteHead__##type(sll); break; \
+            case JOURNAL_DELETE: delete__##type(sll, data); break; \
+            case JOURNAL_DELETE_ALL: deleteAll__##type(sll, data); break; \
+            case JOURNAL_DELETE_AT: deleteAt__##type(sll, idx); break; \
+            case JOURNAL_UPDATE_AT: updateAt__##type(sll, idx, data); break; \
+            case JOURNAL_CLEAR: freeSLL__##type(sll); break; \
+            default: break; \
+        } \
+    } \
+    \
+    static int replayJournaledSLL__##type(JournaledSLL__##type* j) { \
+        unsigned char* buf = (unsigned char*) malloc(SLL_JOURNAL_RECORD * SLL_JOURNAL_BATCH); \
+        uint64_t offset = SLL_JOURNAL_HEADER; \
+        uint64_t check; \
+        ssize_t got; \
+        size_t i; \
+        int32_t idx; \
+        type data, target; \
+        int torn = 0; \
+        \
+        if (buf == NULL) { \
+            return 0; \
+        } \
+        \
+        while (!torn && offset < j->journal.committed) { \
+            got = pread(j->journal.fd, buf, SLL_JOURNAL_RECORD * SLL_JOURNAL_BATCH, (off_t) offset); \
+            \
+            if (got < 0 && errno == EINTR) { \
+                continue; \
+            } \
+            \
+            if (got < 0) { \
+                free(buf); \
+                return 0; \
+            } \
+            \
+            torn = got < SLL_JOURNAL_RECORD; \
+            \
+            for (i = 0; !torn && i + SLL_JOURNAL_RECORD <= (size_t) got; i += SLL_JOURNAL_RECORD) { \
+                memcpy(&check, buf + i + 24, 8); \
+                \
+                if (check != checksumRecord(buf + i)) { \
+                    torn = 1; \
+                    break; \
+                } \
+                \
+                memcpy(&idx, buf + i + 4, 4); \
+                memcpy(&data, buf + i + 8, sizeof(type)); \
+                memcpy(&target, buf + i + 16, sizeof(type)); \
+                applyJournaledSLL__##type(&j->list, buf[i], idx, data, target); \
+                offset += SLL_JOURNAL_RECORD; \
+            } \
+            \
+            torn = torn || (size_t) got % SLL_JOURNAL_RECORD != 0; \
+        } \
+        \
+        free(buf); \
+        \
+        if (offset < j->journal.committed) { \
+            if (ftruncate(j->journal.fd, (off_t) offset) != 0 || fsync(j->journal.fd) != 0) { \
+                return 0; \
+            } \
+            j->journal.committed = offset; \
+        } \
+        \
+        return 1; \
+    } \
+    \
+    static int mutateJournaledSLL__##type(JournaledSLL__##type* j, int op, int idx, type data, type target) { \
+        if (!queueJournal(&j->journal, op, idx, &data, &target, sizeof(type))) { \
+            return 0; \
+        } \
+        \
+        applyJournaledSLL__##type(&j->list, op, idx, data, target); \
+        \
+        return j->journal.pendingOps < j->journal.groupSize || commitJournal(&j->journal); \
+    } \
+
+JOURNALED_SLL_APPLY(int)
+JOURNALED_SLL_APPLY(float)
+JOURNALED_SLL_APPLY(char)
+JOURNALED_SLL_APPLY(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO OPEN JOURNALED SLL :             SNAPSHOT + REPLAY
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Restores the list from `snapshotPath` (if it exists) and replays `journalPath`.
+ *
+ * @param j Pointer to the journaled list.
+ * @param snapshotPath Binary snapshot written by compactJournaledSLL() (see sll_io.h).
+ * @param journalPath Journal file; created if missing.
+ * @param groupSize Mutations per automatic group commit; <= 1 commits every mutation.
+ *
+ * @return 1 on success, 0 if the snapshot is corrupt or a file cannot be opened. A missing
+ *         snapshot is not an error: the list then starts empty.
+ */
+#define JOURNALED_SLL_OPEN(type) \
+    int openJournaledSLL__##type(JournaledSLL__##type* j, const char* snapshotPath, const char* journalPath, int groupSize) { \
+        size_t len = strlen(snapshotPath); \
+        uint64_t base = 0; \
+        FILE* fp; \
+        int ok = 1; \
+        \
+        j->list.head = NULL; \
+        j->list.tail = NULL; \
+        j->list.size = 0; \
+        memset(&j->journal, 0, sizeof(j->journal)); \
+        j->journal.fd = -1; \
+        j->journal.groupSize = groupSize; \
+        j->journal.snapshotPath = (char*) malloc(len + 1); \
+        \
+        if (j->journal.snapshotPath == NULL) { \
+            return 0; \
+        } \
+        memcpy(j->journal.snapshotPath, snapshotPath, len + 1); \
+        \
+        fp = fopen(snapshotPath, "rb"); \
+        \
+        if (fp != NULL) { \
+            ok = loadSLL__##type(&j->list, fp) && fseek(fp, 24, SEEK_SET) == 0 && fread(&base, 8, 1, fp) == 1; \
+            fclose(fp); \
+        } else { \
+            ok = errno == ENOENT; \
+        } \
+        \
+        ok = ok && openJournal(&j->journal, journalPath, base) && replayJournaledSLL__##type(j); \
+        \
+        if (!ok) { \
+            freeSLL__##type(&j->list); \
+            closeJournal(&j->journal); \
+        } \
+        \
+        return ok; \
+    } \
+
+JOURNALED_SLL_OPEN(int)
+JOURNALED_SLL_OPEN(float)
+JOURNALED_SLL_OPEN(char)
+JOURNALED_SLL_OPEN(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO MUTATE JOURNALED SLL :           INSERT / DELETE / UPDATE / CLEAR
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Journaled versions of the sll.h mutations, with the same semantics.
+ *
+ * @param j Pointer to the journaled list.
+ *
+ * @return 1 on success, 0 if the record could not be queued (the list is left unchanged) or
+ *         if the group commit it triggered failed.
+ */
+#define JOURNALED_SLL_MUTATE(type) \
+    int insertAtHeadJournaledSLL__##type(JournaledSLL__##type* j, type data) { \
+        return mutateJournaledSLL__##type(j, JOURNAL_INSERT_HEAD, 0, data, (type) 0); \
+    } \
+    \
+    int insertAtTailJournaledSLL__##type(JournaledSLL__##type* j, type data) { \
+        return mutateJournaledSLL__##type(j, JOURNAL_INSERT_TAIL, 0, data, (type) 0); \
+    } \
+    \
+    int insertAtJournaledSLL__##type(JournaledSLL__##type* j, type data, int targetIdx) { \
+        return mutateJournaledSLL__##type(j, JOURNAL_INSERT_AT, targetIdx, data, (type) 0); \
+    } \
+    \
+    int insertAfterJournaledSLL__##type(JournaledSLL__##type* j, type data, type targetData) { \
+        return mutateJournaledSLL__##type(j, JOURNAL_INSERT_AFTER, 0, data, targetData); \
+    } \
+    \
+    int insertBeforeJournaledSLL__##type(JournaledSLL__##type* j, type data, type targetData) { \
+        return mutateJournaledSLL__##type(j, JOURNAL_INSERT_BEFORE, 0, data, targetData); \
+    } \
+    \
+    int deleteHeadJournaledSLL__##type(JournaledSLL__##type* j) { \
+        return mutateJournaledSLL__##type(j, JOURNAL_DELETE_HEAD, 0, (type) 0, (type) 0); \
+    } \
+    \
+    int deleteJournaledSLL__##type(JournaledSLL__##type* j, type targetData) { \
+        return mutateJournaledSLL__##type(j, JOURNAL_DELETE, 0, targetData, (type) 0); \
+    } \
+    \
+    int deleteAllJournaledSLL__##type(JournaledSLL__##type* j, type targetData) { \
+        return mutateJournaledSLL__##type(j, JOURNAL_DELETE_ALL, 0, targetData, (type) 0); \
+    } \
+    \
+    int deleteAtJournaledSLL__##type(JournaledSLL__##type* j, int targetIdx) { \
+        return mutateJournaledSLL__##type(j, JOURNAL_DELETE_AT, targetIdx, (type) 0, (type) 0); \
+    } \
+    \
+    int updateAtJournaledSLL__##type(JournaledSLL__##type* j, int targetIdx, type newData) { \
+        return mutateJournaledSLL__##type(j, JOURNAL_UPDATE_AT, targetIdx, newData, (type) 0); \
+    } \
+    \
+    int clearJournaledSLL__##type(JournaledSLL__##type* j) { \
+        return mutateJournaledSLL__##type(j, JOURNAL_CLEAR, 0, (type) 0, (type) 0); \
+    } \
+
+JOURNALED_SLL_MUTATE(int)
+JOURNALED_SLL_MUTATE(float)
+JOURNALED_SLL_MUTATE(char)
+JOURNALED_SLL_MUTATE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO COMMIT / COMPACT / CLOSE JOURNALED SLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief commit forces the pending group to disk. compact writes the whole list to a temporary
+ *        snapshot, fsync()s it, renames it over the old one and then empties the journal. close
+ *        commits, closes the journal and frees the list.
+ *
+ * A crash at any point of a compaction is safe: until the rename the old snapshot and journal
+ * are untouched, and after it the journal no longer matches the new snapshot's checksum, so it
+ * is discarded on the next open instead of being applied twice.
+ *
+ * @param j Pointer to the journaled list.
+ *
+ * @return 1 on success, 0 on an I/O or allocation error.
+ */
+#define JOURNALED_SLL_COMMIT(type) \
+    int commitJournaledSLL__##type(JournaledSLL__##type* j) { \
+        return commitJournal(&j->journal); \
+    } \
+    \
+    int compactJournaledSLL__##type(JournaledSLL__##type* j) { \
+        size_t len = strlen(j->journal.snapshotPath); \
+        char* tmp = (char*) malloc(len + 5); \
+        uint64_t base = 0; \
+        FILE* fp; \
+        int ok = tmp != NULL && commitJournal(&j->journal); \
+        \
+        if (!ok) { \
+            free(tmp); \
+            return 0; \
+        } \
+        \
+        memcpy(tmp, j->journal.snapshotPath, len); \
+        memcpy(tmp + len, ".tmp", 5); \
+        \
+        fp = fopen(tmp, "w+b"); \
+        ok = fp != NULL && saveSLL__##type(&j->list, fp) && fflush(fp) == 0 && fsync(fileno(fp)) == 0 && \
+             fseek(fp, 24, SEEK_SET) == 0 && fread(&base, 8, 1, fp) == 1; \
+        ok = fp != NULL && fclose(fp) == 0 && ok; \
+        ok = ok && rename(tmp, j->journal.snapshotPath) == 0; \
+        \
+        if (!ok) { \
+            remove(tmp); \
+        } \
+        \
+        free(tmp); \
+        \
+        return ok && syncParentDirJournal(j->journal.snapshotPath) && resetJournal(&j->journal, base); \
+    } \
+    \
+    int closeJournaledSLL__##type(JournaledSLL__##type* j) { \
+        int ok = commitJournal(&j->journal); \
+        \
+        closeJournal(&j->journal); \
+        freeSLL__##type(&j->list); \
+        \
+        return ok; \
+    } \
+
+JOURNALED_SLL_COMMIT(int)
+JOURNALED_SLL_COMMIT(float)
+JOURNALED_SLL_COMMIT(char)
+JOURNALED_SLL_COMMIT(double)
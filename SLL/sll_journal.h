@@ -0,0 +1,131 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_journal.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the singly linked list with a write-ahead mutation journal.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef SLL_JOURNAL_H
+#define SLL_JOURNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sll.h"
+
+/**
+ * @brief Size of one journal record, in bytes.
+ *
+ * | Offset | Size | Field                                          |
+ * |--------|------|------------------------------------------------|
+ * | 0      | 1    | operation code                                 |
+ * | 4      | 4    | index argument                                 |
+ * | 8      | 8    | data argument, zero padded                     |
+ * | 16     | 8    | target argument (insertAfter / insertBefore)   |
+ * | 24     | 8    | checksum of bytes 0..23                        |
+ *
+ * The journal file starts with a 16-byte header: magic `"JSLL"`, a format version and the
+ * checksum of the snapshot the records apply to (0 when there is no snapshot yet).
+ */
+#define SLL_JOURNAL_RECORD 32
+
+/**
+ * @brief Journal file state shared by every element type.
+ *
+ * - `pending`: records of mutations already applied in memory but not yet written (group commit).
+ * - `groupSize`: number of pending records that triggers an automatic commit (<= 1 commits every
+ *   mutation on its own).
+ * - `committed`: journal length covered by the last successful commit; a failed write is cut
+ *   back to it so later commits never land behind a torn record.
+ * - `base`: checksum of the snapshot the journal applies to.
+ */
+typedef struct {
+    int fd;
+    char* snapshotPath;
+    unsigned char* pending;
+    size_t pendingLen;
+    size_t pendingCapacity;
+    int pendingOps;
+    int groupSize;
+    uint64_t committed;
+    uint64_t base;
+} SLLJournal;
+
+/**
+ * @brief Macro to declare a journaled singly linked list for a specific data type.
+ *
+ * `list` is an ordinary SLL and can be read directly with the sll.h functions. Every mutation
+ * must go through the journaled functions so it is recorded.
+ *
+ * @param type The data type for the journaled list.
+ */
+#define DECLARE_JOURNALED_SLL(type) \
+    typedef struct { \
+        SLL__##type list; \
+        SLLJournal journal; \
+    } JournaledSLL__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for journaled singly linked list operations.
+ *
+ * A mutation is applied to `list` at once and queued in the journal. commitJournaledSLL()
+ * writes all queued records with one write() and one fsync(); this also happens automatically
+ * every `groupSize` mutations. On a crash, everything up to the last commit is recovered by
+ * openJournaledSLL(), which loads the snapshot and replays the journal. compactJournaledSLL()
+ * folds the journal into a fresh binary snapshot and empties it.
+ *
+ * Mutations return 1, or 0 if the commit they triggered failed (the mutation stays queued and
+ * is retried by the next commit).
+ *
+ * @param type The data type for the journaled list.
+ */
+#define JOURNALED_SLL_PROTO(type) \
+    int openJournaledSLL__##type(JournaledSLL__##type* j, const char* snapshotPath, const char* journalPath, int groupSize); \
+    int insertAtHeadJournaledSLL__##type(JournaledSLL__##type* j, type data); \
+    int insertAtTailJournaledSLL__##type(JournaledSLL__##type* j, type data); \
+    int insertAtJournaledSLL__##type(JournaledSLL__##type* j, type data, int targetIdx); \
+    int insertAfterJournaledSLL__##type(JournaledSLL__##type* j, type data, type targetData); \
+    int insertBeforeJournaledSLL__##type(JournaledSLL__##type* j, type data, type targetData); \
+    int deleteHeadJournaledSLL__##type(JournaledSLL__##type* j); \
+    int deleteJournaledSLL__##type(JournaledSLL__##type* j, type targetData); \
+    int deleteAllJournaledSLL__##type(JournaledSLL__##type* j, type targetData); \
+    int deleteAtJournaledSLL__##type(JournaledSLL__##type* j, int targetIdx); \
+    int updateAtJournaledSLL__##type(JournaledSLL__##type* j, int targetIdx, type newData); \
+    int clearJournaledSLL__##type(JournaledSLL__##type* j); \
+    int commitJournaledSLL__##type(JournaledSLL__##type* j); \
+    int compactJournaledSLL__##type(JournaledSLL__##type* j); \
+    int closeJournaledSLL__##type(JournaledSLL__##type* j); \
+
+// Declaration for int data type
+DECLARE_JOURNALED_SLL(int);
+// Declaration for float data type
+DECLARE_JOURNALED_SLL(float);
+// Declaration for char data type
+DECLARE_JOURNALED_SLL(char);
+// Declaration for double data type
+DECLARE_JOURNALED_SLL(double);
+
+JOURNALED_SLL_PROTO(int)
+JOURNALED_SLL_PROTO(float)
+JOURNALED_SLL_PROTO(char)
+JOURNALED_SLL_PROTO(double)
+
+// Macro aliases for function calls
+#define openJournaledSLL(j, snapshotPath, journalPath, groupSize, type) openJournaledSLL__##type(j, snapshotPath, journalPath, groupSize)
+#define insertAtHeadJournaledSLL(j, data, type) insertAtHeadJournaledSLL__##type(j, data)
+#define insertAtTailJournaledSLL(j, data, type) insertAtTailJournaledSLL__##type(j, data)
+#define insertAtJournaledSLL(j, data, targetIdx, type) insertAtJournaledSLL__##type(j, data, targetIdx)
+#define insertAfterJournaledSLL(j, data, targetData, type) insertAfterJournaledSLL__##type(j, data, targetData)
+#define insertBeforeJournaledSLL(j, data, targetData, type) insertBeforeJournaledSLL__##type(j, data, targetData)
+#define deleteHeadJournaledSLL(j, type) deleteHeadJournaledSLL__##type(j)
+#define deleteJournaledSLL(j, targetData, type) deleteJournaledSLL__##type(j, targetData)
+#define deleteAllJournaledSLL(j, targetData, type) deleteAllJournaledSLL__##type(j, targetData)
+#define deleteAtJournaledSLL(j, targetIdx, type) deleteAtJournaledSLL__##type(j, targetIdx)
+#define updateAtJournaledSLL(j, targetIdx, newData, type) updateAtJournaledSLL__##type(j, targetIdx, newData)
+#define clearJournaledSLL(j, type) clearJournaledSLL__##type(j)
+#define commitJournaledSLL(j, type) commitJournaledSLL__##type(j)
+#define compactJournaledSLL(j, type) compactJournaledSLL__##type(j)
+#define closeJournaledSLL(j, type) closeJournaledSLL__##type(j)
+
+
+#endif /* SLL_JOURNAL_H */
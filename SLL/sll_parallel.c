@@ -0,0 +1,707 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_parallel.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the sll_parallel.h header file containing the parallel bulk operations
+ *          over singly linked lists.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "sll_parallel.h"
+
+// -------------------------------------------------------------------------------------------->
+// SEGMENT BOOKKEEPING FOR PARALLEL SLL OPERATIONS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Describes one contiguous run of nodes and the result computed for it.
+ *
+ * `first` / `last` / `count` describe the run. The remaining fields carry the operation's input
+ * (`targetData`, `keep`, `fn`, `out`) and output (`hits`, `sum`, `best`). During the merge rounds
+ * of parallelSortSLL() `hits` holds the distance to the segment being merged in.
+ */
+#define SLL_SEGMENT(type) \
+    typedef struct { \
+        struct SLLNode__##type* first; \
+        struct SLLNode__##type* last; \
+        int count; \
+        int offset; \
+        type targetData; \
+        int (*keep)(type); \
+        type (*fn)(type); \
+        type* out; \
+        int hits; \
+        double sum; \
+        type best; \
+    } SLLSegment__##type; \
+
+SLL_SEGMENT(int)
+SLL_SEGMENT(float)
+SLL_SEGMENT(char)
+SLL_SEGMENT(double)
+
+/**
+ * @brief Chooses how many segments a list of `size` nodes is cut into.
+ *
+ * @param size Number of nodes in the list.
+ * @param pool Pool that will run the segments, or NULL.
+ *
+ * @return A value between 1 and the pool's thread count.
+ */
+static int segmentCount(int size, ThreadPool* pool) {
+    int k;
+
+    if (pool == NULL || pool->threadCount <= 1) {
+        return 1;
+    }
+
+    k = size / PARALLEL_MIN_SEGMENT;
+
+    if (k > pool->threadCount) {
+        k = pool->threadCount;
+    }
+
+    return k < 1 ? 1 : k;
+}
+
+/**
+ * @brief Runs `task` once per segment and returns when all of them have finished.
+ *
+ * A single segment is processed on the calling thread without touching the pool.
+ *
+ * @param segs Array of segment structures.
+ * @param segSize Size of one segment structure in bytes.
+ * @param k Number of segments.
+ * @param task Per-segment work.
+ * @param pool Pool used when `k` is greater than one.
+ */
+static void runSegments(void* segs, size_t segSize, int k, ThreadTask task, ThreadPool* pool) {
+    int i;
+
+    if (k == 1) {
+        task(segs);
+        return;
+    }
+
+    for (i = 0; i < k; i++) {
+        if (!submitThreadPool(pool, task, (char*) segs + i * segSize)) {
+            task((char*) segs + i * segSize);
+        }
+    }
+
+    waitThreadPool(pool);
+}
+
+/**
+ * @brief Cuts the list into `k` nearly equal segments in a single walk.
+ *
+ * @param sll Pointer to the singly linked list structure.
+ * @param k Number of segments to produce.
+ *
+ * @return A calloc'd array of `k` segments, or NULL if the allocation failed.
+ *
+ * @note Only `first`, `last`, `count` and `offset` are filled in; the links between segments are
+ *       left untouched.
+ */
+#define SLL_SPLIT(type) \
+    static SLLSegment__##type* splitSLL__##type(SLL__##type* sll, int k) { \
+        SLLSegment__##type* segs = (SLLSegment__##type*) calloc(k, sizeof(SLLSegment__##type)); \
+        struct SLLNode__##type* itr = sll->head; \
+        int offset = 0; \
+        int i, j; \
+        \
+        if (segs == NULL) { \
+            return NULL; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].count = sll->size / k + (i < sll->size % k ? 1 : 0); \
+            segs[i].offset = offset; \
+            segs[i].first = itr; \
+            \
+            for (j = 1; j < segs[i].count; j++) { \
+                itr = itr->next; \
+            } \
+            \
+            segs[i].last = segs[i].count > 0 ? itr : NULL; \
+            itr = segs[i].count > 0 ? itr->next : itr; \
+            offset += segs[i].count; \
+        } \
+        \
+        return segs; \
+    } \
+
+SLL_SPLIT(int)
+SLL_SPLIT(float)
+SLL_SPLIT(char)
+SLL_SPLIT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO COUNT DATA OF SLL :              PARALLEL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Counts the nodes whose data equals `targetData`.
+ *
+ * @param sll Pointer to the singly linked list structure.
+ * @param targetData The value to count.
+ * @param pool Thread pool to run the segments on, or NULL.
+ *
+ * @return The number of matching nodes, or -1 if the segment table could not be allocated.
+ */
+#define SLL_PARALLEL_COUNT(type) \
+    static void countTaskSLL__##type(void* arg) { \
+        SLLSegment__##type* seg = (SLLSegment__##type*) arg; \
+        struct SLLNode__##type* itr = seg->first; \
+        int i; \
+        \
+        for (i = 0; i < seg->count; i++, itr = itr->next) { \
+            seg->hits += itr->data == seg->targetData; \
+        } \
+    } \
+    \
+    int parallelCountSLL__##type(SLL__##type* sll, type targetData, ThreadPool* pool) { \
+        int k = segmentCount(sll->size, pool); \
+        SLLSegment__##type* segs = splitSLL__##type(sll, k); \
+        int total = 0; \
+        int i; \
+        \
+        if (segs == NULL) { \
+            return -1; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].targetData = targetData; \
+        } \
+        \
+        runSegments(segs, sizeof(SLLSegment__##type), k, countTaskSLL__##type, pool); \
+        \
+        for (i = 0; i < k; i++) { \
+            total += segs[i].hits; \
+        } \
+        \
+        free(segs); \
+        \
+        return total; \
+    } \
+
+SLL_PARALLEL_COUNT(int)
+SLL_PARALLEL_COUNT(float)
+SLL_PARALLEL_COUNT(char)
+SLL_PARALLEL_COUNT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO SEARCH DATA OF SLL :             PARALLEL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Finds the index of the first node whose data equals `targetData`.
+ *
+ * Each segment stops at its own first match; the earliest segment with a match wins.
+ *
+ * @param sll Pointer to the singly linked list structure.
+ * @param targetData The value to search for.
+ * @param pool Thread pool to run the segments on, or NULL.
+ *
+ * @return The index of the first match, or -1 if there is none.
+ */
+#define SLL_PARALLEL_INDEX_OF(type) \
+    static void indexOfTaskSLL__##type(void* arg) { \
+        SLLSegment__##type* seg = (SLLSegment__##type*) arg; \
+        struct SLLNode__##type* itr = seg->first; \
+        int i; \
+        \
+        seg->hits = -1; \
+        \
+        for (i = 0; i < seg->count; i++, itr = itr->next) { \
+            if (itr->data == seg->targetData) { \
+                seg->hits = seg->offset + i; \
+                return; \
+            } \
+        } \
+    } \
+    \
+    int parallelIndexOfSLL__##type(SLL__##type* sll, type targetData, ThreadPool* pool) { \
+        int k = segmentCount(sll->size, pool); \
+        SLLSegment__##type* segs = splitSLL__##type(sll, k); \
+        int found = -1; \
+        int i; \
+        \
+        if (segs == NULL) { \
+            return -1; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].targetData = targetData; \
+        } \
+        \
+        runSegments(segs, sizeof(SLLSegment__##type), k, indexOfTaskSLL__##type, pool); \
+        \
+        for (i = 0; i < k && found == -1; i++) { \
+            found = segs[i].hits; \
+        } \
+        \
+        free(segs); \
+        \
+        return found; \
+    } \
+
+SLL_PARALLEL_INDEX_OF(int)
+SLL_PARALLEL_INDEX_OF(float)
+SLL_PARALLEL_INDEX_OF(char)
+SLL_PARALLEL_INDEX_OF(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO REDUCE DATA OF SLL :             SUM
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Adds up every element of the list.
+ *
+ * @param sll Pointer to the singly linked list structure.
+ * @param pool Thread pool to run the segments on, or NULL.
+ *
+ * @return The sum as a double (0 for an empty list or a failed allocation).
+ */
+#define SLL_PARALLEL_SUM(type) \
+    static void sumTaskSLL__##type(void* arg) { \
+        SLLSegment__##type* seg = (SLLSegment__##type*) arg; \
+        struct SLLNode__##type* itr = seg->first; \
+        int i; \
+        \
+        for (i = 0; i < seg->count; i++, itr = itr->next) { \
+            seg->sum += itr->data; \
+        } \
+    } \
+    \
+    double parallelSumSLL__##type(SLL__##type* sll, ThreadPool* pool) { \
+        int k = segmentCount(sll->size, pool); \
+        SLLSegment__##type* segs = splitSLL__##type(sll, k); \
+        double total = 0; \
+        int i; \
+        \
+        if (segs == NULL) { \
+            return 0; \
+        } \
+        \
+        runSegments(segs, sizeof(SLLSegment__##type), k, sumTaskSLL__##type, pool); \
+        \
+        for (i = 0; i < k; i++) { \
+            total += segs[i].sum; \
+        } \
+        \
+        free(segs); \
+        \
+        return total; \
+    } \
+
+SLL_PARALLEL_SUM(int)
+SLL_PARALLEL_SUM(float)
+SLL_PARALLEL_SUM(char)
+SLL_PARALLEL_SUM(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO REDUCE DATA OF SLL :             MIN / MAX
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Returns the smallest (or largest) element of the list.
+ *
+ * @param sll Pointer to the singly linked list structure.
+ * @param data404Response Value returned when the list is empty.
+ * @param pool Thread pool to run the segments on, or NULL.
+ *
+ * @return The minimum (or maximum) element, or `data404Response`.
+ */
+#define SLL_PARALLEL_EXTREMUM(type, name, op) \
+    static void name##TaskSLL__##type(void* arg) { \
+        SLLSegment__##type* seg = (SLLSegment__##type*) arg; \
+        struct SLLNode__##type* itr = seg->first; \
+        int i; \
+        \
+        seg->best = itr->data; \
+        \
+        for (i = 0; i < seg->count; i++, itr = itr->next) { \
+            if (itr->data op seg->best) { \
+                seg->best = itr->data; \
+            } \
+        } \
+    } \
+    \
+    type parallel##name##SLL__##type(SLL__##type* sll, type data404Response, ThreadPool* pool) { \
+        int k; \
+        SLLSegment__##type* segs; \
+        type best; \
+        int i; \
+        \
+        if (sll->size == 0) { \
+            return data404Response; \
+        } \
+        \
+        k = segmentCount(sll->size, pool); \
+        segs = splitSLL__##type(sll, k); \
+        \
+        if (segs == NULL) { \
+            return data404Response; \
+        } \
+        \
+        runSegments(segs, sizeof(SLLSegment__##type), k, name##TaskSLL__##type, pool); \
+        best = segs[0].best; \
+        \
+        for (i = 1; i < k; i++) { \
+            if (segs[i].best op best) { \
+                best = segs[i].best; \
+            } \
+        } \
+        \
+        free(segs); \
+        \
+        return best; \
+    } \
+
+SLL_PARALLEL_EXTREMUM(int, Min, <)
+SLL_PARALLEL_EXTREMUM(float, Min, <)
+SLL_PARALLEL_EXTREMUM(char, Min, <)
+SLL_PARALLEL_EXTREMUM(double, Min, <)
+SLL_PARALLEL_EXTREMUM(int, Max, >)
+SLL_PARALLEL_EXTREMUM(float, Max, >)
+SLL_PARALLEL_EXTREMUM(char, Max, >)
+SLL_PARALLEL_EXTREMUM(double, Max, >)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO UPDATE DATA OF SLL :             MAP IN PLACE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Replaces every element `x` with `fn(x)`.
+ *
+ * @param sll Pointer to the singly linked list structure.
+ * @param fn Pure function applied to each element; it is called concurrently from several threads.
+ * @param pool Thread pool to run the segments on, or NULL.
+ */
+#define SLL_PARALLEL_MAP(type) \
+    static void mapTaskSLL__##type(void* arg) { \
+        SLLSegment__##type* seg = (SLLSegment__##type*) arg; \
+        struct SLLNode__##type* itr = seg->first; \
+        int i; \
+        \
+        for (i = 0; i < seg->count; i++, itr = itr->next) { \
+            itr->data = seg->fn(itr->data); \
+        } \
+    } \
+    \
+    void parallelMapSLL__##type(SLL__##type* sll, type (*fn)(type), ThreadPool* pool) { \
+        int k = segmentCount(sll->size, pool); \
+        SLLSegment__##type* segs = splitSLL__##type(sll, k); \
+        int i; \
+        \
+        if (segs == NULL) { \
+            return; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].fn = fn; \
+        } \
+        \
+        runSegments(segs, sizeof(SLLSegment__##type), k, mapTaskSLL__##type, pool); \
+        free(segs); \
+    } \
+
+SLL_PARALLEL_MAP(int)
+SLL_PARALLEL_MAP(float)
+SLL_PARALLEL_MAP(char)
+SLL_PARALLEL_MAP(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DELETE DATA OF SLL :             FILTER / DELETE ALL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes and frees every node that fails the predicate.
+ *
+ * Each segment relinks its own survivors, so no two threads ever write the same node. The
+ * surviving runs are then spliced together in O(k) and `head`, `tail` and `size` are recomputed.
+ * parallelDeleteAllSLL() is the same pass with the predicate `data != targetData`.
+ *
+ * @param sll Pointer to the singly linked list structure.
+ * @param keep Predicate returning non-zero for nodes that must stay; called concurrently.
+ * @param pool Thread pool to run the segments on, or NULL.
+ */
+#define SLL_PARALLEL_FILTER(type) \
+    static void filterTaskSLL__##type(void* arg) { \
+        SLLSegment__##type* seg = (SLLSegment__##type*) arg; \
+        struct SLLNode__##type* itr = seg->first; \
+        struct SLLNode__##type* keptFirst = NULL; \
+        struct SLLNode__##type* keptLast = NULL; \
+        struct SLLNode__##type* next; \
+        int i; \
+        \
+        for (i = 0; i < seg->count; i++, itr = next) { \
+            next = itr->next; \
+            \
+            if (seg->keep != NULL ? seg->keep(itr->data) : itr->data != seg->targetData) { \
+                if (keptLast == NULL) { \
+                    keptFirst = itr; \
+                } else { \
+                    keptLast->next = itr; \
+                } \
+                keptLast = itr; \
+                seg->hits++; \
+            } else { \
+                free(itr); \
+            } \
+        } \
+        \
+        seg->first = keptFirst; \
+        seg->last = keptLast; \
+    } \
+    \
+    static void filterSLL__##type(SLL__##type* sll, int (*keep)(type), type targetData, ThreadPool* pool) { \
+        int k = segmentCount(sll->size, pool); \
+        SLLSegment__##type* segs = splitSLL__##type(sll, k); \
+        struct SLLNode__##type* last = NULL; \
+        int i; \
+        \
+        if (segs == NULL) { \
+            return; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].keep = keep; \
+            segs[i].targetData = targetData; \
+        } \
+        \
+        runSegments(segs, sizeof(SLLSegment__##type), k, filterTaskSLL__##type, pool); \
+        \
+        sll->head = NULL; \
+        sll->size = 0; \
+        \
+        for (i = 0; i < k; i++) { \
+            if (segs[i].first == NULL) { \
+                continue; \
+            } \
+            \
+            if (last == NULL) { \
+                sll->head = segs[i].first; \
+            } else { \
+                last->next = segs[i].first; \
+            } \
+            \
+            last = segs[i].last; \
+            sll->size += segs[i].hits; \
+        } \
+        \
+        if (last != NULL) { \
+            last->next = NULL; \
+        } \
+        \
+        sll->tail = last; \
+        free(segs); \
+    } \
+    \
+    void parallelFilterSLL__##type(SLL__##type* sll, int (*keep)(type), ThreadPool* pool) { \
+        filterSLL__##type(sll, keep, (type) 0, pool); \
+    } \
+    \
+    void parallelDeleteAllSLL__##type(SLL__##type* sll, type targetData, ThreadPool* pool) { \
+        filterSLL__##type(sll, NULL, targetData, pool); \
+    } \
+
+SLL_PARALLEL_FILTER(int)
+SLL_PARALLEL_FILTER(float)
+SLL_PARALLEL_FILTER(char)
+SLL_PARALLEL_FILTER(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO COPY DATA OF SLL :               TO ARRAY
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Copies the list into a caller-provided array, each segment writing its own slice.
+ *
+ * @param sll Pointer to the singly linked list structure.
+ * @param out Destination array with room for `sll->size` elements.
+ * @param pool Thread pool to run the segments on, or NULL.
+ *
+ * @return The number of elements written, or -1 if the segment table could not be allocated.
+ */
+#define SLL_PARALLEL_TO_ARRAY(type) \
+    static void toArrayTaskSLL__##type(void* arg) { \
+        SLLSegment__##type* seg = (SLLSegment__##type*) arg; \
+        struct SLLNode__##type* itr = seg->first; \
+        type* dst = seg->out + seg->offset; \
+        int i; \
+        \
+        for (i = 0; i < seg->count; i++, itr = itr->next) { \
+            dst[i] = itr->data; \
+        } \
+    } \
+    \
+    int parallelToArraySLL__##type(SLL__##type* sll, type* out, ThreadPool* pool) { \
+        int k = segmentCount(sll->size, pool); \
+        SLLSegment__##type* segs = splitSLL__##type(sll, k); \
+        int i; \
+        \
+        if (segs == NULL) { \
+            return -1; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].out = out; \
+        } \
+        \
+        runSegments(segs, sizeof(SLLSegment__##type), k, toArrayTaskSLL__##type, pool); \
+        free(segs); \
+        \
+        return sll->size; \
+    } \
+
+SLL_PARALLEL_TO_ARRAY(int)
+SLL_PARALLEL_TO_ARRAY(float)
+SLL_PARALLEL_TO_ARRAY(char)
+SLL_PARALLEL_TO_ARRAY(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO SORT SLL :                       PARALLEL MERGE SORT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Merges two NULL-terminated sorted runs by relinking their nodes.
+ *
+ * Ties are taken from `a` first, so merging an earlier run into `a` keeps the sort stable.
+ *
+ * @param a First sorted run.
+ * @param b Second sorted run.
+ * @param tail Receives the last node of the merged run.
+ *
+ * @return The first node of the merged run.
+ */
+#define SLL_MERGE_RUNS(type) \
+    static struct SLLNode__##type* mergeRunsSLL__##type(struct SLLNode__##type* a, struct SLLNode__##type* b, struct SLLNode__##type** tail) { \
+        struct SLLNode__##type dummy; \
+        struct SLLNode__##type* last = &dummy; \
+        \
+        while (a != NULL && b != NULL) { \
+            if (b->data < a->data) { \
+                last->next = b; \
+                b = b->next; \
+            } else { \
+                last->next = a; \
+                a = a->next; \
+            } \
+            last = last->next; \
+        } \
+        \
+        last->next = a != NULL ? a : b; \
+        \
+        if (tail != NULL) { \
+            while (last->next != NULL) { \
+                last = last->next; \
+            } \
+            *tail = last; \
+        } \
+        \
+        return dummy.next; \
+    } \
+
+SLL_MERGE_RUNS(int)
+SLL_MERGE_RUNS(float)
+SLL_MERGE_RUNS(char)
+SLL_MERGE_RUNS(double)
+
+/**
+ * @brief Sorts the list in ascending order using every worker of the pool.
+ *
+ * 1. The list is cut into one segment per worker and each segment is detached.
+ * 2. Every worker sorts its segment with a bottom-up merge sort that keeps sorted runs in a
+ *    fixed array of 64 bins (run `i` holds 2^i nodes), so no memory is allocated.
+ * 3. Neighbouring segments are merged pairwise in rounds, each round running its merges in
+ *    parallel, until one run is left.
+ * 4. `head`, `tail` and `size` are taken from the final run.
+ *
+ * Only the O(threads) segment table is allocated; all nodes are relinked in place and the sort
+ * is stable.
+ *
+ * @param sll Pointer to the singly linked list structure.
+ * @param pool Thread pool to run the segments on, or NULL to sort on the calling thread.
+ *
+ * @note The last merge round is a single sequential merge of two halves, so the speed-up is
+ *       bounded by that final O(n) pass.
+ */
+#define SLL_PARALLEL_SORT(type) \
+    static void sortTaskSLL__##type(void* arg) { \
+        SLLSegment__##type* seg = (SLLSegment__##type*) arg; \
+        struct SLLNode__##type* bins[64] = {NULL}; \
+        struct SLLNode__##type* itr = seg->first; \
+        struct SLLNode__##type* run; \
+        struct SLLNode__##type* sorted = NULL; \
+        int maxBin = 0; \
+        int i; \
+        \
+        while (itr != NULL) { \
+            run = itr; \
+            itr = itr->next; \
+            run->next = NULL; \
+            \
+            for (i = 0; bins[i] != NULL; i++) { \
+                run = mergeRunsSLL__##type(bins[i], run, NULL); \
+                bins[i] = NULL; \
+            } \
+            \
+            bins[i] = run; \
+            \
+            if (i >= maxBin) { \
+                maxBin = i + 1; \
+            } \
+        } \
+        \
+        for (i = 0; i < maxBin; i++) { \
+            if (bins[i] != NULL) { \
+                sorted = sorted == NULL ? bins[i] : mergeRunsSLL__##type(bins[i], sorted, NULL); \
+            } \
+        } \
+        \
+        seg->first = sorted; \
+        seg->last = sorted; \
+        \
+        while (seg->last != NULL && seg->last->next != NULL) { \
+            seg->last = seg->last->next; \
+        } \
+    } \
+    \
+    static void mergeTaskSLL__##type(void* arg) { \
+        SLLSegment__##type* left = (SLLSegment__##type*) arg; \
+        SLLSegment__##type* right = left + left->hits; \
+        \
+        left->first = mergeRunsSLL__##type(left->first, right->first, &left->last); \
+    } \
+    \
+    void parallelSortSLL__##type(SLL__##type* sll, ThreadPool* pool) { \
+        int k = segmentCount(sll->size, pool); \
+        SLLSegment__##type* segs; \
+        int width, i; \
+        \
+        if (sll->size < 2) { \
+            return; \
+        } \
+        \
+        segs = splitSLL__##type(sll, k); \
+        \
+        if (segs == NULL) { \
+            return; \
+        } \
+        \
+        for (i = 0; i < k; i++) { \
+            segs[i].last->next = NULL; \
+        } \
+        \
+        runSegments(segs, sizeof(SLLSegment__##type), k, sortTaskSLL__##type, pool); \
+        \
+        for (width = 1; width < k; width *= 2) { \
+            for (i = 0; i + width < k; i += 2 * width) { \
+                segs[i].hits = width; \
+                \
+                if (k <= 2 * width) { \
+                    mergeTaskSLL__##type(&segs[i]); \
+                } else if (!submitThreadPool(pool, mergeTaskSLL__##type, &segs[i])) { \
+                    mergeTaskSLL__##type(&segs[i]); \
+                } \
+            } \
+            \
+            if (k > 2 * width) { \
+                waitThreadPool(pool); \
+            } \
+        } \
+        \
+        sll->head = segs[0].first; \
+        sll->tail = segs[0].last; \
+        free(segs); \
+    } \
+
+SLL_PARALLEL_SORT(int)
+SLL_PARALLEL_SORT(float)
+SLL_PARALLEL_SORT(char)
+SLL_PARALLEL_SORT(double)
@@ -0,0 +1,66 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_parallel.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the parallel bulk operations over singly linked lists.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef SLL_PARALLEL_H
+#define SLL_PARALLEL_H
+
+#include "sll.h"
+#include "../TPOOL/tpool.h"
+
+/**
+ * @brief Smallest number of nodes worth handing to a separate worker.
+ *
+ * Lists shorter than two segments of this size are processed on the calling thread.
+ */
+#ifndef PARALLEL_MIN_SEGMENT
+#define PARALLEL_MIN_SEGMENT 16384
+#endif
+
+/**
+ * @brief Macro to declare function prototypes for parallel singly linked list operations.
+ *
+ * Every operation cuts the list into at most `pool->threadCount` contiguous segments in one walk,
+ * runs the per-segment work on the pool and then combines the per-segment results. Operations
+ * that remove nodes stitch the surviving segments back together with O(1) splices.
+ *
+ * @param type The data type for the singly linked list.
+ *
+ * @note The list must not be modified by other threads while an operation is running. Passing a
+ *       NULL pool runs the operation on the calling thread.
+ */
+#define SLL_PARALLEL_PROTO(type) \
+    int parallelCountSLL__##type(SLL__##type* sll, type targetData, ThreadPool* pool); \
+    int parallelIndexOfSLL__##type(SLL__##type* sll, type targetData, ThreadPool* pool); \
+    double parallelSumSLL__##type(SLL__##type* sll, ThreadPool* pool); \
+    type parallelMinSLL__##type(SLL__##type* sll, type data404Response, ThreadPool* pool); \
+    type parallelMaxSLL__##type(SLL__##type* sll, type data404Response, ThreadPool* pool); \
+    void parallelMapSLL__##type(SLL__##type* sll, type (*fn)(type), ThreadPool* pool); \
+    void parallelFilterSLL__##type(SLL__##type* sll, int (*keep)(type), ThreadPool* pool); \
+    void parallelDeleteAllSLL__##type(SLL__##type* sll, type targetData, ThreadPool* pool); \
+    int parallelToArraySLL__##type(SLL__##type* sll, type* out, ThreadPool* pool); \
+    void parallelSortSLL__##type(SLL__##type* sll, ThreadPool* pool); \
+
+SLL_PARALLEL_PROTO(int)
+SLL_PARALLEL_PROTO(float)
+SLL_PARALLEL_PROTO(char)
+SLL_PARALLEL_PROTO(double)
+
+// Macro aliases for function calls
+#define parallelCountSLL(sll, targetData, pool, type) parallelCountSLL__##type(sll, targetData, pool)
+#define parallelIndexOfSLL(sll, targetData, pool, type) parallelIndexOfSLL__##type(sll, targetData, pool)
+#define parallelSumSLL(sll, pool, type) parallelSumSLL__##type(sll, pool)
+#define parallelMinSLL(sll, data404Response, pool, type) parallelMinSLL__##type(sll, data404Response, pool)
+#define parallelMaxSLL(sll, data404Response, pool, type) parallelMaxSLL__##type(sll, data404Response, pool)
+#define parallelMapSLL(sll, fn, pool, type) parallelMapSLL__##type(sll, fn, pool)
+#define parallelFilterSLL(sll, keep, pool, type) parallelFilterSLL__##type(sll, keep, pool)
+#define parallelDeleteAllSLL(sll, targetData, pool, type) parallelDeleteAllSLL__##type(sll, targetData, pool)
+#define parallelSortSLL(sll, pool, type) parallelSortSLL__##type(sll, pool)
+#define parallelToArraySLL(sll, out, pool, type) parallelToArraySLL__##type(sll, out, pool)
+
+
+#endif /* SLL_PARALLEL_H */
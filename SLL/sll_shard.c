@@ -0,0 +1,283 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_shard.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the sll_shard.h header file containing the sharded singly linked list
+ *          implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "sll_shard.h"
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE SHARDED SLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Allocates `shardCount` empty, cache-line aligned shards.
+ *
+ * @param s Pointer to the sharded list structure.
+ * @param shardCount Number of shards, normally one per appending thread.
+ *
+ * @return 1 on success, 0 if `shardCount` is not positive or the allocation failed.
+ */
+#define SHARDED_SLL_INIT(type) \
+    int initShardedSLL__##type(ShardedSLL__##type* s, int shardCount) { \
+        void* shards; \
+        int i; \
+        \
+        if (shardCount <= 0 || \
+            posix_memalign(&shards, SHARD_CACHE_LINE, shardCount * sizeof(SLLShard__##type)) != 0) { \
+            return 0; \
+        } \
+        \
+        s->shards = (SLLShard__##type*) shards; \
+        \
+        for (i = 0; i < shardCount; i++) { \
+            s->shards[i].list.head = NULL; \
+            s->shards[i].list.tail = NULL; \
+            s->shards[i].list.size = 0; \
+            s->shards[i].pool = NULL; \
+            s->shards[i].poolSize = 0; \
+        } \
+        \
+        s->shardCount = shardCount; \
+        \
+        return 1; \
+    } \
+
+SHARDED_SLL_INIT(int)
+SHARDED_SLL_INIT(float)
+SHARDED_SLL_INIT(char)
+SHARDED_SLL_INIT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INSERT DATA TO SHARDED SLL :     TAIL OF OWN SHARD
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Appends `data` to the tail of one shard without any synchronisation.
+ *
+ * The node comes from the shard's pool when one is available and from malloc() otherwise.
+ *
+ * @param s Pointer to the sharded list structure.
+ * @param shard Index of the calling thread's shard.
+ * @param data Data to be appended.
+ *
+ * @return 1 on success, 0 if the pool is empty and malloc() fails; the shard is then unchanged.
+ *
+ * @note Only the thread that owns `shard` may call this for that shard.
+ */
+#define SHARDED_SLL_APPEND(type) \
+    int appendShardedSLL__##type(ShardedSLL__##type* s, int shard, type data) { \
+        SLLShard__##type* own = &s->shards[shard]; \
+        struct SLLNode__##type* node = own->pool; \
+        \
+        if (node != NULL) { \
+            own->pool = node->next; \
+            own->poolSize--; \
+        } else { \
+            node = (struct SLLNode__##type*) malloc(sizeof(struct SLLNode__##type)); \
+            \
+            if (node == NULL) { \
+                return 0; \
+            } \
+        } \
+        \
+        node->data = data; \
+        node->next = NULL; \
+        \
+        if (own->list.tail == NULL) { \
+            own->list.head = node; \
+        } else { \
+            own->list.tail->next = node; \
+        } \
+        \
+        own->list.tail = node; \
+        own->list.size++; \
+        \
+        return 1; \
+    } \
+
+SHARDED_SLL_APPEND(int)
+SHARDED_SLL_APPEND(float)
+SHARDED_SLL_APPEND(char)
+SHARDED_SLL_APPEND(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FILL NODE POOL OF SHARDED SLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Pre-allocates `count` spare nodes into one shard's pool.
+ *
+ * Calling this before a burst moves the allocations out of the append path.
+ *
+ * @param s Pointer to the sharded list structure.
+ * @param shard Index of the shard to fill.
+ * @param count Number of nodes to add.
+ *
+ * @return The number of nodes actually added.
+ */
+#define SHARDED_SLL_RESERVE(type) \
+    int reserveShardedSLL__##type(ShardedSLL__##type* s, int shard, int count) { \
+        SLLShard__##type* own = &s->shards[shard]; \
+        struct SLLNode__##type* node; \
+        int i; \
+        \
+        for (i = 0; i < count; i++) { \
+            node = (struct SLLNode__##type*) malloc(sizeof(struct SLLNode__##type)); \
+            \
+            if (node == NULL) { \
+                break; \
+            } \
+            \
+            node->next = own->pool; \
+            own->pool = node; \
+        } \
+        \
+        own->poolSize += i; \
+        \
+        return i; \
+    } \
+
+SHARDED_SLL_RESERVE(int)
+SHARDED_SLL_RESERVE(float)
+SHARDED_SLL_RESERVE(char)
+SHARDED_SLL_RESERVE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO RETURN NODES TO SHARDED SLL :    O(1) SPLICE INTO POOL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Moves every node of a list that is no longer needed into one shard's pool.
+ *
+ * A collector that repeatedly collects, processes and reclaims reaches a steady state in which
+ * appends never call malloc().
+ *
+ * @param s Pointer to the sharded list structure.
+ * @param shard Index of the shard that receives the nodes.
+ * @param sll List whose nodes are taken; it is left empty.
+ */
+#define SHARDED_SLL_RECLAIM(type) \
+    void reclaimShardedSLL__##type(ShardedSLL__##type* s, int shard, SLL__##type* sll) { \
+        SLLShard__##type* own = &s->shards[shard]; \
+        \
+        if (sll->head == NULL) { \
+            return; \
+        } \
+        \
+        sll->tail->next = own->pool; \
+        own->pool = sll->head; \
+        own->poolSize += sll->size; \
+        \
+        sll->head = NULL; \
+        sll->tail = NULL; \
+        sll->size = 0; \
+    } \
+
+SHARDED_SLL_RECLAIM(int)
+SHARDED_SLL_RECLAIM(float)
+SHARDED_SLL_RECLAIM(char)
+SHARDED_SLL_RECLAIM(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO MERGE SHARDS OF SHARDED SLL :    COLLECT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Splices every shard onto the tail of `out` and leaves the shards empty.
+ *
+ * Each shard is attached with one pointer write, so the cost is O(shardCount) no matter how many
+ * elements were appended. Elements keep their per-shard order; shards follow each other in
+ * index order.
+ *
+ * @param s Pointer to the sharded list structure.
+ * @param out Ordinary singly linked list that receives the nodes (may already hold data).
+ *
+ * @note The appending threads must be quiescent (e.g. behind a barrier) while collecting.
+ */
+#define SHARDED_SLL_COLLECT(type) \
+    void collectShardedSLL__##type(ShardedSLL__##type* s, SLL__##type* out) { \
+        SLL__##type* part; \
+        int i; \
+        \
+        for (i = 0; i < s->shardCount; i++) { \
+            part = &s->shards[i].list; \
+            \
+            if (part->head == NULL) { \
+                continue; \
+            } \
+            \
+            if (out->tail == NULL) { \
+                out->head = part->head; \
+            } else { \
+                out->tail->next = part->head; \
+            } \
+            \
+            out->tail = part->tail; \
+            out->size += part->size; \
+            \
+            part->head = NULL; \
+            part->tail = NULL; \
+            part->size = 0; \
+        } \
+    } \
+
+SHARDED_SLL_COLLECT(int)
+SHARDED_SLL_COLLECT(float)
+SHARDED_SLL_COLLECT(char)
+SHARDED_SLL_COLLECT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO GET SIZE OF SHARDED SLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Returns the number of elements currently held by all shards.
+ *
+ * @param s Pointer to the sharded list structure.
+ *
+ * @return The total element count.
+ */
+#define SHARDED_SLL_SIZE(type) \
+    int sizeShardedSLL__##type(ShardedSLL__##type* s) { \
+        int total = 0; \
+        int i; \
+        \
+        for (i = 0; i < s->shardCount; i++) { \
+            total += s->shards[i].list.size; \
+        } \
+        \
+        return total; \
+    } \
+
+SHARDED_SLL_SIZE(int)
+SHARDED_SLL_SIZE(float)
+SHARDED_SLL_SIZE(char)
+SHARDED_SLL_SIZE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FREE MEMORY ALLOCATED FOR SHARDED SLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Frees every shard's nodes, every pooled node and the shard array.
+ *
+ * @param s Pointer to the sharded list structure.
+ */
+#define SHARDED_SLL_FREE(type) \
+    void freeShardedSLL__##type(ShardedSLL__##type* s) { \
+        struct SLLNode__##type* next; \
+        int i; \
+        \
+        for (i = 0; i < s->shardCount; i++) { \
+            freeSLL__##type(&s->shards[i].list); \
+            \
+            while (s->shards[i].pool != NULL) { \
+                next = s->shards[i].pool->next; \
+                free(s->shards[i].pool); \
+                s->shards[i].pool = next; \
+            } \
+        } \
+        \
+        free(s->shards); \
+        \
+        s->shards = NULL; \
+        s->shardCount = 0; \
+    } \
+
+SHARDED_SLL_FREE(int)
+SHARDED_SLL_FREE(float)
+SHARDED_SLL_FREE(char)
+SHARDED_SLL_FREE(double)
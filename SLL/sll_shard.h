@@ -0,0 +1,83 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_shard.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the per-thread sharded singly linked list.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef SLL_SHARD_H
+#define SLL_SHARD_H
+
+#include "sll.h"
+
+/**
+ * @brief Alignment of each shard, so two appending threads never share a cache line.
+ */
+#ifndef SHARD_CACHE_LINE
+#define SHARD_CACHE_LINE 64
+#endif
+
+/**
+ * @brief Macro to declare a sharded singly linked list for a specific data type.
+ *
+ * Every shard is an ordinary SLL plus a private pool of spare nodes (`pool`, chained through
+ * `next`). A shard is owned by exactly one appending thread, so appends need no locking. The
+ * nodes are still allocated one by one, which keeps the collected list compatible with every
+ * sll.h function, including freeSLL().
+ *
+ * @param type The data type for the sharded list.
+ */
+#define DECLARE_SHARDED_SLL(type) \
+    typedef struct { \
+        _Alignas(SHARD_CACHE_LINE) SLL__##type list; \
+        struct SLLNode__##type* pool; \
+        int poolSize; \
+    } SLLShard__##type; \
+    typedef struct { \
+        SLLShard__##type* shards; \
+        int shardCount; \
+    } ShardedSLL__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for sharded singly linked list operations.
+ *
+ * append / reserve / reclaim touch a single shard and may be called concurrently for different
+ * shards. collect, size and free read every shard and must not race with appends.
+ *
+ * @param type The data type for the sharded list.
+ */
+#define SHARDED_SLL_PROTO(type) \
+    int initShardedSLL__##type(ShardedSLL__##type* s, int shardCount); \
+    int appendShardedSLL__##type(ShardedSLL__##type* s, int shard, type data); \
+    int reserveShardedSLL__##type(ShardedSLL__##type* s, int shard, int count); \
+    void reclaimShardedSLL__##type(ShardedSLL__##type* s, int shard, SLL__##type* sll); \
+    void collectShardedSLL__##type(ShardedSLL__##type* s, SLL__##type* out); \
+    int sizeShardedSLL__##type(ShardedSLL__##type* s); \
+    void freeShardedSLL__##type(ShardedSLL__##type* s); \
+
+// Declaration for int data type
+DECLARE_SHARDED_SLL(int);
+// Declaration for float data type
+DECLARE_SHARDED_SLL(float);
+// Declaration for char data type
+DECLARE_SHARDED_SLL(char);
+// Declaration for double data type
+DECLARE_SHARDED_SLL(double);
+
+SHARDED_SLL_PROTO(int)
+SHARDED_SLL_PROTO(float)
+SHARDED_SLL_PROTO(char)
+SHARDED_SLL_PROTO(double)
+
+// Macro aliases for function calls
+#define initShardedSLL(s, shardCount, type) initShardedSLL__##type(s, shardCount)
+#define appendShardedSLL(s, shard, data, type) appendShardedSLL__##type(s, shard, data)
+#define reserveShardedSLL(s, shard, count, type) reserveShardedSLL__##type(s, shard, count)
+#define reclaimShardedSLL(s, shard, sll, type) reclaimShardedSLL__##type(s, shard, sll)
+#define collectShardedSLL(s, out, type) collectShardedSLL__##type(s, out)
+#define sizeShardedSLL(s, type) sizeShardedSLL__##type(s)
+#define freeShardedSLL(s, type) freeShardedSLL__##type(s)
+
+
+#endif /* SLL_SHARD_H */
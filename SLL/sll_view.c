@@ -0,0 +1,156 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_view.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the sll_view.h header file containing the read-only list view.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include "sll_view.h"
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INIT SLL VIEW :                  BORROW ARRAY
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Points `view` at `size` elements of `data` without copying them.
+ *
+ * @param view Pointer to the view.
+ * @param data Caller-owned array; it must outlive the view.
+ * @param size Number of elements (negative is treated as 0).
+ */
+#define SLL_VIEW_INIT(type) \
+    void initSLLView__##type(SLLView__##type* view, const type* data, int size) { \
+        view->data = data; \
+        view->size = size > 0 && data != NULL ? size : 0; \
+    } \
+
+SLL_VIEW_INIT(int)
+SLL_VIEW_INIT(float)
+SLL_VIEW_INIT(char)
+SLL_VIEW_INIT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO READ SLL VIEW :                  BY INDEX / SIZE / SEARCH / ITERATE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Read operations over the borrowed array.
+ *
+ * getDataAt is O(1) rather than the O(n) walk of getDataAt() on a real list and, like it,
+ * counts negative indices from the tail (-1 is the last element). indexOf returns the first
+ * matching index or -1; count returns the number of matches. forEach calls `visit` once per
+ * element in order.
+ *
+ * @param view Pointer to the view.
+ */
+#define SLL_VIEW_READ(type) \
+    type getDataAtSLLView__##type(const SLLView__##type* view, int targetIdx, type data404Response) { \
+        if (targetIdx < 0) { \
+            targetIdx += view->size; \
+        } \
+        \
+        if (targetIdx < 0 || targetIdx >= view->size) { \
+            return data404Response; \
+        } \
+        \
+        return view->data[targetIdx]; \
+    } \
+    \
+    int sizeSLLView__##type(const SLLView__##type* view) { \
+        return view->size; \
+    } \
+    \
+    int indexOfSLLView__##type(const SLLView__##type* view, type targetData) { \
+        int i; \
+        \
+        for (i = 0; i < view->size; i++) { \
+            if (view->data[i] == targetData) { \
+                return i; \
+            } \
+        } \
+        \
+        return -1; \
+    } \
+    \
+    int countSLLView__##type(const SLLView__##type* view, type targetData) { \
+        int i, hits = 0; \
+        \
+        for (i = 0; i < view->size; i++) { \
+            hits += view->data[i] == targetData; \
+        } \
+        \
+        return hits; \
+    } \
+    \
+    void forEachSLLView__##type(const SLLView__##type* view, void (*visit)(type data, void* ctx), void* ctx) { \
+        int i; \
+        \
+        for (i = 0; i < view->size; i++) { \
+            visit(view->data[i], ctx); \
+        } \
+    } \
+
+SLL_VIEW_READ(int)
+SLL_VIEW_READ(float)
+SLL_VIEW_READ(char)
+SLL_VIEW_READ(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO MATERIALIZE SLL VIEW :           COPY ON WRITE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Copies the viewed elements onto the tail of `sll`, for callers that need to mutate.
+ *
+ * The nodes are linked into a private chain first and spliced on at the end, so running out of
+ * memory leaves `sll` unchanged. They are allocated one by one so the result works with every
+ * sll.h function, including freeSLL().
+ *
+ * @param view Pointer to the view.
+ * @param sll Pointer to the destination list (may already hold data).
+ *
+ * @return 1 on success, 0 if memory ran out.
+ */
+#define SLL_VIEW_MATERIALIZE(type) \
+    int materializeSLLView__##type(const SLLView__##type* view, SLL__##type* sll) { \
+        struct SLLNode__##type* head = NULL; \
+        struct SLLNode__##type* tail = NULL; \
+        struct SLLNode__##type* node; \
+        int i; \
+        \
+        for (i = 0; i < view->size; i++) { \
+            node = (struct SLLNode__##type*) malloc(sizeof(struct SLLNode__##type)); \
+            \
+            if (node == NULL) { \
+                while (head != NULL) { \
+                    node = head->next; \
+                    free(head); \
+                    head = node; \
+                } \
+                return 0; \
+            } \
+            \
+            node->data = view->data[i]; \
+            node->next = NULL; \
+            \
+            if (tail == NULL) { \
+                head = node; \
+            } else { \
+                tail->next = node; \
+            } \
+            tail = node; \
+        } \
+        \
+        if (head != NULL) { \
+            if (sll->tail == NULL) { \
+                sll->head = head; \
+            } else { \
+                sll->tail->next = head; \
+            } \
+            sll->tail = tail; \
+            sll->size += view->size; \
+        } \
+        \
+        return 1; \
+    } \
+
+SLL_VIEW_MATERIALIZE(int)
+SLL_VIEW_MATERIALIZE(float)
+SLL_VIEW_MATERIALIZE(char)
+SLL_VIEW_MATERIALIZE(double)
@@ -0,0 +1,70 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : sll_view.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the read-only singly linked list view over an external array.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef SLL_VIEW_H
+#define SLL_VIEW_H
+
+#include "sll.h"
+
+/**
+ * @brief Macro to declare a read-only list view for a specific data type.
+ *
+ * A view borrows a caller-owned array: nothing is copied or allocated, and the array must stay
+ * alive and unchanged while the view is in use. Mutating the data means materialising the view
+ * into a real SLL first.
+ *
+ * @param type The data type for the view.
+ */
+#define DECLARE_SLL_VIEW(type) \
+    typedef struct { \
+        const type* data; \
+        int size; \
+    } SLLView__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for read-only list view operations.
+ *
+ * getDataAt follows sll.h, including the `data404Response` fallback; every read is O(1) or a
+ * single pass over the array.
+ *
+ * @param type The data type for the view.
+ */
+#define SLL_VIEW_PROTO(type) \
+    void initSLLView__##type(SLLView__##type* view, const type* data, int size); \
+    type getDataAtSLLView__##type(const SLLView__##type* view, int targetIdx, type data404Response); \
+    int sizeSLLView__##type(const SLLView__##type* view); \
+    int indexOfSLLView__##type(const SLLView__##type* view, type targetData); \
+    int countSLLView__##type(const SLLView__##type* view, type targetData); \
+    void forEachSLLView__##type(const SLLView__##type* view, void (*visit)(type data, void* ctx), void* ctx); \
+    int materializeSLLView__##type(const SLLView__##type* view, SLL__##type* sll); \
+
+// Declaration for int data type
+DECLARE_SLL_VIEW(int);
+// Declaration for float data type
+DECLARE_SLL_VIEW(float);
+// Declaration for char data type
+DECLARE_SLL_VIEW(char);
+// Declaration for double data type
+DECLARE_SLL_VIEW(double);
+
+SLL_VIEW_PROTO(int)
+SLL_VIEW_PROTO(float)
+SLL_VIEW_PROTO(char)
+SLL_VIEW_PROTO(double)
+
+// Macro aliases for function calls
+#define initSLLView(view, data, size, type) initSLLView__##type(view, data, size)
+#define getDataAtSLLView(view, targetIdx, data404Response, type) getDataAtSLLView__##type(view, targetIdx, data404Response)
+#define sizeSLLView(view, type) sizeSLLView__##type(view)
+#define indexOfSLLView(view, targetData, type) indexOfSLLView__##type(view, targetData)
+#define countSLLView(view, targetData, type) countSLLView__##type(view, targetData)
+#define forEachSLLView(view, visit, ctx, type) forEachSLLView__##type(view, visit, ctx)
+#define materializeSLLView(view, sll, type) materializeSLLView__##type(view, sll)
+
+
+#endif /* SLL_VIEW_H */
@@ -0,0 +1,295 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : spsc.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the spsc.h header file containing the single-producer/single-consumer
+ *          queue implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include <stdint.h>
+#include "spsc.h"
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE SPSC :                CAPACITY
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Allocates the ring buffer and resets all indices.
+ *
+ * The capacity is rounded up to the next power of two so an index can be mapped to a slot with
+ * a single mask instead of a division.
+ *
+ * @param q Pointer to the queue structure.
+ * @param capacity Minimum number of elements the queue must be able to hold.
+ *
+ * @return 1 on success, 0 if the capacity is zero, too large for its rounded-up buffer size to
+ *         fit in a size_t, or the allocation failed.
+ */
+#define SPSC_INIT(type) \
+    int initSPSC__##type(SPSC__##type* q, size_t capacity) { \
+        size_t rounded = 1; \
+        \
+        if (capacity == 0 || capacity > (SIZE_MAX / sizeof(type)) / 2 + 1) { \
+            return 0; \
+        } \
+        \
+        while (rounded < capacity) { \
+            rounded <<= 1; \
+        } \
+        \
+        q->buffer = (type*) malloc(rounded * sizeof(type)); \
+        \
+        if (q->buffer == NULL) { \
+            return 0; \
+        } \
+        \
+        q->capacity = rounded; \
+        q->mask = rounded - 1; \
+        q->localTail = 0; \
+        q->cachedHead = 0; \
+        q->localHead = 0; \
+        q->cachedTail = 0; \
+        atomic_init(&q->tail, 0); \
+        atomic_init(&q->head, 0); \
+        \
+        return 1; \
+    } \
+
+SPSC_INIT(int)
+SPSC_INIT(float)
+SPSC_INIT(char)
+SPSC_INIT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO PUSH DATA TO SPSC :              PRODUCER
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Appends one element to the queue (producer side).
+ *
+ * The fast path touches only producer-owned fields: the consumer's `head` is re-read only when
+ * the cached copy says the queue is full, and the new `tail` is published with a plain release
+ * store once every SPSC_BATCH elements. No read-modify-write atomic is ever executed.
+ *
+ * @param q Pointer to the queue structure.
+ * @param data Data to be appended.
+ *
+ * @return 1 if the element was queued, 0 if the queue is full.
+ *
+ * @note When the queue is full the pending batch is published before returning so the consumer
+ *       can drain it.
+ */
+#define SPSC_PUSH(type) \
+    int pushSPSC__##type(SPSC__##type* q, type data) { \
+        if (q->localTail - q->cachedHead == q->capacity) { \
+            q->cachedHead = atomic_load_explicit(&q->head, memory_order_acquire); \
+            \
+            if (q->localTail - q->cachedHead == q->capacity) { \
+                atomic_store_explicit(&q->tail, q->localTail, memory_order_release); \
+                return 0; \
+            } \
+        } \
+        \
+        q->buffer[q->localTail & q->mask] = data; \
+        q->localTail++; \
+        \
+        if ((q->localTail & (SPSC_BATCH - 1)) == 0) { \
+            atomic_store_explicit(&q->tail, q->localTail, memory_order_release); \
+        } \
+        \
+        return 1; \
+    } \
+
+SPSC_PUSH(int)
+SPSC_PUSH(float)
+SPSC_PUSH(char)
+SPSC_PUSH(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO PUSH DATA TO SPSC :              BATCH
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Appends up to `count` elements from an array and publishes them with one store.
+ *
+ * @param q Pointer to the queue structure.
+ * @param src Elements to append.
+ * @param count Number of elements available in `src`.
+ *
+ * @return The number of elements actually queued (less than `count` if the queue filled up).
+ */
+#define SPSC_PUSH_BATCH(type) \
+    size_t pushBatchSPSC__##type(SPSC__##type* q, const type* src, size_t count) { \
+        size_t room = q->capacity - (q->localTail - q->cachedHead); \
+        size_t i; \
+        \
+        if (room < count) { \
+            q->cachedHead = atomic_load_explicit(&q->head, memory_order_acquire); \
+            room = q->capacity - (q->localTail - q->cachedHead); \
+        } \
+        \
+        if (count > room) { \
+            count = room; \
+        } \
+        \
+        for (i = 0; i < count; i++) { \
+            q->buffer[(q->localTail + i) & q->mask] = src[i]; \
+        } \
+        \
+        q->localTail += count; \
+        atomic_store_explicit(&q->tail, q->localTail, memory_order_release); \
+        \
+        return count; \
+    } \
+
+SPSC_PUSH_BATCH(int)
+SPSC_PUSH_BATCH(float)
+SPSC_PUSH_BATCH(char)
+SPSC_PUSH_BATCH(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO PUBLISH PENDING DATA OF SPSC
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Makes every element pushed so far visible to the consumer.
+ *
+ * @param q Pointer to the queue structure.
+ *
+ * @note Call this at the end of a burst; otherwise up to SPSC_BATCH - 1 elements stay private to
+ *       the producer until the next batch boundary.
+ */
+#define SPSC_FLUSH(type) \
+    void flushSPSC__##type(SPSC__##type* q) { \
+        atomic_store_explicit(&q->tail, q->localTail, memory_order_release); \
+    } \
+
+SPSC_FLUSH(int)
+SPSC_FLUSH(float)
+SPSC_FLUSH(char)
+SPSC_FLUSH(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO POP DATA FROM SPSC :             CONSUMER
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes the oldest element from the queue (consumer side).
+ *
+ * Mirrors pushSPSC(): the producer's `tail` is only re-read when the cached copy is exhausted,
+ * and the consumer's `head` is published once per SPSC_BATCH elements or whenever the queue is
+ * found empty.
+ *
+ * @param q Pointer to the queue structure.
+ * @param out Receives the removed element.
+ *
+ * @return 1 if an element was removed, 0 if the queue is empty.
+ */
+#define SPSC_POP(type) \
+    int popSPSC__##type(SPSC__##type* q, type* out) { \
+        if (q->localHead == q->cachedTail) { \
+            q->cachedTail = atomic_load_explicit(&q->tail, memory_order_acquire); \
+            \
+            if (q->localHead == q->cachedTail) { \
+                atomic_store_explicit(&q->head, q->localHead, memory_order_release); \
+                return 0; \
+            } \
+        } \
+        \
+        *out = q->buffer[q->localHead & q->mask]; \
+        q->localHead++; \
+        \
+        if ((q->localHead & (SPSC_BATCH - 1)) == 0) { \
+            atomic_store_explicit(&q->head, q->localHead, memory_order_release); \
+        } \
+        \
+        return 1; \
+    } \
+
+SPSC_POP(int)
+SPSC_POP(float)
+SPSC_POP(char)
+SPSC_POP(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO POP DATA FROM SPSC :             BATCH
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes up to `count` elements into an array and releases their slots with one store.
+ *
+ * @param q Pointer to the queue structure.
+ * @param dst Destination array with room for `count` elements.
+ * @param count Maximum number of elements to remove.
+ *
+ * @return The number of elements actually removed.
+ */
+#define SPSC_POP_BATCH(type) \
+    size_t popBatchSPSC__##type(SPSC__##type* q, type* dst, size_t count) { \
+        size_t ready = q->cachedTail - q->localHead; \
+        size_t i; \
+        \
+        if (ready < count) { \
+            q->cachedTail = atomic_load_explicit(&q->tail, memory_order_acquire); \
+            ready = q->cachedTail - q->localHead; \
+        } \
+        \
+        if (count > ready) { \
+            count = ready; \
+        } \
+        \
+        for (i = 0; i < count; i++) { \
+            dst[i] = q->buffer[(q->localHead + i) & q->mask]; \
+        } \
+        \
+        q->localHead += count; \
+        atomic_store_explicit(&q->head, q->localHead, memory_order_release); \
+        \
+        return count; \
+    } \
+
+SPSC_POP_BATCH(int)
+SPSC_POP_BATCH(float)
+SPSC_POP_BATCH(char)
+SPSC_POP_BATCH(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO GET SIZE OF SPSC
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Returns the number of published elements not yet released by the consumer.
+ *
+ * @param q Pointer to the queue structure.
+ *
+ * @return An approximate element count; it may be stale by the time the caller reads it.
+ */
+#define SPSC_SIZE(type) \
+    size_t sizeSPSC__##type(SPSC__##type* q) { \
+        size_t head = atomic_load_explicit(&q->head, memory_order_acquire); \
+        size_t tail = atomic_load_explicit(&q->tail, memory_order_acquire); \
+        \
+        return tail - head; \
+    } \
+
+SPSC_SIZE(int)
+SPSC_SIZE(float)
+SPSC_SIZE(char)
+SPSC_SIZE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FREE MEMORY ALLOCATED FOR SPSC
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Releases the ring buffer and resets the queue.
+ *
+ * @param q Pointer to the queue structure.
+ *
+ * @note Both threads must have stopped using the queue before it is freed.
+ */
+#define SPSC_FREE(type) \
+    void freeSPSC__##type(SPSC__##type* q) { \
+        free(q->buffer); \
+        \
+        q->buffer = NULL; \
+        q->capacity = 0; \
+        q->mask = 0; \
+        q->localTail = 0; \
+        q->cachedHead = 0; \
+        q->localHead = 0; \
+        q->cachedTail = 0; \
+        atomic_store(&q->tail, 0); \
+        atomic_store(&q->head, 0); \
+    } \
+
+SPSC_FREE(int)
+SPSC_FREE(float)
+SPSC_FREE(char)
+SPSC_FREE(double)
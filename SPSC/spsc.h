@@ -0,0 +1,102 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : spsc.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the wait-free single-producer/single-consumer queue implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef SPSC_H
+#define SPSC_H
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+/**
+ * @brief Size of a cache line on the target machine.
+ *
+ * The producer-owned and consumer-owned indices are placed on different cache lines so the two
+ * threads never write to the same line.
+ */
+#ifndef SPSC_CACHE_LINE
+#define SPSC_CACHE_LINE 64
+#endif
+
+/**
+ * @brief Number of pushes (or pops) after which the private index is published to the other side.
+ *
+ * Publishing is a single release store, so batching only reduces how often the other thread's
+ * cache line gets invalidated. Call flushSPSC() after a burst to publish a partial batch.
+ * Must be a power of two.
+ */
+#ifndef SPSC_BATCH
+#define SPSC_BATCH 32
+#endif
+
+/**
+ * @brief Macro to declare a single-producer/single-consumer ring buffer for a specific data type.
+ *
+ * `tail` / `head` are the published indices; `localTail` / `localHead` are the private working
+ * indices and `cachedHead` / `cachedTail` are each side's last snapshot of the other's index.
+ * Indices grow monotonically and are masked into the power-of-two sized buffer.
+ *
+ * @param type The data type for the queue.
+ */
+#define DECLARE_SPSC(type) \
+    typedef struct { \
+        _Alignas(SPSC_CACHE_LINE) _Atomic size_t tail; \
+        size_t localTail; \
+        size_t cachedHead; \
+        _Alignas(SPSC_CACHE_LINE) _Atomic size_t head; \
+        size_t localHead; \
+        size_t cachedTail; \
+        _Alignas(SPSC_CACHE_LINE) type* buffer; \
+        size_t mask; \
+        size_t capacity; \
+    } SPSC__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for single-producer/single-consumer queue operations.
+ *
+ * push / pushBatch / flush may only be called from the producer thread, and pop / popBatch only
+ * from the consumer thread. init and free must not race with either side.
+ *
+ * @param type The data type for the queue.
+ */
+#define SPSC_PROTO(type) \
+    int initSPSC__##type(SPSC__##type* q, size_t capacity); \
+    int pushSPSC__##type(SPSC__##type* q, type data); \
+    size_t pushBatchSPSC__##type(SPSC__##type* q, const type* src, size_t count); \
+    void flushSPSC__##type(SPSC__##type* q); \
+    int popSPSC__##type(SPSC__##type* q, type* out); \
+    size_t popBatchSPSC__##type(SPSC__##type* q, type* dst, size_t count); \
+    size_t sizeSPSC__##type(SPSC__##type* q); \
+    void freeSPSC__##type(SPSC__##type* q); \
+
+// Declaration for int data type
+DECLARE_SPSC(int);
+// Declaration for float data type
+DECLARE_SPSC(float);
+// Declaration for char data type
+DECLARE_SPSC(char);
+// Declaration for double data type
+DECLARE_SPSC(double);
+
+SPSC_PROTO(int)
+SPSC_PROTO(float)
+SPSC_PROTO(char)
+SPSC_PROTO(double)
+
+// Macro aliases for function calls
+#define initSPSC(q, capacity, type) initSPSC__##type(q, capacity)
+#define pushSPSC(q, data, type) pushSPSC__##type(q, data)
+#define pushBatchSPSC(q, src, count, type) pushBatchSPSC__##type(q, src, count)
+#define flushSPSC(q, type) flushSPSC__##type(q)
+#define popSPSC(q, out, type) popSPSC__##type(q, out)
+#define popBatchSPSC(q, dst, count, type) popBatchSPSC__##type(q, dst, count)
+#define sizeSPSC(q, type) sizeSPSC__##type(q)
+#define freeSPSC(q, type) freeSPSC__##type(q)
+
+
+#endif /* SPSC_H */
@@ -0,0 +1,208 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : tpool.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the tpool.h header file containing the thread pool implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <unistd.h>
+#include "tpool.h"
+
+// -------------------------------------------------------------------------------------------->
+// WORKER LOOP OF THREAD POOL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Body of every worker thread: pop a job, run it, report completion, repeat.
+ *
+ * @param arg Pointer to the owning ThreadPool.
+ *
+ * @return NULL once the pool is shut down and the queue is empty.
+ */
+static void* workerThreadPool(void* arg) {
+    ThreadPool* pool = (ThreadPool*) arg;
+    ThreadPoolJob job;
+
+    pthread_mutex_lock(&pool->lock);
+
+    while (1) {
+        while (pool->count == 0 && !pool->shutdown) {
+            pthread_cond_wait(&pool->notEmpty, &pool->lock);
+        }
+
+        if (pool->count == 0 && pool->shutdown) {
+            break;
+        }
+
+        job = pool->jobs[pool->head];
+        pool->head = (pool->head + 1) % pool->capacity;
+        pool->count--;
+
+        pthread_mutex_unlock(&pool->lock);
+        job.task(job.arg);
+        pthread_mutex_lock(&pool->lock);
+
+        pool->pending--;
+
+        if (pool->pending == 0) {
+            pthread_cond_broadcast(&pool->done);
+        }
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE THREAD POOL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Starts `threadCount` worker threads.
+ *
+ * @param pool Pointer to the pool structure.
+ * @param threadCount Number of workers; zero or a negative value uses the number of online CPUs.
+ *
+ * @return 1 on success, 0 if memory or threads could not be allocated.
+ */
+int initThreadPool(ThreadPool* pool, int threadCount) {
+    int i;
+
+    if (threadCount <= 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threadCount = online > 0 ? (int) online : 1;
+    }
+
+    pool->capacity = 64;
+    pool->jobs = (ThreadPoolJob*) malloc(pool->capacity * sizeof(ThreadPoolJob));
+    pool->threads = (pthread_t*) malloc(threadCount * sizeof(pthread_t));
+
+    if (pool->jobs == NULL || pool->threads == NULL) {
+        free(pool->jobs);
+        free(pool->threads);
+        return 0;
+    }
+
+    pool->threadCount = 0;
+    pool->head = 0;
+    pool->count = 0;
+    pool->pending = 0;
+    pool->shutdown = 0;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->notEmpty, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    for (i = 0; i < threadCount; i++) {
+        if (pthread_create(&pool->threads[i], NULL, workerThreadPool, pool) != 0) {
+            break;
+        }
+        pool->threadCount++;
+    }
+
+    if (pool->threadCount == 0) {
+        freeThreadPool(pool);
+        return 0;
+    }
+
+    return 1;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO SUBMIT A TASK TO THREAD POOL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Queues `task(arg)` for execution on one of the workers.
+ *
+ * The job queue doubles in size when it is full, so submission never blocks.
+ *
+ * @param pool Pointer to the pool structure.
+ * @param task Function to run.
+ * @param arg Argument passed to `task`.
+ *
+ * @return 1 on success, 0 if the queue could not grow.
+ */
+int submitThreadPool(ThreadPool* pool, ThreadTask task, void* arg) {
+    pthread_mutex_lock(&pool->lock);
+
+    if (pool->count == pool->capacity) {
+        ThreadPoolJob* grown = (ThreadPoolJob*) malloc(2 * pool->capacity * sizeof(ThreadPoolJob));
+        int i;
+
+        if (grown == NULL) {
+            pthread_mutex_unlock(&pool->lock);
+            return 0;
+        }
+
+        for (i = 0; i < pool->count; i++) {
+            grown[i] = pool->jobs[(pool->head + i) % pool->capacity];
+        }
+
+        free(pool->jobs);
+        pool->jobs = grown;
+        pool->head = 0;
+        pool->capacity *= 2;
+    }
+
+    pool->jobs[(pool->head + pool->count) % pool->capacity].task = task;
+    pool->jobs[(pool->head + pool->count) % pool->capacity].arg = arg;
+    pool->count++;
+    pool->pending++;
+
+    pthread_cond_signal(&pool->notEmpty);
+    pthread_mutex_unlock(&pool->lock);
+
+    return 1;
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO WAIT FOR ALL TASKS OF THREAD POOL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Blocks until every task submitted so far has finished.
+ *
+ * @param pool Pointer to the pool structure.
+ *
+ * @note The pool does not track who submitted what, so if several threads share one pool this
+ *       also waits for their tasks.
+ */
+void waitThreadPool(ThreadPool* pool) {
+    pthread_mutex_lock(&pool->lock);
+
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FREE MEMORY ALLOCATED FOR THREAD POOL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Finishes the queued tasks, joins every worker and releases the pool.
+ *
+ * @param pool Pointer to the pool structure.
+ */
+void freeThreadPool(ThreadPool* pool) {
+    int i;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->notEmpty);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < pool->threadCount; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->notEmpty);
+    pthread_cond_destroy(&pool->done);
+    free(pool->threads);
+    free(pool->jobs);
+
+    pool->threads = NULL;
+    pool->jobs = NULL;
+    pool->threadCount = 0;
+    pool->capacity = 0;
+    pool->count = 0;
+    pool->pending = 0;
+}
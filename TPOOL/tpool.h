@@ -0,0 +1,55 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : tpool.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the fixed-size worker thread pool used by the parallel list operations.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef TPOOL_H
+#define TPOOL_H
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+/**
+ * @brief Signature of a unit of work submitted to the pool.
+ */
+typedef void (*ThreadTask)(void* arg);
+
+/**
+ * @brief A queued task and its argument.
+ */
+typedef struct {
+    ThreadTask task;
+    void* arg;
+} ThreadPoolJob;
+
+/**
+ * @brief Fixed set of worker threads draining a growable FIFO of jobs.
+ *
+ * `pending` counts jobs that were submitted but have not finished yet; waitThreadPool() sleeps
+ * on `done` until it drops to zero.
+ */
+typedef struct {
+    pthread_t* threads;
+    int threadCount;
+    ThreadPoolJob* jobs;
+    int capacity;
+    int head;
+    int count;
+    int pending;
+    int shutdown;
+    pthread_mutex_t lock;
+    pthread_cond_t notEmpty;
+    pthread_cond_t done;
+} ThreadPool;
+
+int initThreadPool(ThreadPool* pool, int threadCount);
+int submitThreadPool(ThreadPool* pool, ThreadTask task, void* arg);
+void waitThreadPool(ThreadPool* pool);
+void freeThreadPool(ThreadPool* pool);
+
+
+#endif /* TPOOL_H */
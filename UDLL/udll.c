@@ -0,0 +1,881 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : udll.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the udll.h header file containing the unrolled doubly linked list
+ *          and its incremental snapshot implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include <string.h>
+#include "udll.h"
+
+#define UDLL_HEADER 56
+#define UDLL_SEED 0xcbf29ce484222325ULL
+
+/**
+ * @brief Running checksum over a byte stream that arrives in pieces of arbitrary length.
+ *
+ * Bytes are folded in 8 at a time with the same mix as checksumPayloadSLL(); `tail` holds the
+ * bytes of an unfinished word between calls.
+ */
+typedef struct {
+    uint64_t h;
+    unsigned char tail[8];
+    size_t n;
+} UDLLHash;
+
+/**
+ * @brief Pairs a block id with its block, so blocks can be sorted and looked up by id.
+ */
+typedef struct {
+    uint32_t id;
+    void* block;
+} UDLLBlockRef;
+
+// -------------------------------------------------------------------------------------------->
+// SNAPSHOT HELPERS
+// -------------------------------------------------------------------------------------------->
+static void mixWordUDLL(UDLLHash* hash, const unsigned char* word) {
+    uint64_t w;
+
+    memcpy(&w, word, 8);
+    hash->h = (hash->h ^ w) * 0x100000001b3ULL;
+    hash->h ^= hash->h >> 29;
+}
+
+static void updateHashUDLL(UDLLHash* hash, const void* data, size_t len) {
+    const unsigned char* p = (const unsigned char*) data;
+
+    while (len > 0 && hash->n > 0) {
+        hash->tail[hash->n++] = *p++;
+        len--;
+
+        if (hash->n == 8) {
+            mixWordUDLL(hash, hash->tail);
+            hash->n = 0;
+        }
+    }
+
+    for (; len >= 8; p += 8, len -= 8) {
+        mixWordUDLL(hash, p);
+    }
+
+    memcpy(hash->tail, p, len);
+    hash->n = len;
+}
+
+static uint64_t finishHashUDLL(UDLLHash* hash) {
+    if (hash->n > 0) {
+        memset(hash->tail + hash->n, 0, 8 - hash->n);
+        mixWordUDLL(hash, hash->tail);
+        hash->n = 0;
+    }
+
+    return hash->h;
+}
+
+/**
+ * @brief Writes `len` bytes and folds them into the checksum.
+ */
+static int writeHashedUDLL(FILE* fp, UDLLHash* hash, const void* data, size_t len) {
+    updateHashUDLL(hash, data, len);
+
+    return len == 0 || fwrite(data, 1, len, fp) == len;
+}
+
+/**
+ * @brief Reads `len` bytes and folds them into the checksum.
+ */
+static int readHashedUDLL(FILE* fp, UDLLHash* hash, void* data, size_t len) {
+    if (len > 0 && fread(data, 1, len, fp) != len) {
+        return 0;
+    }
+
+    updateHashUDLL(hash, data, len);
+
+    return 1;
+}
+
+static int compareBlockRefUDLL(const void* a, const void* b) {
+    uint32_t x = ((const UDLLBlockRef*) a)->id;
+    uint32_t y = ((const UDLLBlockRef*) b)->id;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Finds the entry for `id` in `refs`, sorted by id.
+ *
+ * @return The index of the entry, or -1 if there is none.
+ */
+static long findBlockRefUDLL(const UDLLBlockRef* refs, size_t count, uint32_t id) {
+    size_t lo = 0, hi = count, mid;
+
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+
+        if (refs[mid].id < id) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo < count && refs[lo].id == id ? (long) lo : -1;
+}
+// -------------------------------------------------------------------------------------------->
+// BLOCK HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Generates the static block helpers for one element type.
+ *
+ * - markDirty: flags a block as changed since the last snapshot.
+ * - newBlock: allocates an empty block with a fresh id, linked after `prev` (at the head if
+ *   `prev` is NULL). New blocks start dirty so the next delta carries them.
+ * - unlinkBlock: removes a block from the chain and frees it.
+ * - locate: finds the block and offset holding element `targetIdx`, walking from the nearer
+ *   end and skipping whole blocks.
+ * - removeAt: removes one element from a block, dropping the block when it becomes empty.
+ */
+#define UDLL_HELPERS(type) \
+    static void markDirtyUDLL__##type(UDLL__##type* u, struct UDLLBlock__##type* block) { \
+        if (!block->dirty) { \
+            block->dirty = 1; \
+            u->dirtyCount++; \
+        } \
+    } \
+    \
+    static struct UDLLBlock__##type* newBlockUDLL__##type(UDLL__##type* u, struct UDLLBlock__##type* prev) { \
+        struct UDLLBlock__##type* block = (struct UDLLBlock__##type*) malloc(sizeof(struct UDLLBlock__##type)); \
+        \
+        if (block == NULL) { \
+            return NULL; \
+        } \
+        \
+        block->id = u->nextId++; \
+        block->count = 0; \
+        block->dirty = 0; \
+        block->prev = prev; \
+        block->next = prev == NULL ? u->head : prev->next; \
+        \
+        if (block->next != NULL) { \
+            block->next->prev = block; \
+        } else { \
+            u->tail = block; \
+        } \
+        \
+        if (prev != NULL) { \
+            prev->next = block; \
+        } else { \
+            u->head = block; \
+        } \
+        \
+        u->blockCount++; \
+        markDirtyUDLL__##type(u, block); \
+        \
+        return block; \
+    } \
+    \
+    static void unlinkBlockUDLL__##type(UDLL__##type* u, struct UDLLBlock__##type* block) { \
+        if (block->prev != NULL) { \
+            block->prev->next = block->next; \
+        } else { \
+            u->head = block->next; \
+        } \
+        \
+        if (block->next != NULL) { \
+            block->next->prev = block->prev; \
+        } else { \
+            u->tail = block->prev; \
+        } \
+        \
+        if (block->dirty) { \
+            u->dirtyCount--; \
+        } \
+        \
+        u->blockCount--; \
+        free(block); \
+    } \
+    \
+    static struct UDLLBlock__##type* locateUDLL__##type(UDLL__##type* u, int targetIdx, int* offset) { \
+        struct UDLLBlock__##type* block; \
+        int base; \
+        \
+        if (targetIdx < u->size / 2) { \
+            block = u->head; \
+            base = 0; \
+            \
+            while (base + block->count <= targetIdx) { \
+                base += block->count; \
+                block = block->next; \
+            } \
+        } else { \
+            block = u->tail; \
+            base = u->size - block->count; \
+            \
+            while (base > targetIdx) { \
+                block = block->prev; \
+                base -= block->count; \
+            } \
+        } \
+        \
+        *offset = targetIdx - base; \
+        \
+        return block; \
+    } \
+    \
+    static void removeAtUDLL__##type(UDLL__##type* u, struct UDLLBlock__##type* block, int offset) { \
+        memmove(block->data + offset, block->data + offset + 1, (size_t) (block->count - offset - 1) * sizeof(type)); \
+        block->count--; \
+        u->size--; \
+        \
+        if (block->count == 0) { \
+            unlinkBlockUDLL__##type(u, block); \
+        } else { \
+            markDirtyUDLL__##type(u, block); \
+        } \
+    } \
+
+UDLL_HELPERS(int)
+UDLL_HELPERS(float)
+UDLL_HELPERS(char)
+UDLL_HELPERS(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE UDLL :                EMPTY LIST
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Initializes an empty unrolled list at generation 0 (no snapshot taken yet).
+ *
+ * @param u Pointer to the unrolled list.
+ */
+#define UDLL_INIT(type) \
+    void initUDLL__##type(UDLL__##type* u) { \
+        u->head = NULL; \
+        u->tail = NULL; \
+        u->size = 0; \
+        u->blockCount = 0; \
+        u->dirtyCount = 0; \
+        u->nextId = 1; \
+        u->generation = 0; \
+    } \
+
+UDLL_INIT(int)
+UDLL_INIT(float)
+UDLL_INIT(char)
+UDLL_INIT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INSERT AT HEAD :                 SHIFT IN FIRST BLOCK
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Inserts an element at the head, opening a new head block if the first one is full.
+ *
+ * @param u Pointer to the unrolled list.
+ * @param data The element to insert.
+ *
+ * @return 1 on success, 0 if a new block could not be allocated.
+ */
+#define UDLL_INSERT_AT_HEAD(type) \
+    int insertAtHeadUDLL__##type(UDLL__##type* u, type data) { \
+        struct UDLLBlock__##type* block = u->head; \
+        \
+        if (block == NULL || block->count == UDLL_BLOCK_CAPACITY) { \
+            block = newBlockUDLL__##type(u, NULL); \
+            \
+            if (block == NULL) { \
+                return 0; \
+            } \
+        } \
+        \
+        memmove(block->data + 1, block->data, (size_t) block->count * sizeof(type)); \
+        block->data[0] = data; \
+        block->count++; \
+        u->size++; \
+        markDirtyUDLL__##type(u, block); \
+        \
+        return 1; \
+    } \
+
+UDLL_INSERT_AT_HEAD(int)
+UDLL_INSERT_AT_HEAD(float)
+UDLL_INSERT_AT_HEAD(char)
+UDLL_INSERT_AT_HEAD(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INSERT AT TAIL :                 APPEND TO LAST BLOCK
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Appends an element, opening a new tail block if the last one is full.
+ *
+ * Appends fill blocks completely, so a list built by appending uses the least memory and the
+ * fewest blocks.
+ *
+ * @param u Pointer to the unrolled list.
+ * @param data The element to insert.
+ *
+ * @return 1 on success, 0 if a new block could not be allocated.
+ */
+#define UDLL_INSERT_AT_TAIL(type) \
+    int insertAtTailUDLL__##type(UDLL__##type* u, type data) { \
+        struct UDLLBlock__##type* block = u->tail; \
+        \
+        if (block == NULL || block->count == UDLL_BLOCK_CAPACITY) { \
+            block = newBlockUDLL__##type(u, u->tail); \
+            \
+            if (block == NULL) { \
+                return 0; \
+            } \
+        } \
+        \
+        block->data[block->count++] = data; \
+        u->size++; \
+        markDirtyUDLL__##type(u, block); \
+        \
+        return 1; \
+    } \
+
+UDLL_INSERT_AT_TAIL(int)
+UDLL_INSERT_AT_TAIL(float)
+UDLL_INSERT_AT_TAIL(char)
+UDLL_INSERT_AT_TAIL(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INSERT AT INDEX :                SPLIT FULL BLOCK
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Inserts an element so that it ends up at `targetIdx`.
+ *
+ * An index at or below 0 inserts at the head and one at or past the size inserts at the tail,
+ * as in insertAtDLL(). A full block is split in half first, which dirties both halves; every
+ * other insert dirties only the block it lands in.
+ *
+ * @param u Pointer to the unrolled list.
+ * @param data The element to insert.
+ * @param targetIdx The position of the new element.
+ *
+ * @return 1 on success, 0 if a new block could not be allocated.
+ */
+#define UDLL_INSERT_AT(type) \
+    int insertAtUDLL__##type(UDLL__##type* u, type data, int targetIdx) { \
+        struct UDLLBlock__##type* block; \
+        struct UDLLBlock__##type* split; \
+        int offset, half = UDLL_BLOCK_CAPACITY / 2; \
+        \
+        if (targetIdx <= 0) { \
+            return insertAtHeadUDLL__##type(u, data); \
+        } \
+        \
+        if (targetIdx >= u->size) { \
+            return insertAtTailUDLL__##type(u, data); \
+        } \
+        \
+        block = locateUDLL__##type(u, targetIdx, &offset); \
+        \
+        if (block->count == UDLL_BLOCK_CAPACITY) { \
+            split = newBlockUDLL__##type(u, block); \
+            \
+            if (split == NULL) { \
+                return 0; \
+            } \
+            \
+            memcpy(split->data, block->data + half, (size_t) (block->count - half) * sizeof(type)); \
+            split->count = block->count - half; \
+            block->count = half; \
+            \
+            if (offset > half) { \
+                markDirtyUDLL__##type(u, block); \
+                block = split; \
+                offset -= half; \
+            } \
+        } \
+        \
+        memmove(block->data + offset + 1, block->data + offset, (size_t) (block->count - offset) * sizeof(type)); \
+        block->data[offset] = data; \
+        block->count++; \
+        u->size++; \
+        markDirtyUDLL__##type(u, block); \
+        \
+        return 1; \
+    } \
+
+UDLL_INSERT_AT(int)
+UDLL_INSERT_AT(float)
+UDLL_INSERT_AT(char)
+UDLL_INSERT_AT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DELETE HEAD :                    FIRST ELEMENT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes the first element, if any.
+ *
+ * @param u Pointer to the unrolled list.
+ */
+#define UDLL_DELETE_HEAD(type) \
+    void deleteHeadUDLL__##type(UDLL__##type* u) { \
+        if (u->head != NULL) { \
+            removeAtUDLL__##type(u, u->head, 0); \
+        } \
+    } \
+
+UDLL_DELETE_HEAD(int)
+UDLL_DELETE_HEAD(float)
+UDLL_DELETE_HEAD(char)
+UDLL_DELETE_HEAD(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DELETE TAIL :                    LAST ELEMENT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes the last element, if any.
+ *
+ * @param u Pointer to the unrolled list.
+ */
+#define UDLL_DELETE_TAIL(type) \
+    void deleteTailUDLL__##type(UDLL__##type* u) { \
+        if (u->tail != NULL) { \
+            removeAtUDLL__##type(u, u->tail, u->tail->count - 1); \
+        } \
+    } \
+
+UDLL_DELETE_TAIL(int)
+UDLL_DELETE_TAIL(float)
+UDLL_DELETE_TAIL(char)
+UDLL_DELETE_TAIL(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO DELETE AT INDEX :                BY POSITION
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Removes the element at `targetIdx`. Out-of-range indices are ignored.
+ *
+ * A block that becomes empty is freed; the next snapshot's manifest simply no longer lists it.
+ *
+ * @param u Pointer to the unrolled list.
+ * @param targetIdx The position of the element to remove.
+ */
+#define UDLL_DELETE_AT(type) \
+    void deleteAtUDLL__##type(UDLL__##type* u, int targetIdx) { \
+        struct UDLLBlock__##type* block; \
+        int offset; \
+        \
+        if (targetIdx < 0 || targetIdx >= u->size) { \
+            return; \
+        } \
+        \
+        block = locateUDLL__##type(u, targetIdx, &offset); \
+        removeAtUDLL__##type(u, block, offset); \
+    } \
+
+UDLL_DELETE_AT(int)
+UDLL_DELETE_AT(float)
+UDLL_DELETE_AT(char)
+UDLL_DELETE_AT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO GET DATA AT INDEX :              BY POSITION
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Returns the element at `targetIdx`.
+ *
+ * @param u Pointer to the unrolled list.
+ * @param targetIdx The position of the element.
+ * @param data404Response Value returned if `targetIdx` is out of range.
+ *
+ * @return The element, or `data404Response`.
+ */
+#define UDLL_GET_DATA_AT(type) \
+    type getDataAtUDLL__##type(UDLL__##type* u, int targetIdx, type data404Response) { \
+        struct UDLLBlock__##type* block; \
+        int offset; \
+        \
+        if (targetIdx < 0 || targetIdx >= u->size) { \
+            return data404Response; \
+        } \
+        \
+        block = locateUDLL__##type(u, targetIdx, &offset); \
+        \
+        return block->data[offset]; \
+    } \
+
+UDLL_GET_DATA_AT(int)
+UDLL_GET_DATA_AT(float)
+UDLL_GET_DATA_AT(char)
+UDLL_GET_DATA_AT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO UPDATE DATA AT INDEX :           BY POSITION
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Overwrites the element at `targetIdx` and marks its block dirty. Out-of-range indices
+ *        are ignored.
+ *
+ * @param u Pointer to the unrolled list.
+ * @param targetIdx The position of the element.
+ * @param newData The new value.
+ */
+#define UDLL_UPDATE_AT(type) \
+    void updateAtUDLL__##type(UDLL__##type* u, int targetIdx, type newData) { \
+        struct UDLLBlock__##type* block; \
+        int offset; \
+        \
+        if (targetIdx < 0 || targetIdx >= u->size) { \
+            return; \
+        } \
+        \
+        block = locateUDLL__##type(u, targetIdx, &offset); \
+        block->data[offset] = newData; \
+        markDirtyUDLL__##type(u, block); \
+    } \
+
+UDLL_UPDATE_AT(int)
+UDLL_UPDATE_AT(float)
+UDLL_UPDATE_AT(char)
+UDLL_UPDATE_AT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO GET SIZE :                       ELEMENT COUNT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Returns the number of elements in the list.
+ *
+ * @param u Pointer to the unrolled list.
+ *
+ * @return The element count.
+ */
+#define UDLL_SIZE(type) \
+    int sizeUDLL__##type(UDLL__##type* u) { \
+        return u->size; \
+    } \
+
+UDLL_SIZE(int)
+UDLL_SIZE(float)
+UDLL_SIZE(char)
+UDLL_SIZE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO VISIT ELEMENTS :                 IN ORDER
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Calls `visit` on every element from head to tail.
+ *
+ * @param u Pointer to the unrolled list.
+ * @param visit Callback receiving each element and `ctx`.
+ * @param ctx User pointer passed through to `visit`.
+ */
+#define UDLL_FOR_EACH(type) \
+    void forEachUDLL__##type(UDLL__##type* u, void (*visit)(type data, void* ctx), void* ctx) { \
+        struct UDLLBlock__##type* block; \
+        int i; \
+        \
+        for (block = u->head; block != NULL; block = block->next) { \
+            for (i = 0; i < block->count; i++) { \
+                visit(block->data[i], ctx); \
+            } \
+        } \
+    } \
+
+UDLL_FOR_EACH(int)
+UDLL_FOR_EACH(float)
+UDLL_FOR_EACH(char)
+UDLL_FOR_EACH(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO COUNT DIRTY BLOCKS :             SINCE LAST SNAPSHOT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Returns how many blocks changed since the last snapshot, i.e. how many block records
+ *        the next delta snapshot will hold.
+ *
+ * @param u Pointer to the unrolled list.
+ *
+ * @return The dirty block count.
+ */
+#define UDLL_DIRTY_BLOCKS(type) \
+    int dirtyBlocksUDLL__##type(UDLL__##type* u) { \
+        return u->dirtyCount; \
+    } \
+
+UDLL_DIRTY_BLOCKS(int)
+UDLL_DIRTY_BLOCKS(float)
+UDLL_DIRTY_BLOCKS(char)
+UDLL_DIRTY_BLOCKS(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO SNAPSHOT UDLL :                  FULL OR DELTA
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Writes a snapshot of the list to `fp` at its current position.
+ *
+ * A full snapshot (UDLL_SNAPSHOT_FULL) stores every block and can be restored on its own. A
+ * delta snapshot (UDLL_SNAPSHOT_DELTA) stores the manifest plus only the blocks that are dirty,
+ * so its size tracks how much changed rather than how big the list is. Either kind advances the
+ * generation by one and clears every dirty flag, but only once the whole snapshot, checksum
+ * included, has been written; after a failed write the list is unchanged and the next delta
+ * still carries the same blocks.
+ *
+ * The caller owns the file: flush and fsync it to make the snapshot durable.
+ *
+ * @param u Pointer to the unrolled list.
+ * @param fp Output stream, opened in binary mode.
+ * @param kind UDLL_SNAPSHOT_FULL or UDLL_SNAPSHOT_DELTA.
+ *
+ * @return 1 on success, 0 on a write error.
+ */
+#define UDLL_SNAPSHOT(type) \
+    int snapshotUDLL__##type(UDLL__##type* u, FILE* fp, int kind) { \
+        unsigned char header[UDLL_HEADER] = {0}; \
+        struct UDLLBlock__##type* block; \
+        UDLLHash hash = {UDLL_SEED, {0}, 0}; \
+        uint64_t records = kind == UDLL_SNAPSHOT_FULL ? (uint64_t) u->blockCount : (uint64_t) u->dirtyCount; \
+        uint64_t next = u->generation + 1, size = (uint64_t) u->size, blocks = (uint64_t) u->blockCount, checksum; \
+        uint32_t entry[2], capacity = UDLL_BLOCK_CAPACITY; \
+        uint16_t version = UDLL_SNAPSHOT_VERSION; \
+        int ok; \
+        \
+        memcpy(header, "UDLL", 4); \
+        memcpy(header + 4, &version, 2); \
+        header[6] = UDLL_TAG_##type; \
+        header[7] = (unsigned char) (kind == UDLL_SNAPSHOT_FULL ? UDLL_SNAPSHOT_FULL : UDLL_SNAPSHOT_DELTA); \
+        memcpy(header + 8, &capacity, 4); \
+        memcpy(header + 12, &u->nextId, 4); \
+        memcpy(header + 16, &u->generation, 8); \
+        memcpy(header + 24, &next, 8); \
+        memcpy(header + 32, &blocks, 8); \
+        memcpy(header + 40, &records, 8); \
+        memcpy(header + 48, &size, 8); \
+        ok = writeHashedUDLL(fp, &hash, header, UDLL_HEADER); \
+        \
+        for (block = u->head; ok && block != NULL; block = block->next) { \
+            entry[0] = block->id; \
+            entry[1] = (uint32_t) block->count; \
+            ok = writeHashedUDLL(fp, &hash, entry, sizeof(entry)); \
+        } \
+        \
+        for (block = u->head; ok && block != NULL; block = block->next) { \
+            if (kind == UDLL_SNAPSHOT_FULL || block->dirty) { \
+                entry[0] = block->id; \
+                entry[1] = (uint32_t) block->count; \
+                ok = writeHashedUDLL(fp, &hash, entry, sizeof(entry)) && \
+                     writeHashedUDLL(fp, &hash, block->data, (size_t) block->count * sizeof(type)); \
+            } \
+        } \
+        \
+        checksum = finishHashUDLL(&hash); \
+        \
+        if (!ok || fwrite(&checksum, 8, 1, fp) != 1) { \
+            return 0; \
+        } \
+        \
+        for (block = u->head; block != NULL; block = block->next) { \
+            block->dirty = 0; \
+        } \
+        \
+        u->dirtyCount = 0; \
+        u->generation = next; \
+        \
+        return 1; \
+    } \
+
+UDLL_SNAPSHOT(int)
+UDLL_SNAPSHOT(float)
+UDLL_SNAPSHOT(char)
+UDLL_SNAPSHOT(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO RESTORE UDLL :                   APPLY SNAPSHOT
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Applies one snapshot read from `fp` to the list.
+ *
+ * A full snapshot replaces the whole list. A delta is accepted only if it was taken right after
+ * the generation the list is at now, and rebuilds the list from its manifest: blocks it carries
+ * replace or add to the current ones, blocks it only names are kept as they are, and blocks it
+ * does not name are freed. Restoring is therefore one full snapshot followed by each delta in
+ * the order they were written.
+ *
+ * Everything is read and checked before the list is touched, so a truncated or corrupt snapshot,
+ * or a delta for the wrong generation, leaves the list unchanged. Restored blocks are clean.
+ *
+ * @param u Pointer to the unrolled list (must be initialized).
+ * @param fp Input stream positioned at the start of a snapshot.
+ *
+ * @return 1 on success, 0 on a read error, a checksum, type or block capacity mismatch, or a
+ *         delta that does not follow the current generation.
+ */
+#define UDLL_RESTORE(type) \
+    int restoreUDLL__##type(UDLL__##type* u, FILE* fp) { \
+        unsigned char header[UDLL_HEADER]; \
+        struct UDLLBlock__##type* block; \
+        struct UDLLBlock__##type* next; \
+        struct UDLLBlock__##type** order = NULL; \
+        UDLLHash hash = {UDLL_SEED, {0}, 0}; \
+        UDLLBlockRef* fresh = NULL; \
+        UDLLBlockRef* kept = NULL; \
+        uint32_t* manifest = NULL; \
+        uint32_t entry[2], capacity, nextId; \
+        uint64_t base, generation, blocks, records, size, checksum, stored, total = 0, i; \
+        uint16_t version; \
+        size_t keptCount = 0, freshCount = 0; \
+        long at; \
+        int ok, full; \
+        \
+        if (fread(header, 1, UDLL_HEADER, fp) != UDLL_HEADER) { \
+            return 0; \
+        } \
+        \
+        updateHashUDLL(&hash, header, UDLL_HEADER); \
+        memcpy(&version, header + 4, 2); \
+        memcpy(&capacity, header + 8, 4); \
+        memcpy(&nextId, header + 12, 4); \
+        memcpy(&base, header + 16, 8); \
+        memcpy(&generation, header + 24, 8); \
+        memcpy(&blocks, header + 32, 8); \
+        memcpy(&records, header + 40, 8); \
+        memcpy(&size, header + 48, 8); \
+        full = header[7] == UDLL_SNAPSHOT_FULL; \
+        \
+        if (memcmp(header, "UDLL", 4) != 0 || version != UDLL_SNAPSHOT_VERSION || \
+            header[6] != UDLL_TAG_##type || capacity != UDLL_BLOCK_CAPACITY || \
+            (!full && base != u->generation) || records > blocks || blocks > (uint64_t) size || \
+            size > (uint64_t) INT32_MAX) { \
+            return 0; \
+        } \
+        \
+        manifest = (uint32_t*) malloc((size_t) blocks * 2 * sizeof(uint32_t) + 1); \
+        fresh = (UDLLBlockRef*) malloc((size_t) records * sizeof(UDLLBlockRef) + 1); \
+        order = (struct UDLLBlock__##type**) malloc((size_t) blocks * sizeof(*order) + 1); \
+        ok = manifest != NULL && fresh != NULL && order != NULL && \
+             readHashedUDLL(fp, &hash, manifest, (size_t) blocks * 2 * sizeof(uint32_t)); \
+        \
+        for (i = 0; ok && i < records; i++) { \
+            ok = readHashedUDLL(fp, &hash, entry, sizeof(entry)) && entry[1] >= 1 && \
+                 entry[1] <= UDLL_BLOCK_CAPACITY; \
+            block = ok ? (struct UDLLBlock__##type*) malloc(sizeof(struct UDLLBlock__##type)) : NULL; \
+            ok = block != NULL; \
+            \
+            if (ok) { \
+                block->id = entry[0]; \
+                block->count = (int) entry[1]; \
+                block->dirty = 0; \
+                fresh[freshCount].id = entry[0]; \
+                fresh[freshCount++].block = block; \
+                ok = readHashedUDLL(fp, &hash, block->data, (size_t) block->count * sizeof(type)); \
+            } \
+        } \
+        \
+        checksum = finishHashUDLL(&hash); \
+        ok = ok && fread(&stored, 8, 1, fp) == 1 && stored == checksum; \
+        \
+        if (ok) { \
+            qsort(fresh, freshCount, sizeof(UDLLBlockRef), compareBlockRefUDLL); \
+            \
+            if (!full) { \
+                kept = (UDLLBlockRef*) malloc((size_t) u->blockCount * sizeof(UDLLBlockRef) + 1); \
+                ok = kept != NULL; \
+                \
+                for (block = u->head; ok && block != NULL; block = block->next) { \
+                    kept[keptCount].id = block->id; \
+                    kept[keptCount++].block = block; \
+                } \
+                \
+                if (ok) { \
+                    qsort(kept, keptCount, sizeof(UDLLBlockRef), compareBlockRefUDLL); \
+                } \
+            } \
+        } \
+        \
+        for (i = 0; ok && i < blocks; i++) { \
+            at = findBlockRefUDLL(fresh, freshCount, manifest[2 * i]); \
+            \
+            if (at >= 0) { \
+                order[i] = (struct UDLLBlock__##type*) fresh[at].block; \
+            } else { \
+                at = findBlockRefUDLL(kept, keptCount, manifest[2 * i]); \
+                order[i] = at >= 0 ? (struct UDLLBlock__##type*) kept[at].block : NULL; \
+            } \
+            \
+            ok = order[i] != NULL && (uint32_t) order[i]->count == manifest[2 * i + 1]; \
+            total += ok ? (uint64_t) order[i]->count : 0; \
+        } \
+        \
+        ok = ok && total == size; \
+        \
+        if (!ok) { \
+            for (i = 0; i < freshCount; i++) { \
+                free(fresh[i].block); \
+            } \
+            \
+            free(manifest); \
+            free(fresh); \
+            free(kept); \
+            free(order); \
+            \
+            return 0; \
+        } \
+        \
+        for (i = 0; i < blocks; i++) { \
+            order[i]->dirty = 2; \
+        } \
+        \
+        for (block = u->head; block != NULL; block = next) { \
+            next = block->next; \
+            \
+            if (block->dirty != 2) { \
+                free(block); \
+            } \
+        } \
+        \
+        for (i = 0; i < freshCount; i++) { \
+            block = (struct UDLLBlock__##type*) fresh[i].block; \
+            \
+            if (block->dirty != 2) { \
+                free(block); \
+            } \
+        } \
+        \
+        for (i = 0; i < blocks; i++) { \
+            order[i]->dirty = 0; \
+            order[i]->prev = i > 0 ? order[i - 1] : NULL; \
+            order[i]->next = i + 1 < blocks ? order[i + 1] : NULL; \
+        } \
+        \
+        u->head = blocks > 0 ? order[0] : NULL; \
+        u->tail = blocks > 0 ? order[blocks - 1] : NULL; \
+        u->size = (int) size; \
+        u->blockCount = (int) blocks; \
+        u->dirtyCount = 0; \
+        u->nextId = nextId; \
+        u->generation = generation; \
+        \
+        free(manifest); \
+        free(fresh); \
+        free(kept); \
+        free(order); \
+        \
+        return 1; \
+    } \
+
+UDLL_RESTORE(int)
+UDLL_RESTORE(float)
+UDLL_RESTORE(char)
+UDLL_RESTORE(double)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FREE UDLL :                      ALL BLOCKS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Frees every block and leaves an empty list. The generation is kept, so deltas taken
+ *        from here on still chain onto the earlier snapshots.
+ *
+ * @param u Pointer to the unrolled list.
+ */
+#define UDLL_FREE(type) \
+    void freeUDLL__##type(UDLL__##type* u) { \
+        struct UDLLBlock__##type* block = u->head; \
+        struct UDLLBlock__##type* next; \
+        \
+        while (block != NULL) { \
+            next = block->next; \
+            free(block); \
+            block = next; \
+        } \
+        \
+        u->head = NULL; \
+        u->tail = NULL; \
+        u->size = 0; \
+        u->blockCount = 0; \
+        u->dirtyCount = 0; \
+    } \
+
+UDLL_FREE(int)
+UDLL_FREE(float)
+UDLL_FREE(char)
+UDLL_FREE(double)
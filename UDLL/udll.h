@@ -0,0 +1,137 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : udll.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the unrolled doubly linked list with incremental snapshots.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef UDLL_H
+#define UDLL_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief Elements per block. This is also the granularity of dirty tracking: changing one
+ *        element makes the next incremental snapshot rewrite its whole block.
+ */
+#ifndef UDLL_BLOCK_CAPACITY
+#define UDLL_BLOCK_CAPACITY 64
+#endif
+
+/**
+ * @brief Snapshot format version and kinds.
+ */
+#define UDLL_SNAPSHOT_VERSION 1
+#define UDLL_SNAPSHOT_DELTA 0
+#define UDLL_SNAPSHOT_FULL 1
+
+/**
+ * @brief Type tags stored in the snapshot header.
+ */
+#define UDLL_TAG_int 1
+#define UDLL_TAG_float 2
+#define UDLL_TAG_char 3
+#define UDLL_TAG_double 4
+
+/**
+ * @brief Macro to declare an unrolled doubly linked list for a specific data type.
+ *
+ * Elements live in blocks of up to UDLL_BLOCK_CAPACITY values that are chained both ways.
+ * Each block has an `id` that never changes while the block exists and a `dirty` flag that is
+ * set whenever one of its elements (or its element count) changes and cleared by a snapshot.
+ *
+ * @param type The data type for the list.
+ */
+#define DECLARE_UDLL(type) \
+    struct UDLLBlock__##type { \
+        struct UDLLBlock__##type* prev; \
+        struct UDLLBlock__##type* next; \
+        uint32_t id; \
+        int count; \
+        int dirty; \
+        type data[UDLL_BLOCK_CAPACITY]; \
+    }; \
+    typedef struct { \
+        struct UDLLBlock__##type* head; \
+        struct UDLLBlock__##type* tail; \
+        int size; \
+        int blockCount; \
+        int dirtyCount; \
+        uint32_t nextId; \
+        uint64_t generation; \
+    } UDLL__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for unrolled doubly linked list operations.
+ *
+ * Snapshot layout (host byte order):
+ *
+ * | Size            | Field                                                         |
+ * |-----------------|---------------------------------------------------------------|
+ * | 56              | header: magic `"UDLL"`, version, type tag, kind, block        |
+ * |                 | capacity, next block id, base generation, generation, block   |
+ * |                 | count, dirty block count, element count                       |
+ * | 8 per block     | manifest: `{id, count}` of every block, in list order         |
+ * | 8 + data each   | block records: `{id, count, data[count]}`, dirty blocks only  |
+ * |                 | (every block in a full snapshot)                              |
+ * | 8               | checksum of everything above                                  |
+ *
+ * A delta snapshot names the generation it applies to, and restoreUDLL() refuses to apply it
+ * to anything else. A restore is therefore one full snapshot followed by every later delta, in
+ * order.
+ *
+ * @param type The data type for the list.
+ */
+#define UDLL_PROTO(type) \
+    void initUDLL__##type(UDLL__##type* u); \
+    int insertAtHeadUDLL__##type(UDLL__##type* u, type data); \
+    int insertAtTailUDLL__##type(UDLL__##type* u, type data); \
+    int insertAtUDLL__##type(UDLL__##type* u, type data, int targetIdx); \
+    void deleteHeadUDLL__##type(UDLL__##type* u); \
+    void deleteTailUDLL__##type(UDLL__##type* u); \
+    void deleteAtUDLL__##type(UDLL__##type* u, int targetIdx); \
+    type getDataAtUDLL__##type(UDLL__##type* u, int targetIdx, type data404Response); \
+    void updateAtUDLL__##type(UDLL__##type* u, int targetIdx, type newData); \
+    int sizeUDLL__##type(UDLL__##type* u); \
+    void forEachUDLL__##type(UDLL__##type* u, void (*visit)(type data, void* ctx), void* ctx); \
+    int dirtyBlocksUDLL__##type(UDLL__##type* u); \
+    int snapshotUDLL__##type(UDLL__##type* u, FILE* fp, int kind); \
+    int restoreUDLL__##type(UDLL__##type* u, FILE* fp); \
+    void freeUDLL__##type(UDLL__##type* u); \
+
+// Declaration for int data type
+DECLARE_UDLL(int);
+// Declaration for float data type
+DECLARE_UDLL(float);
+// Declaration for char data type
+DECLARE_UDLL(char);
+// Declaration for double data type
+DECLARE_UDLL(double);
+
+UDLL_PROTO(int)
+UDLL_PROTO(float)
+UDLL_PROTO(char)
+UDLL_PROTO(double)
+
+// Macro aliases for function calls
+#define initUDLL(u, type) initUDLL__##type(u)
+#define insertAtHeadUDLL(u, data, type) insertAtHeadUDLL__##type(u, data)
+#define insertAtTailUDLL(u, data, type) insertAtTailUDLL__##type(u, data)
+#define insertAtUDLL(u, data, targetIdx, type) insertAtUDLL__##type(u, data, targetIdx)
+#define deleteHeadUDLL(u, type) deleteHeadUDLL__##type(u)
+#define deleteTailUDLL(u, type) deleteTailUDLL__##type(u)
+#define deleteAtUDLL(u, targetIdx, type) deleteAtUDLL__##type(u, targetIdx)
+#define getDataAtUDLL(u, targetIdx, data404Response, type) getDataAtUDLL__##type(u, targetIdx, data404Response)
+#define updateAtUDLL(u, targetIdx, newData, type) updateAtUDLL__##type(u, targetIdx, newData)
+#define sizeUDLL(u, type) sizeUDLL__##type(u)
+#define forEachUDLL(u, visit, ctx, type) forEachUDLL__##type(u, visit, ctx)
+#define dirtyBlocksUDLL(u, type) dirtyBlocksUDLL__##type(u)
+#define snapshotUDLL(u, fp, kind, type) snapshotUDLL__##type(u, fp, kind)
+#define restoreUDLL(u, fp, type) restoreUDLL__##type(u, fp)
+#define freeUDLL(u, type) freeUDLL__##type(u)
+
+
+#endif /* UDLL_H */
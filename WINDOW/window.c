@@ -0,0 +1,324 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : window.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the window.h header file containing the time-windowed list
+ *          implementation.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include <math.h>
+#include "window.h"
+
+// -------------------------------------------------------------------------------------------->
+// TIME WINDOW HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Generates the static helpers for one element type.
+ *
+ * - grow: doubles the capacity (16 at first). Entries are moved to their slots under the new
+ *   mask, and both monotonic queues are unrolled to start at 0. Returns 0 if memory runs out,
+ *   leaving the window unchanged.
+ * - admit: drops from the back of both queues every element the new element `s` outranks, then
+ *   appends `s` to both.
+ */
+#define TIME_WINDOW_HELPERS(type) \
+    static int growTimeWindow__##type(TimeWindow__##type* w) { \
+        int capacity = w->capacity == 0 ? 16 : 2 * w->capacity; \
+        uint64_t oldMask = (uint64_t) w->capacity - 1, newMask = (uint64_t) capacity - 1, s; \
+        struct TimeWindowEntry__##type* entries; \
+        uint64_t* minQ; \
+        uint64_t* maxQ; \
+        int i; \
+        \
+        entries = (struct TimeWindowEntry__##type*) malloc((size_t) capacity * sizeof(struct TimeWindowEntry__##type)); \
+        minQ = (uint64_t*) malloc((size_t) capacity * sizeof(uint64_t)); \
+        maxQ = (uint64_t*) malloc((size_t) capacity * sizeof(uint64_t)); \
+        \
+        if (entries == NULL || minQ == NULL || maxQ == NULL) { \
+            free(entries); \
+            free(minQ); \
+            free(maxQ); \
+            return 0; \
+        } \
+        \
+        for (s = w->first; s != w->next; s++) { \
+            entries[s & newMask] = w->entries[s & oldMask]; \
+        } \
+        \
+        for (i = 0; i < w->minLen; i++) { \
+            minQ[i] = w->minQ[(uint64_t) (w->minHead + i) & oldMask]; \
+        } \
+        \
+        for (i = 0; i < w->maxLen; i++) { \
+            maxQ[i] = w->maxQ[(uint64_t) (w->maxHead + i) & oldMask]; \
+        } \
+        \
+        free(w->entries); \
+        free(w->minQ); \
+        free(w->maxQ); \
+        \
+        w->entries = entries; \
+        w->minQ = minQ; \
+        w->maxQ = maxQ; \
+        w->capacity = capacity; \
+        w->minHead = 0; \
+        w->maxHead = 0; \
+        return 1; \
+    } \
+    \
+    static void admitTimeWindow__##type(TimeWindow__##type* w, uint64_t s) { \
+        uint64_t mask = (uint64_t) w->capacity - 1; \
+        type x = w->entries[s & mask].data; \
+        uint64_t back; \
+        \
+        while (w->minLen > 0) { \
+            back = w->minQ[(uint64_t) (w->minHead + w->minLen - 1) & mask]; \
+            \
+            if (w->entries[back & mask].data < x) { \
+                break; \
+            } \
+            \
+            w->minLen--; \
+        } \
+        \
+        w->minQ[(uint64_t) (w->minHead + w->minLen++) & mask] = s; \
+        \
+        while (w->maxLen > 0) { \
+            back = w->maxQ[(uint64_t) (w->maxHead + w->maxLen - 1) & mask]; \
+            \
+            if (x < w->entries[back & mask].data) { \
+                break; \
+            } \
+            \
+            w->maxLen--; \
+        } \
+        \
+        w->maxQ[(uint64_t) (w->maxHead + w->maxLen++) & mask] = s; \
+    } \
+
+TIME_WINDOW_HELPERS(int)
+TIME_WINDOW_HELPERS(float)
+TIME_WINDOW_HELPERS(char)
+TIME_WINDOW_HELPERS(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INITIALIZE TIME WINDOW
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Initializes an empty window that keeps elements for `span` time units. No memory is
+ *        allocated until the first push.
+ *
+ * @param w Pointer to the window.
+ * @param span Length of the window, in the unit of the timestamps.
+ */
+#define TIME_WINDOW_INIT(type) \
+    void initTimeWindow__##type(TimeWindow__##type* w, double span) { \
+        w->entries = NULL; \
+        w->minQ = NULL; \
+        w->maxQ = NULL; \
+        w->first = 0; \
+        w->next = 0; \
+        w->capacity = 0; \
+        w->minHead = 0; \
+        w->minLen = 0; \
+        w->maxHead = 0; \
+        w->maxLen = 0; \
+        w->span = span; \
+        w->now = -HUGE_VAL; \
+        w->sum = 0.0; \
+    } \
+
+TIME_WINDOW_INIT(int)
+TIME_WINDOW_INIT(float)
+TIME_WINDOW_INIT(char)
+TIME_WINDOW_INIT(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO EXPIRE / PUSH DATA OF TIME WINDOW :   O(1) AMORTIZED
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief expireTimeWindow() advances the window to `now` and drops, oldest first, every
+ *        element whose timestamp is not after `now - span`, updating the aggregates as they
+ *        leave. It returns how many elements were dropped. A `now` earlier than the latest
+ *        timestamp seen is treated as that timestamp.
+ *
+ *        pushTimeWindow() first expires up to `timestamp`, then appends the element. It returns
+ *        0, changing nothing, if `timestamp` is earlier than the latest timestamp seen or if
+ *        memory runs out.
+ *
+ * @param w Pointer to the window.
+ */
+#define TIME_WINDOW_PUSH(type) \
+    int expireTimeWindow__##type(TimeWindow__##type* w, double now) { \
+        uint64_t mask = (uint64_t) w->capacity - 1; \
+        double cutoff; \
+        int dropped = 0; \
+        \
+        if (now > w->now) { \
+            w->now = now; \
+        } \
+        \
+        cutoff = w->now - w->span; \
+        \
+        while (w->first != w->next && w->entries[w->first & mask].timestamp <= cutoff) { \
+            w->sum -= (double) w->entries[w->first & mask].data; \
+            \
+            if (w->minQ[(uint64_t) w->minHead & mask] == w->first) { \
+                w->minHead = (int) ((uint64_t) (w->minHead + 1) & mask); \
+                w->minLen--; \
+            } \
+            \
+            if (w->maxQ[(uint64_t) w->maxHead & mask] == w->first) { \
+                w->maxHead = (int) ((uint64_t) (w->maxHead + 1) & mask); \
+                w->maxLen--; \
+            } \
+            \
+            w->first++; \
+            dropped++; \
+        } \
+        \
+        if (w->first == w->next) { \
+            w->sum = 0.0; \
+        } \
+        \
+        return dropped; \
+    } \
+    \
+    int pushTimeWindow__##type(TimeWindow__##type* w, double timestamp, type data) { \
+        struct TimeWindowEntry__##type* entry; \
+        \
+        if (timestamp < w->now) { \
+            return 0; \
+        } \
+        \
+        expireTimeWindow__##type(w, timestamp); \
+        \
+        if (w->next - w->first == (uint64_t) w->capacity && !growTimeWindow__##type(w)) { \
+            return 0; \
+        } \
+        \
+        entry = &w->entries[w->next & ((uint64_t) w->capacity - 1)]; \
+        entry->timestamp = timestamp; \
+        entry->data = data; \
+        w->sum += (double) data; \
+        admitTimeWindow__##type(w, w->next++); \
+        return 1; \
+    } \
+
+TIME_WINDOW_PUSH(int)
+TIME_WINDOW_PUSH(float)
+TIME_WINDOW_PUSH(char)
+TIME_WINDOW_PUSH(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO READ AGGREGATES OF TIME WINDOW :  O(1)
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Rolling aggregates over the elements currently in the window. The sum and mean are
+ *        kept in a double; min and max return `data404Response` if the window is empty, and
+ *        the mean is 0 then.
+ *
+ * @param w Pointer to the window.
+ */
+#define TIME_WINDOW_AGGREGATES(type) \
+    int countTimeWindow__##type(TimeWindow__##type* w) { \
+        return (int) (w->next - w->first); \
+    } \
+    \
+    double sumTimeWindow__##type(TimeWindow__##type* w) { \
+        return w->sum; \
+    } \
+    \
+    double meanTimeWindow__##type(TimeWindow__##type* w) { \
+        return w->first == w->next ? 0.0 : w->sum / (double) (w->next - w->first); \
+    } \
+    \
+    type minTimeWindow__##type(TimeWindow__##type* w, type data404Response) { \
+        uint64_t mask = (uint64_t) w->capacity - 1; \
+        \
+        if (w->minLen == 0) { \
+            return data404Response; \
+        } \
+        \
+        return w->entries[w->minQ[(uint64_t) w->minHead & mask] & mask].data; \
+    } \
+    \
+    type maxTimeWindow__##type(TimeWindow__##type* w, type data404Response) { \
+        uint64_t mask = (uint64_t) w->capacity - 1; \
+        \
+        if (w->maxLen == 0) { \
+            return data404Response; \
+        } \
+        \
+        return w->entries[w->maxQ[(uint64_t) w->maxHead & mask] & mask].data; \
+    } \
+
+TIME_WINDOW_AGGREGATES(int)
+TIME_WINDOW_AGGREGATES(float)
+TIME_WINDOW_AGGREGATES(char)
+TIME_WINDOW_AGGREGATES(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO GET / VISIT DATA OF TIME WINDOW
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief getDataAtTimeWindow() returns the element `targetIdx` places after the oldest, or
+ *        `data404Response` if out of range, in O(1). forEachTimeWindow() calls
+ *        `visit(timestamp, data, ctx)` for every element from oldest to newest.
+ *
+ * @param w Pointer to the window.
+ */
+#define TIME_WINDOW_ACCESS(type) \
+    type getDataAtTimeWindow__##type(TimeWindow__##type* w, int targetIdx, type data404Response) { \
+        if (targetIdx < 0 || (uint64_t) targetIdx >= w->next - w->first) { \
+            return data404Response; \
+        } \
+        \
+        return w->entries[(w->first + (uint64_t) targetIdx) & ((uint64_t) w->capacity - 1)].data; \
+    } \
+    \
+    void forEachTimeWindow__##type(TimeWindow__##type* w, void (*visit)(double timestamp, type data, void* ctx), void* ctx) { \
+        uint64_t mask = (uint64_t) w->capacity - 1, s; \
+        \
+        for (s = w->first; s != w->next; s++) { \
+            visit(w->entries[s & mask].timestamp, w->entries[s & mask].data, ctx); \
+        } \
+    } \
+
+TIME_WINDOW_ACCESS(int)
+TIME_WINDOW_ACCESS(float)
+TIME_WINDOW_ACCESS(char)
+TIME_WINDOW_ACCESS(double)
+
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO CLEAR / FREE TIME WINDOW
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief clearTimeWindow() drops every element and forgets the latest timestamp, keeping the
+ *        ring for reuse. freeTimeWindow() also releases the ring; the span is kept.
+ *
+ * @param w Pointer to the window.
+ */
+#define TIME_WINDOW_CLEAR_FREE(type) \
+    void clearTimeWindow__##type(TimeWindow__##type* w) { \
+        w->first = w->next; \
+        w->minHead = 0; \
+        w->minLen = 0; \
+        w->maxHead = 0; \
+        w->maxLen = 0; \
+        w->now = -HUGE_VAL; \
+        w->sum = 0.0; \
+    } \
+    \
+    void freeTimeWindow__##type(TimeWindow__##type* w) { \
+        free(w->entries); \
+        free(w->minQ); \
+        free(w->maxQ); \
+        initTimeWindow__##type(w, w->span); \
+    } \
+
+TIME_WINDOW_CLEAR_FREE(int)
+TIME_WINDOW_CLEAR_FREE(float)
+TIME_WINDOW_CLEAR_FREE(char)
+TIME_WINDOW_CLEAR_FREE(double)
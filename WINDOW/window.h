@@ -0,0 +1,107 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : window.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the time-windowed list with automatic expiry and rolling aggregates.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef WINDOW_H
+#define WINDOW_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * @brief Macro to declare a time-windowed list for a specific data type.
+ *
+ * Elements are kept oldest first in a growable ring of {timestamp, data} entries. Every element
+ * gets a sequence number when it is pushed; `first` is the sequence number of the oldest
+ * element and `next` the one the next push gets, and element `s` lives in
+ * `entries[s & (capacity - 1)]`. The capacity is a power of two.
+ *
+ * `minQ` and `maxQ` are monotonic queues of sequence numbers (rings starting at `minHead` /
+ * `maxHead`): the data of the elements they name increase (`minQ`) or decrease (`maxQ`) from
+ * front to back, so their fronts are the window minimum and maximum. An element is dropped from
+ * the back of a queue as soon as a newer element makes it impossible for it to be the extreme
+ * again, which keeps each push and expiry O(1) amortized.
+ *
+ * `now` is the latest timestamp seen and `sum` the running sum of the elements in the window.
+ *
+ * @param type The data type for the window.
+ */
+#define DECLARE_TIME_WINDOW(type) \
+    struct TimeWindowEntry__##type { \
+        double timestamp; \
+        type data; \
+    }; \
+    typedef struct { \
+        struct TimeWindowEntry__##type* entries; \
+        uint64_t* minQ; \
+        uint64_t* maxQ; \
+        uint64_t first; \
+        uint64_t next; \
+        int capacity; \
+        int minHead; \
+        int minLen; \
+        int maxHead; \
+        int maxLen; \
+        double span; \
+        double now; \
+        double sum; \
+    } TimeWindow__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for time-windowed list operations.
+ *
+ * The window holds the elements whose timestamp lies in (now - span, now], where `now` is the
+ * latest timestamp passed to pushTimeWindow() or expireTimeWindow(). Timestamps are plain
+ * doubles in any unit, typically seconds, and must not decrease from one push to the next.
+ * count, sum, mean, min and max are O(1).
+ *
+ * @param type The data type for the window.
+ */
+#define TIME_WINDOW_PROTO(type) \
+    void initTimeWindow__##type(TimeWindow__##type* w, double span); \
+    int pushTimeWindow__##type(TimeWindow__##type* w, double timestamp, type data); \
+    int expireTimeWindow__##type(TimeWindow__##type* w, double now); \
+    int countTimeWindow__##type(TimeWindow__##type* w); \
+    double sumTimeWindow__##type(TimeWindow__##type* w); \
+    double meanTimeWindow__##type(TimeWindow__##type* w); \
+    type minTimeWindow__##type(TimeWindow__##type* w, type data404Response); \
+    type maxTimeWindow__##type(TimeWindow__##type* w, type data404Response); \
+    type getDataAtTimeWindow__##type(TimeWindow__##type* w, int targetIdx, type data404Response); \
+    void forEachTimeWindow__##type(TimeWindow__##type* w, void (*visit)(double timestamp, type data, void* ctx), void* ctx); \
+    void clearTimeWindow__##type(TimeWindow__##type* w); \
+    void freeTimeWindow__##type(TimeWindow__##type* w); \
+
+// Declaration for int data type
+DECLARE_TIME_WINDOW(int);
+// Declaration for float data type
+DECLARE_TIME_WINDOW(float);
+// Declaration for char data type
+DECLARE_TIME_WINDOW(char);
+// Declaration for double data type
+DECLARE_TIME_WINDOW(double);
+
+TIME_WINDOW_PROTO(int)
+TIME_WINDOW_PROTO(float)
+TIME_WINDOW_PROTO(char)
+TIME_WINDOW_PROTO(double)
+
+// Macro aliases for function calls
+#define initTimeWindow(w, span, type) initTimeWindow__##type(w, span)
+#define pushTimeWindow(w, timestamp, data, type) pushTimeWindow__##type(w, timestamp, data)
+#define expireTimeWindow(w, now, type) expireTimeWindow__##type(w, now)
+#define countTimeWindow(w, type) countTimeWindow__##type(w)
+#define sumTimeWindow(w, type) sumTimeWindow__##type(w)
+#define meanTimeWindow(w, type) meanTimeWindow__##type(w)
+#define minTimeWindow(w, data404Response, type) minTimeWindow__##type(w, data404Response)
+#define maxTimeWindow(w, data404Response, type) maxTimeWindow__##type(w, data404Response)
+#define getDataAtTimeWindow(w, targetIdx, data404Response, type) getDataAtTimeWindow__##type(w, targetIdx, data404Response)
+#define forEachTimeWindow(w, visit, ctx, type) forEachTimeWindow__##type(w, visit, ctx)
+#define clearTimeWindow(w, type) clearTimeWindow__##type(w)
+#define freeTimeWindow(w, type) freeTimeWindow__##type(w)
+
+
+#endif /* WINDOW_H */
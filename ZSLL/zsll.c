@@ -0,0 +1,356 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : zsll.c
+ * @author : UIU Developers Hub
+ * @brief : Source file for the zsll.h header file containing the compressed singly linked list.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#include <limits.h>
+#include <string.h>
+#include "zsll.h"
+
+// -------------------------------------------------------------------------------------------->
+// DELTA ENCODING HELPERS
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Writes `v` as a LEB128 varint (7 bits per byte, high bit = more bytes follow).
+ *
+ * @return The number of bytes written (at most 10).
+ */
+static size_t encodeVarintZSLL(unsigned char* out, uint64_t v) {
+    size_t n = 0;
+
+    while (v >= 0x80) {
+        out[n++] = (unsigned char) (v | 0x80);
+        v >>= 7;
+    }
+    out[n++] = (unsigned char) v;
+
+    return n;
+}
+
+/**
+ * @brief Reads one varint at `*p`, advances `*p` past it and returns the decoded delta.
+ *
+ * Deltas are zigzag encoded (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...) so small negative steps
+ * stay one byte long as well.
+ */
+static int64_t decodeDeltaZSLL(const unsigned char** p) {
+    const unsigned char* q = *p;
+    uint64_t v = 0;
+    int shift = 0;
+
+    while (*q & 0x80) {
+        v |= (uint64_t) (*q++ & 0x7f) << shift;
+        shift += 7;
+    }
+    v |= (uint64_t) *q++ << shift;
+    *p = q;
+
+    return (int64_t) (v >> 1) ^ -(int64_t) (v & 1);
+}
+
+static uint64_t zigzagZSLL(int64_t d) {
+    return ((uint64_t) d << 1) ^ (uint64_t) (d >> 63);
+}
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO INIT / INSERT DATA TO ZSLL :     TAIL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Appends `data`, as a delta to the previous element when it fits in the tail block or
+ *        as the raw first element of a new block otherwise.
+ *
+ * @param z Pointer to the compressed list.
+ * @param data Data to be appended.
+ *
+ * @return 1 on success, 0 if memory ran out (the list is unchanged).
+ */
+#define ZSLL_INSERT(type) \
+    void initZSLL__##type(ZSLL__##type* z) { \
+        z->head = NULL; \
+        z->tail = NULL; \
+        z->blocks = NULL; \
+        z->starts = NULL; \
+        z->blockCount = 0; \
+        z->blockCapacity = 0; \
+        z->size = 0; \
+    } \
+    \
+    int insertAtTailZSLL__##type(ZSLL__##type* z, type data) { \
+        struct ZSLLBlock__##type* block = z->tail; \
+        struct ZSLLBlock__##type** blocks; \
+        unsigned char enc[10]; \
+        int* starts; \
+        int capacity; \
+        size_t n; \
+        \
+        if (z->size == INT_MAX) { \
+            return 0; \
+        } \
+        \
+        if (block != NULL) { \
+            n = encodeVarintZSLL(enc, zigzagZSLL((int64_t) data - (int64_t) block->last)); \
+            \
+            if (block->used + n <= ZSLL_BLOCK_BYTES) { \
+                memcpy(block->data + block->used, enc, n); \
+                block->used = (unsigned short) (block->used + n); \
+                block->count++; \
+                block->last = data; \
+                z->size++; \
+                return 1; \
+            } \
+        } \
+        \
+        if (z->blockCount == z->blockCapacity) { \
+            capacity = z->blockCapacity != 0 ? z->blockCapacity * 2 : 16; \
+            blocks = (struct ZSLLBlock__##type**) realloc(z->blocks, (size_t) capacity * sizeof(*blocks)); \
+            \
+            if (blocks == NULL) { \
+                return 0; \
+            } \
+            z->blocks = blocks; \
+            \
+            starts = (int*) realloc(z->starts, (size_t) capacity * sizeof(*starts)); \
+            \
+            if (starts == NULL) { \
+                return 0; \
+            } \
+            z->starts = starts; \
+            z->blockCapacity = capacity; \
+        } \
+        \
+        block = (struct ZSLLBlock__##type*) malloc(sizeof(struct ZSLLBlock__##type)); \
+        \
+        if (block == NULL) { \
+            return 0; \
+        } \
+        \
+        block->next = NULL; \
+        block->first = data; \
+        block->last = data; \
+        block->count = 1; \
+        block->used = 0; \
+        \
+        if (z->tail == NULL) { \
+            z->head = block; \
+        } else { \
+            z->tail->next = block; \
+        } \
+        z->tail = block; \
+        z->blocks[z->blockCount] = block; \
+        z->starts[z->blockCount] = z->size; \
+        z->blockCount++; \
+        z->size++; \
+        \
+        return 1; \
+    } \
+
+ZSLL_INSERT(int)
+ZSLL_INSERT(char)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO READ ZSLL :                      BY INDEX / SEARCH / ITERATE
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief getDataAt binary-searches the block directory and decodes only inside the block
+ *        that holds `targetIdx`. indexOf and forEach decode the blocks front to back, reading
+ *        about one byte per element.
+ *
+ * @param z Pointer to the compressed list.
+ * @param data404Response Value returned by getDataAt when the index is out of range.
+ *
+ * @return getDataAt: the element; indexOf: the first matching index or -1.
+ */
+#define ZSLL_READ(type) \
+    type getDataAtZSLL__##type(ZSLL__##type* z, int targetIdx, type data404Response) { \
+        const unsigned char* p; \
+        int64_t v; \
+        int lo = 0, hi, mid, k; \
+        \
+        if (targetIdx < 0 || targetIdx >= z->size) { \
+            return data404Response; \
+        } \
+        \
+        hi = z->blockCount - 1; \
+        while (lo < hi) { \
+            mid = lo + (hi - lo + 1) / 2; \
+            \
+            if (z->starts[mid] <= targetIdx) { \
+                lo = mid; \
+            } else { \
+                hi = mid - 1; \
+            } \
+        } \
+        \
+        p = z->blocks[lo]->data; \
+        v = z->blocks[lo]->first; \
+        for (k = z->starts[lo]; k < targetIdx; k++) { \
+            v += decodeDeltaZSLL(&p); \
+        } \
+        \
+        return (type) v; \
+    } \
+    \
+    int indexOfZSLL__##type(ZSLL__##type* z, type targetData) { \
+        struct ZSLLBlock__##type* block; \
+        const unsigned char* p; \
+        int64_t v; \
+        int i, k; \
+        \
+        for (i = 0; i < z->blockCount; i++) { \
+            block = z->blocks[i]; \
+            p = block->data; \
+            v = block->first; \
+            \
+            for (k = 0; k < block->count; k++) { \
+                if (k > 0) { \
+                    v += decodeDeltaZSLL(&p); \
+                } \
+                \
+                if ((type) v == targetData) { \
+                    return z->starts[i] + k; \
+                } \
+            } \
+        } \
+        \
+        return -1; \
+    } \
+    \
+    void forEachZSLL__##type(ZSLL__##type* z, void (*visit)(type data, void* ctx), void* ctx) { \
+        struct ZSLLBlock__##type* block; \
+        const unsigned char* p; \
+        int64_t v; \
+        int k; \
+        \
+        for (block = z->head; block != NULL; block = block->next) { \
+            p = block->data; \
+            v = block->first; \
+            visit((type) v, ctx); \
+            \
+            for (k = 1; k < block->count; k++) { \
+                v += decodeDeltaZSLL(&p); \
+                visit((type) v, ctx); \
+            } \
+        } \
+    } \
+    \
+    int sizeZSLL__##type(ZSLL__##type* z) { \
+        return z->size; \
+    } \
+    \
+    size_t memoryZSLL__##type(ZSLL__##type* z) { \
+        return (size_t) z->blockCount * sizeof(struct ZSLLBlock__##type) + \
+               (size_t) z->blockCapacity * (sizeof(*z->blocks) + sizeof(*z->starts)); \
+    } \
+
+ZSLL_READ(int)
+ZSLL_READ(char)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO CONVERT ZSLL :                   FROM SLL / TO SLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief fromSLL appends every element of `sll` to `z`. toSLL decompresses `z` onto the tail
+ *        of `sll` in one pass, linking a private chain first so that running out of memory
+ *        leaves `sll` unchanged.
+ *
+ * @param z Pointer to the compressed list.
+ * @param sll Pointer to the plain singly linked list.
+ *
+ * @return 1 on success, 0 if memory ran out. fromSLL keeps the elements appended before the
+ *         failure.
+ */
+#define ZSLL_CONVERT(type) \
+    int fromSLLZSLL__##type(ZSLL__##type* z, SLL__##type* sll) { \
+        struct SLLNode__##type* itr; \
+        \
+        for (itr = sll->head; itr != NULL; itr = itr->next) { \
+            if (!insertAtTailZSLL__##type(z, itr->data)) { \
+                return 0; \
+            } \
+        } \
+        \
+        return 1; \
+    } \
+    \
+    int toSLLZSLL__##type(ZSLL__##type* z, SLL__##type* sll) { \
+        struct ZSLLBlock__##type* block; \
+        struct SLLNode__##type* head = NULL; \
+        struct SLLNode__##type* tail = NULL; \
+        struct SLLNode__##type* node; \
+        const unsigned char* p; \
+        int64_t v = 0; \
+        int k; \
+        \
+        if (z->size > INT_MAX - sll->size) { \
+            return 0; \
+        } \
+        \
+        for (block = z->head; block != NULL; block = block->next) { \
+            p = block->data; \
+            \
+            for (k = 0; k < block->count; k++) { \
+                v = k == 0 ? (int64_t) block->first : v + decodeDeltaZSLL(&p); \
+                node = (struct SLLNode__##type*) malloc(sizeof(struct SLLNode__##type)); \
+                \
+                if (node == NULL) { \
+                    while (head != NULL) { \
+                        node = head->next; \
+                        free(head); \
+                        head = node; \
+                    } \
+                    return 0; \
+                } \
+                \
+                node->data = (type) v; \
+                node->next = NULL; \
+                \
+                if (tail == NULL) { \
+                    head = node; \
+                } else { \
+                    tail->next = node; \
+                } \
+                tail = node; \
+            } \
+        } \
+        \
+        if (head != NULL) { \
+            if (sll->tail == NULL) { \
+                sll->head = head; \
+            } else { \
+                sll->tail->next = head; \
+            } \
+            sll->tail = tail; \
+            sll->size += z->size; \
+        } \
+        \
+        return 1; \
+    } \
+
+ZSLL_CONVERT(int)
+ZSLL_CONVERT(char)
+// -------------------------------------------------------------------------------------------->
+// FUNCTION TO FREE ZSLL
+// -------------------------------------------------------------------------------------------->
+/**
+ * @brief Releases every block and the directory and leaves `z` empty and reusable.
+ *
+ * @param z Pointer to the compressed list.
+ */
+#define ZSLL_FREE(type) \
+    void freeZSLL__##type(ZSLL__##type* z) { \
+        struct ZSLLBlock__##type* block = z->head; \
+        struct ZSLLBlock__##type* next; \
+        \
+        while (block != NULL) { \
+            next = block->next; \
+            free(block); \
+            block = next; \
+        } \
+        \
+        free(z->blocks); \
+        free(z->starts); \
+        initZSLL__##type(z); \
+    } \
+
+ZSLL_FREE(int)
+ZSLL_FREE(char)
@@ -0,0 +1,99 @@
+// -------------------------------------------------------------------------------------------->
+/**
+ * @file : zsll.h
+ * @author : UIU Developers Hub
+ * @brief : Header file for the compressed (delta + varint) unrolled singly linked list.
+ */
+// -------------------------------------------------------------------------------------------->
+
+#ifndef ZSLL_H
+#define ZSLL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "../SLL/sll.h"
+
+/**
+ * @brief Encoded payload bytes per block. Larger blocks compress better (less header overhead
+ *        per element) but make getDataAt() decode more elements. Must be below 65536.
+ */
+#ifndef ZSLL_BLOCK_BYTES
+#define ZSLL_BLOCK_BYTES 256
+#endif
+
+/**
+ * @brief Macro to declare a compressed singly linked list for a specific data type.
+ *
+ * Elements are stored in unrolled blocks. A block keeps its first element raw; every following
+ * element is the zigzag-encoded difference to its predecessor, written as a LEB128 varint, so
+ * an increasing ID sequence with small gaps costs about one byte per element instead of a
+ * 16-byte SLL node.
+ *
+ * `blocks` / `starts` form the block-level skip directory: `starts[i]` is the list index of the
+ * first element of `blocks[i]`, so getDataAt() finds its block with a binary search and only
+ * decodes inside that block.
+ *
+ * @param type The data type for the compressed list (int or char).
+ */
+#define DECLARE_ZSLL(type) \
+    struct ZSLLBlock__##type { \
+        struct ZSLLBlock__##type* next; \
+        type first; \
+        type last; \
+        unsigned short count; \
+        unsigned short used; \
+        unsigned char data[ZSLL_BLOCK_BYTES]; \
+    }; \
+    typedef struct { \
+        struct ZSLLBlock__##type* head; \
+        struct ZSLLBlock__##type* tail; \
+        struct ZSLLBlock__##type** blocks; \
+        int* starts; \
+        int blockCount; \
+        int blockCapacity; \
+        int size; \
+    } ZSLL__##type; \
+
+/**
+ * @brief Macro to declare function prototypes for compressed singly linked list operations.
+ *
+ * The list is append-only: elements are added at the tail and the whole list is released with
+ * freeZSLL(). To edit it in place, decompress it into an SLL with toSLLZSLL().
+ *
+ * @param type The data type for the compressed list.
+ */
+#define ZSLL_PROTO(type) \
+    void initZSLL__##type(ZSLL__##type* z); \
+    int insertAtTailZSLL__##type(ZSLL__##type* z, type data); \
+    type getDataAtZSLL__##type(ZSLL__##type* z, int targetIdx, type data404Response); \
+    int indexOfZSLL__##type(ZSLL__##type* z, type targetData); \
+    void forEachZSLL__##type(ZSLL__##type* z, void (*visit)(type data, void* ctx), void* ctx); \
+    int sizeZSLL__##type(ZSLL__##type* z); \
+    size_t memoryZSLL__##type(ZSLL__##type* z); \
+    int fromSLLZSLL__##type(ZSLL__##type* z, SLL__##type* sll); \
+    int toSLLZSLL__##type(ZSLL__##type* z, SLL__##type* sll); \
+    void freeZSLL__##type(ZSLL__##type* z); \
+
+// Declaration for int data type
+DECLARE_ZSLL(int);
+// Declaration for char data type
+DECLARE_ZSLL(char);
+
+ZSLL_PROTO(int)
+ZSLL_PROTO(char)
+
+// Macro aliases for function calls
+#define initZSLL(z, type) initZSLL__##type(z)
+#define insertAtTailZSLL(z, data, type) insertAtTailZSLL__##type(z, data)
+#define getDataAtZSLL(z, targetIdx, data404Response, type) getDataAtZSLL__##type(z, targetIdx, data404Response)
+#define indexOfZSLL(z, targetData, type) indexOfZSLL__##type(z, targetData)
+#define forEachZSLL(z, visit, ctx, type) forEachZSLL__##type(z, visit, ctx)
+#define sizeZSLL(z, type) sizeZSLL__##type(z)
+#define memoryZSLL(z, type) memoryZSLL__##type(z)
+#define fromSLLZSLL(z, sll, type) fromSLLZSLL__##type(z, sll)
+#define toSLLZSLL(z, sll, type) toSLLZSLL__##type(z, sll)
+#define freeZSLL(z, type) freeZSLL__##type(z)
+
+
+#endif /* ZSLL_H */